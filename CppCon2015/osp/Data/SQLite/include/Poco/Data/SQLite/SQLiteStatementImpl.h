@@ -23,6 +23,7 @@
 #include "Poco/Data/SQLite/SQLite.h"
 #include "Poco/Data/SQLite/Binder.h"
 #include "Poco/Data/SQLite/Extractor.h"
+#include "Poco/Data/SQLite/StatementCache.h"
 #include "Poco/Data/StatementImpl.h"
 #include "Poco/Data/MetaColumn.h"
 #include "Poco/SharedPtr.h"
@@ -44,8 +45,12 @@ class SQLite_API SQLiteStatementImpl: public Poco::Data::StatementImpl
 	/// Implements statement functionality needed for SQLite
 {
 public:
-	SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB);
+	SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB, StatementCache::Ptr pCache = 0);
 		/// Creates the SQLiteStatementImpl.
+		///
+		/// If a StatementCache is given, statements consisting of
+		/// a single SQL statement are taken from the cache instead
+		/// of being compiled, and returned to it afterwards.
 
 	~SQLiteStatementImpl();
 		/// Destroys the SQLiteStatementImpl.
@@ -106,19 +111,22 @@ private:
 	typedef Poco::SharedPtr<std::string>        StrPtr;
 	typedef Bindings::iterator                  BindIt;
 
-	sqlite3*         _pDB;
-	sqlite3_stmt*    _pStmt;
-	bool             _stepCalled;
-	int              _nextResponse;
-	BinderPtr        _pBinder;
-	ExtractorPtr     _pExtractor;
-	MetaColumnVecVec _columns;
-	int              _affectedRowCount;
-	StrPtr           _pLeftover;
-	BindIt           _bindBegin;
-	bool             _canBind;
-	bool             _isExtracted;
-	bool             _canCompile;
+	sqlite3*            _pDB;
+	sqlite3_stmt*       _pStmt;
+	StatementCache::Ptr _pCache;
+	std::string         _cacheKey;
+	int                 _schemaGeneration;
+	bool                _stepCalled;
+	int                 _nextResponse;
+	BinderPtr           _pBinder;
+	ExtractorPtr        _pExtractor;
+	MetaColumnVecVec    _columns;
+	int                 _affectedRowCount;
+	StrPtr              _pLeftover;
+	BindIt              _bindBegin;
+	bool                _canBind;
+	bool                _isExtracted;
+	bool                _canCompile;
 
 	static const int POCO_SQLITE_INV_ROW_CNT;
 };
@@ -23,6 +23,7 @@
 #include "Poco/Data/SQLite/SQLite.h"
 #include "Poco/Data/SQLite/Connector.h"
 #include "Poco/Data/SQLite/Binder.h"
+#include "Poco/Data/SQLite/StatementCache.h"
 #include "Poco/Data/AbstractSessionImpl.h"
 #include "Poco/SharedPtr.h"
 #include "Poco/Mutex.h"
@@ -41,6 +42,19 @@ namespace SQLite {
 
 class SQLite_API SessionImpl: public Poco::Data::AbstractSessionImpl<SessionImpl>
 	/// Implements SessionImpl interface.
+	///
+	/// Prepared statements are kept in a StatementCache, so that
+	/// statements with the same SQL text do not have to be compiled
+	/// again. The cache is configured and monitored with the following
+	/// properties:
+	///
+	///   - statementCacheSize (std::size_t): the maximum number of cached
+	///     statements (default: StatementCache::DEFAULT_SIZE). A value
+	///     of 0 disables the cache.
+	///   - statementCacheHits (std::size_t, read-only): the number of
+	///     statements taken from the cache.
+	///   - statementCacheMisses (std::size_t, read-only): the number of
+	///     statements that had to be compiled.
 {
 public:
 	SessionImpl(const std::string& fileName,
@@ -120,14 +134,20 @@ public:
 protected:
 	void setConnectionTimeout(const std::string& prop, const Poco::Any& value);
 	Poco::Any getConnectionTimeout(const std::string& prop);
+	void setStatementCacheSize(const std::string& prop, const Poco::Any& value);
+	Poco::Any getStatementCacheSize(const std::string& prop);
+	Poco::Any getStatementCacheHits(const std::string& prop);
+	Poco::Any getStatementCacheMisses(const std::string& prop);
 
 private:
-	std::string _connector;
-	sqlite3*    _pDB;
-	bool        _connected;
-	bool        _isTransaction;
-	int         _timeout;
-	Poco::Mutex _mutex;
+	std::string         _connector;
+	sqlite3*            _pDB;
+	bool                _connected;
+	bool                _isTransaction;
+	int                 _timeout;
+	StatementCache::Ptr _pStatementCache;
+	std::size_t         _statementCacheSize;
+	Poco::Mutex         _mutex;
 
 	static const std::string DEFERRED_BEGIN_TRANSACTION;
 	static const std::string COMMIT_TRANSACTION;
@@ -0,0 +1,162 @@
+//
+// StatementCache.h
+//
+// $Id$
+//
+// Library: SQLite
+// Package: SQLite
+// Module:  StatementCache
+//
+// Definition of the StatementCache class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_SQLite_StatementCache_INCLUDED
+#define Data_SQLite_StatementCache_INCLUDED
+
+
+#include "Poco/Data/SQLite/SQLite.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Mutex.h"
+#include <map>
+#include <list>
+
+
+extern "C"
+{
+	typedef struct sqlite3 sqlite3;
+	typedef struct sqlite3_stmt sqlite3_stmt;
+}
+
+
+namespace Poco {
+namespace Data {
+namespace SQLite {
+
+
+class SQLite_API StatementCache
+	/// A bounded cache of prepared SQLite statements (sqlite3_stmt handles),
+	/// keyed by SQL text.
+	///
+	/// Each SessionImpl owns a StatementCache. A SQLiteStatementImpl
+	/// takes the prepared statement for its SQL text out of the cache
+	/// instead of compiling it with sqlite3_prepare_v2(), and returns it
+	/// to the cache (reset, with cleared bindings) when it is done with it.
+	/// If the cache is full, the least recently returned statement is
+	/// finalized.
+	///
+	/// Column metadata of a statement is obtained right after preparing
+	/// it. Therefore, cached statements are discarded if the database
+	/// schema may have changed since they have been prepared. To detect
+	/// schema changes without executing an extra statement for every
+	/// acquire(), the cache installs an authorizer callback (see 
+	/// sqlite3_set_authorizer()) on the database connection, which 
+	/// counts statements changing the schema (CREATE, DROP, ALTER, 
+	/// ATTACH and DETACH) when they are prepared. A statement that has 
+	/// been prepared or executed while the count changed is never cached.
+	/// Schema changes made through other database connections are handled 
+	/// by SQLite, which automatically re-prepares an affected statement
+	/// when it is executed. If this fails (SQLITE_SCHEMA), the 
+	/// cache must be cleared with clear().
+	///
+	/// Applications must not install their own authorizer on a 
+	/// database connection that uses a StatementCache.
+	///
+	/// All methods are thread-safe.
+{
+public:
+	typedef Poco::SharedPtr<StatementCache> Ptr;
+
+	enum
+	{
+		DEFAULT_SIZE = 64
+			/// Default maximum number of cached statements.
+	};
+
+	StatementCache(sqlite3* pDB, std::size_t size = DEFAULT_SIZE);
+		/// Creates the StatementCache for the given database connection,
+		/// holding up to size statements. A size of 0 disables caching.
+
+	~StatementCache();
+		/// Destroys the StatementCache and finalizes all cached statements.
+
+	sqlite3_stmt* acquire(const std::string& sql, int& schemaGeneration);
+		/// Removes the prepared statement for the given SQL text from the
+		/// cache and returns it, or returns 0 if no (valid) statement is cached.
+		///
+		/// Stores the current schema generation (the number of schema
+		/// changes seen so far) in schemaGeneration, which must be passed
+		/// to release() if a statement is prepared after a cache miss.
+
+	void release(const std::string& sql, sqlite3_stmt* pStmt, int schemaGeneration);
+		/// Resets the given statement, clears its bindings and adds it to the
+		/// cache, or finalizes it if caching is disabled or the cache has
+		/// been closed. schemaGeneration must be the schema generation obtained
+		/// from acquire() before the statement has been prepared.
+		///
+		/// If the schema generation has changed in the meantime, the
+		/// statement is finalized instead, and the schema generation is
+		/// incremented again, as the schema may have been changed only
+		/// when the statement was executed.
+
+	void clear();
+		/// Finalizes all cached statements and increments the schema
+		/// generation.
+
+	void close();
+		/// Finalizes all cached statements and disables the cache.
+		/// Must be called before the database connection is closed.
+
+	void setSize(std::size_t size);
+		/// Sets the maximum number of cached statements.
+
+	std::size_t getSize() const;
+		/// Returns the maximum number of cached statements.
+
+	std::size_t count() const;
+		/// Returns the number of cached statements.
+
+	std::size_t hits() const;
+		/// Returns the number of calls to acquire() that returned a statement.
+
+	std::size_t misses() const;
+		/// Returns the number of calls to acquire() that returned 0.
+
+private:
+	StatementCache();
+	StatementCache(const StatementCache&);
+	StatementCache& operator = (const StatementCache&);
+
+	struct Entry
+	{
+		sqlite3_stmt* pStmt;
+		int schemaGeneration;
+		std::list<std::string>::iterator lruIt;
+	};
+
+	typedef std::map<std::string, Entry> EntryMap;
+	typedef std::list<std::string> LRUList;
+
+	void evict(std::size_t size);
+	static int authorize(void* pCache, int action, const char* p1, const char* p2, const char* p3, const char* p4);
+
+	sqlite3*          _pDB;
+	int               _schemaGeneration;
+	std::size_t       _size;
+	std::size_t       _hits;
+	std::size_t       _misses;
+	EntryMap          _entries;
+	LRUList           _lru;
+	mutable FastMutex _mutex;
+};
+
+
+} } } // namespace Poco::Data::SQLite
+
+
+#endif // Data_SQLite_StatementCache_INCLUDED
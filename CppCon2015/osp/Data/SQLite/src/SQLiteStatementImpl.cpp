@@ -35,10 +35,12 @@ namespace SQLite {
 const int SQLiteStatementImpl::POCO_SQLITE_INV_ROW_CNT = -1;
 
 
-SQLiteStatementImpl::SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB):
+SQLiteStatementImpl::SQLiteStatementImpl(Poco::Data::SessionImpl& rSession, sqlite3* pDB, StatementCache::Ptr pCache):
 	StatementImpl(rSession),
 	_pDB(pDB),
 	_pStmt(0),
+	_pCache(pCache),
+	_schemaGeneration(0),
 	_stepCalled(false),
 	_nextResponse(0),
 	_affectedRowCount(POCO_SQLITE_INV_ROW_CNT),
@@ -78,11 +80,21 @@ void SQLiteStatementImpl::compileImpl()
 	if (0 == std::strlen(pSql))
 		throw InvalidSQLStatementException("Empty statements are illegal");
 
+	std::string cacheKey;
+	if (_pCache && !_pLeftover)
+	{
+		// Return the current statement to the cache first,
+		// so that it can be reused when the statement is re-executed.
+		clear();
+		pStmt = _pCache->acquire(statement, _schemaGeneration);
+		if (pStmt) cacheKey = statement;
+	}
+
 	int rc = SQLITE_OK;
-	const char* pLeftover = 0;
-	bool queryFound = false;
+	const char* pLeftover = "";
+	bool queryFound = pStmt != 0;
 
-	do
+	while (!queryFound)
 	{
 		rc = sqlite3_prepare_v2(_pDB, pSql, -1, &pStmt, &pLeftover);
 		if (rc != SQLITE_OK)
@@ -106,15 +118,17 @@ void SQLiteStatementImpl::compileImpl()
 				queryFound = true;
 			}
 		}
-	} while (rc == SQLITE_OK && !pStmt && !queryFound);
+	}
 
 	//Finalization call in clear() invalidates the pointer, so the value is remembered here.
 	//For last statement in a batch (or a single statement), pLeftover == "", so the next call
 	// to compileImpl() shall return false immediately when there are no more statements left.
 	std::string leftOver(pLeftover);
 	trimInPlace(leftOver);
+	if (_pCache && !_pLeftover && pStmt && leftOver.empty()) cacheKey = statement;
 	clear();
 	_pStmt = pStmt;
+	_cacheKey = cacheKey;
 	if (!leftOver.empty())
 	{
 		_pLeftover = new std::string(leftOver);
@@ -219,9 +233,13 @@ void SQLiteStatementImpl::clear()
 
 	if (_pStmt)
 	{
-		sqlite3_finalize(_pStmt);
+		if (!_cacheKey.empty())
+			_pCache->release(_cacheKey, _pStmt, _schemaGeneration);
+		else
+			sqlite3_finalize(_pStmt);
 		_pStmt=0;
 	}
+	_cacheKey.clear();
 	_pLeftover = 0;
 }
 
@@ -247,7 +265,12 @@ bool SQLiteStatementImpl::hasNext()
 		_affectedRowCount += sqlite3_changes(_pDB);
 
 	if (_nextResponse != SQLITE_ROW && _nextResponse != SQLITE_OK && _nextResponse != SQLITE_DONE)
+	{
+		// SQLite could not re-prepare the statement after a schema change,
+		// so other cached statements are likely outdated as well.
+		if (_nextResponse == SQLITE_SCHEMA && _pCache) _pCache->clear();
 		Utility::throwException(_nextResponse);
+	}
 
 	_pExtractor->reset();//clear the cached null indicators
 
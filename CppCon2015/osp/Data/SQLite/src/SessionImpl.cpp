@@ -52,7 +52,8 @@ SessionImpl::SessionImpl(const std::string& fileName, std::size_t loginTimeout):
 	_connector(Connector::KEY),
 	_pDB(0),
 	_connected(false),
-	_isTransaction(false)
+	_isTransaction(false),
+	_statementCacheSize(StatementCache::DEFAULT_SIZE)
 {
 	open();
 	setConnectionTimeout(CONNECTION_TIMEOUT_DEFAULT);
@@ -61,6 +62,9 @@ SessionImpl::SessionImpl(const std::string& fileName, std::size_t loginTimeout):
 		&SessionImpl::autoCommit, 
 		&SessionImpl::isAutoCommit);
 	addProperty("connectionTimeout", &SessionImpl::setConnectionTimeout, &SessionImpl::getConnectionTimeout);
+	addProperty("statementCacheSize", &SessionImpl::setStatementCacheSize, &SessionImpl::getStatementCacheSize);
+	addProperty("statementCacheHits", 0, &SessionImpl::getStatementCacheHits);
+	addProperty("statementCacheMisses", 0, &SessionImpl::getStatementCacheMisses);
 }
 
 
@@ -80,14 +84,14 @@ SessionImpl::~SessionImpl()
 Poco::Data::StatementImpl* SessionImpl::createStatementImpl()
 {
 	poco_check_ptr (_pDB);
-	return new SQLiteStatementImpl(*this, _pDB);
+	return new SQLiteStatementImpl(*this, _pDB, _pStatementCache);
 }
 
 
 void SessionImpl::begin()
 {
 	Poco::Mutex::ScopedLock l(_mutex);
-	SQLiteStatementImpl tmp(*this, _pDB);
+	SQLiteStatementImpl tmp(*this, _pDB, _pStatementCache);
 	tmp.add(DEFERRED_BEGIN_TRANSACTION);
 	tmp.execute();
 	_isTransaction = true;
@@ -97,7 +101,7 @@ void SessionImpl::begin()
 void SessionImpl::commit()
 {
 	Poco::Mutex::ScopedLock l(_mutex);
-	SQLiteStatementImpl tmp(*this, _pDB);
+	SQLiteStatementImpl tmp(*this, _pDB, _pStatementCache);
 	tmp.add(COMMIT_TRANSACTION);
 	tmp.execute();
 	_isTransaction = false;
@@ -107,7 +111,7 @@ void SessionImpl::commit()
 void SessionImpl::rollback()
 {
 	Poco::Mutex::ScopedLock l(_mutex);
-	SQLiteStatementImpl tmp(*this, _pDB);
+	SQLiteStatementImpl tmp(*this, _pDB, _pStatementCache);
 	tmp.add(ABORT_TRANSACTION);
 	tmp.execute();
 	_isTransaction = false;
@@ -199,12 +203,19 @@ void SessionImpl::open(const std::string& connect)
 		throw ConnectionFailedException(ex.displayText());
 	}
 
+	_pStatementCache = new StatementCache(_pDB, _statementCacheSize);
 	_connected = true;
 }
 
 
 void SessionImpl::close()
 {
+	if (_pStatementCache)
+	{
+		_pStatementCache->close();
+		_pStatementCache = 0;
+	}
+
 	if (_pDB)
 	{
 		sqlite3_close(_pDB);
@@ -242,6 +253,31 @@ Poco::Any SessionImpl::getConnectionTimeout(const std::string& prop)
 }
 
 
+void SessionImpl::setStatementCacheSize(const std::string& prop, const Poco::Any& value)
+{
+	_statementCacheSize = Poco::RefAnyCast<std::size_t>(value);
+	if (_pStatementCache) _pStatementCache->setSize(_statementCacheSize);
+}
+
+
+Poco::Any SessionImpl::getStatementCacheSize(const std::string& prop)
+{
+	return Poco::Any(_statementCacheSize);
+}
+
+
+Poco::Any SessionImpl::getStatementCacheHits(const std::string& prop)
+{
+	return Poco::Any(_pStatementCache ? _pStatementCache->hits() : std::size_t(0));
+}
+
+
+Poco::Any SessionImpl::getStatementCacheMisses(const std::string& prop)
+{
+	return Poco::Any(_pStatementCache ? _pStatementCache->misses() : std::size_t(0));
+}
+
+
 void SessionImpl::autoCommit(const std::string&, bool)
 {
 	// The problem here is to decide whether to call commit or rollback
@@ -0,0 +1,238 @@
+//
+// StatementCache.cpp
+//
+// $Id$
+//
+// Library: SQLite
+// Package: SQLite
+// Module:  StatementCache
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/SQLite/StatementCache.h"
+#include "Poco/Data/SQLite/Utility.h"
+#if defined(POCO_UNBUNDLED)
+#include <sqlite3.h>
+#else
+#include "sqlite3.h"
+#endif
+
+
+namespace Poco {
+namespace Data {
+namespace SQLite {
+
+
+StatementCache::StatementCache(sqlite3* pDB, std::size_t size):
+	_pDB(pDB),
+	_schemaGeneration(0),
+	_size(size),
+	_hits(0),
+	_misses(0)
+{
+	poco_check_ptr (_pDB);
+
+	int rc = sqlite3_set_authorizer(_pDB, &StatementCache::authorize, this);
+	if (rc != SQLITE_OK) Utility::throwException(rc);
+}
+
+
+StatementCache::~StatementCache()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+sqlite3_stmt* StatementCache::acquire(const std::string& sql, int& schemaGeneration)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	schemaGeneration = _schemaGeneration;
+	EntryMap::iterator it = _entries.find(sql);
+	if (it != _entries.end())
+	{
+		if (it->second.schemaGeneration == schemaGeneration)
+		{
+			sqlite3_stmt* pStmt = it->second.pStmt;
+			_lru.erase(it->second.lruIt);
+			_entries.erase(it);
+			++_hits;
+			return pStmt;
+		}
+		// all cached statements have been prepared for an outdated schema
+		evict(0);
+	}
+	++_misses;
+	return 0;
+}
+
+
+void StatementCache::release(const std::string& sql, sqlite3_stmt* pStmt, int schemaGeneration)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (schemaGeneration != _schemaGeneration)
+	{
+		// The statement may have changed the schema itself, or may have
+		// been prepared for an outdated schema. Also, the schema may have
+		// been changed only now, by executing a statement prepared before.
+		++_schemaGeneration;
+		sqlite3_finalize(pStmt);
+		return;
+	}
+
+	if (_size == 0 || !_pDB)
+	{
+		sqlite3_finalize(pStmt);
+		return;
+	}
+
+	sqlite3_reset(pStmt);
+	sqlite3_clear_bindings(pStmt);
+
+	EntryMap::iterator it = _entries.find(sql);
+	if (it != _entries.end())
+	{
+		// another statement with the same SQL text has been returned
+		// to the cache in the meantime
+		sqlite3_finalize(it->second.pStmt);
+		_lru.erase(it->second.lruIt);
+		_entries.erase(it);
+	}
+	evict(_size - 1);
+
+	Entry entry;
+	entry.pStmt = pStmt;
+	entry.schemaGeneration = schemaGeneration;
+	entry.lruIt = _lru.insert(_lru.end(), sql);
+	_entries[sql] = entry;
+}
+
+
+void StatementCache::clear()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	++_schemaGeneration;
+	evict(0);
+}
+
+
+void StatementCache::close()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	evict(0);
+	if (_pDB)
+	{
+		sqlite3_set_authorizer(_pDB, 0, 0);
+		_pDB = 0;
+	}
+}
+
+
+void StatementCache::setSize(std::size_t size)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_size = size;
+	evict(_size);
+}
+
+
+std::size_t StatementCache::getSize() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _size;
+}
+
+
+std::size_t StatementCache::count() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _entries.size();
+}
+
+
+std::size_t StatementCache::hits() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _hits;
+}
+
+
+std::size_t StatementCache::misses() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _misses;
+}
+
+
+int StatementCache::authorize(void* pCache, int action, const char*, const char*, const char*, const char*)
+{
+	switch (action)
+	{
+	case SQLITE_CREATE_INDEX:
+	case SQLITE_CREATE_TABLE:
+	case SQLITE_CREATE_TEMP_INDEX:
+	case SQLITE_CREATE_TEMP_TABLE:
+	case SQLITE_CREATE_TEMP_TRIGGER:
+	case SQLITE_CREATE_TEMP_VIEW:
+	case SQLITE_CREATE_TRIGGER:
+	case SQLITE_CREATE_VIEW:
+	case SQLITE_CREATE_VTABLE:
+	case SQLITE_DROP_INDEX:
+	case SQLITE_DROP_TABLE:
+	case SQLITE_DROP_TEMP_INDEX:
+	case SQLITE_DROP_TEMP_TABLE:
+	case SQLITE_DROP_TEMP_TRIGGER:
+	case SQLITE_DROP_TEMP_VIEW:
+	case SQLITE_DROP_TRIGGER:
+	case SQLITE_DROP_VIEW:
+	case SQLITE_DROP_VTABLE:
+	case SQLITE_ALTER_TABLE:
+	case SQLITE_ATTACH:
+	case SQLITE_DETACH:
+		{
+			StatementCache* pThis = reinterpret_cast<StatementCache*>(pCache);
+			FastMutex::ScopedLock lock(pThis->_mutex);
+			++pThis->_schemaGeneration;
+		}
+		break;
+	default:
+		break;
+	}
+	return SQLITE_OK;
+}
+
+
+void StatementCache::evict(std::size_t size)
+{
+	while (_entries.size() > size)
+	{
+		EntryMap::iterator it = _entries.find(_lru.front());
+		poco_assert_dbg (it != _entries.end());
+		sqlite3_finalize(it->second.pStmt);
+		_entries.erase(it);
+		_lru.pop_front();
+	}
+}
+
+
+} } } // namespace Poco::Data::SQLite
@@ -18,6 +18,7 @@
 #include "Poco/Data/LOB.h"
 #include "Poco/Data/Statement.h"
 #include "Poco/Data/RecordSet.h"
+#include "Poco/Data/RecordCursor.h"
 #include "Poco/Data/SQLChannel.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/SQLite/Connector.h"
@@ -41,6 +42,7 @@
 #include "Poco/Exception.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/Stopwatch.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/Delegate.h"
 #include <iostream>
 
@@ -49,6 +51,8 @@ using namespace Poco::Data::Keywords;
 using Poco::Data::Session;
 using Poco::Data::Statement;
 using Poco::Data::RecordSet;
+using Poco::Data::RecordCursor;
+using Poco::Data::MetaColumn;
 using Poco::Data::Column;
 using Poco::Data::Row;
 using Poco::Data::SQLChannel;
@@ -77,6 +81,7 @@ using Poco::InvalidAccessException;
 using Poco::RangeException;
 using Poco::BadCastException;
 using Poco::NotFoundException;
+using Poco::InvalidArgumentException;
 using Poco::NullPointerException;
 using Poco::TimeoutException;
 using Poco::NotImplementedException;
@@ -2167,6 +2172,165 @@ void SQLiteTest::testRowIterator()
 }
 
 
+void SQLiteTest::testRecordCursor()
+{
+	Session ses (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	ses << "DROP TABLE IF EXISTS Cursor", now;
+	ses << "CREATE TABLE Cursor (i INTEGER, r REAL, s VARCHAR)", now;
+
+	const int rowCount = 2500;
+	std::vector<int> ints;
+	std::vector<double> reals;
+	std::vector<std::string> strings;
+	for (int i = 0; i < rowCount; ++i)
+	{
+		ints.push_back(i);
+		reals.push_back(i*0.5);
+		strings.push_back(Poco::NumberFormatter::format(i));
+	}
+	ses << "INSERT INTO Cursor VALUES (?,?,?)", use(ints), use(reals), use(strings), now;
+
+	RecordCursor cursor(ses, "SELECT * FROM Cursor ORDER BY i", 1000);
+	assert (cursor.chunkSize() == 1000);
+	int expected = 0;
+	int chunks = 0;
+	while (cursor.fetch())
+	{
+		++chunks;
+		assert (cursor.columnCount() == 3);
+		assert (cursor.columnName(2) == "s");
+		assert (cursor.columnType(0) == MetaColumn::FDT_INT32);
+		const Column<std::vector<Int32> >& i = cursor.column<Int32>(0);
+		const Column<std::vector<double> >& r = cursor.column<double>("r");
+		const std::vector<std::string>& s = cursor.column<std::string>(2).data();
+		assert (i.rowCount() == cursor.rowCount());
+		assert (s.size() == cursor.rowCount());
+
+		const Int32* pI = &i.data()[0];
+		for (std::size_t row = 0; row < cursor.rowCount(); ++row, ++expected)
+		{
+			assert (pI[row] == expected);
+			assert (r[row] == expected*0.5);
+			assert (s[row] == Poco::NumberFormatter::format(expected));
+			assert (cursor.value(0, row) == expected);
+		}
+	}
+	assert (chunks == 3);
+	assert (expected == rowCount);
+	assert (cursor.fetchedRowCount() == rowCount);
+	assert (cursor.rowCount() == 0);
+	assert (cursor.eof());
+	assert (!cursor.fetch());
+
+	try
+	{
+		cursor.column<std::string>(0);
+		fail ("must fail");
+	}
+	catch (BadCastException&) { }
+
+	Statement stmt = (ses << "SELECT s FROM Cursor WHERE i >= ?", use(ints[2000]));
+	RecordCursor boundCursor(stmt, 300);
+	std::size_t rows = 0;
+	while (boundCursor.fetch())
+	{
+		assert (boundCursor.rowCount() <= 300);
+		rows += boundCursor.rowCount();
+	}
+	assert (rows == 500);
+
+	Statement executed = (ses << "SELECT * FROM Cursor", now);
+	try
+	{
+		RecordCursor invalid(executed);
+		fail ("must fail");
+	}
+	catch (InvalidArgumentException&) { }
+
+	ses << "INSERT INTO Cursor VALUES (-1, NULL, NULL)", now;
+	RecordCursor nullCursor(ses, "SELECT * FROM Cursor WHERE r IS NULL");
+	assert (nullCursor.fetch());
+	assert (nullCursor.rowCount() == 1);
+	assert (!nullCursor.isNull(0, 0));
+	assert (nullCursor.isNull(1, 0));
+	assert (nullCursor.value(0, 0) == -1);
+	assert (nullCursor.value(2, 0).isEmpty());
+
+	std::ostringstream osCursor;
+	RecordCursor copyCursor(ses, "SELECT * FROM Cursor ORDER BY i", 100);
+	osCursor << copyCursor;
+	assert (copyCursor.fetchedRowCount() == rowCount + 1);
+
+	std::ostringstream osRecordSet;
+	RecordSet rset(ses, "SELECT * FROM Cursor ORDER BY i");
+	osRecordSet << rset;
+	assert (!osCursor.str().empty());
+	assert (osCursor.str() == osRecordSet.str());
+}
+
+
+void SQLiteTest::testStatementCache()
+{
+	Session ses (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	ses << "DROP TABLE IF EXISTS Cache", now;
+	ses << "CREATE TABLE Cache (i INTEGER)", now;
+	for (int i = 0; i < 10; ++i)
+		ses << "INSERT INTO Cache VALUES (?)", use(i), now;
+
+	std::size_t hits = AnyCast<std::size_t>(ses.getProperty("statementCacheHits"));
+	std::size_t misses = AnyCast<std::size_t>(ses.getProperty("statementCacheMisses"));
+	assert (hits >= 9);
+	assert (misses >= 1);
+
+	int count = 0;
+	for (int i = 0; i < 10; ++i)
+	{
+		int value = -1;
+		ses << "SELECT i FROM Cache WHERE i = ?", use(i), into(value), now;
+		assert (value == i);
+		ses << "SELECT COUNT(*) FROM Cache", into(count), now;
+		assert (count == 10);
+	}
+	assert (AnyCast<std::size_t>(ses.getProperty("statementCacheHits")) == hits + 18);
+	assert (AnyCast<std::size_t>(ses.getProperty("statementCacheMisses")) == misses + 2);
+
+	// re-executing a statement reuses its prepared statement
+	int value = 0;
+	Statement stmt = (ses << "SELECT i FROM Cache WHERE i = ?", use(value), into(count));
+	stmt.execute();
+	value = 5;
+	stmt.execute();
+	assert (count == 5);
+
+	// a schema change invalidates cached statements
+	RecordSet rs1(ses, "SELECT * FROM Cache");
+	assert (rs1.columnCount() == 1);
+	ses << "DROP TABLE Cache", now;
+	ses << "CREATE TABLE Cache (i INTEGER, s VARCHAR)", now;
+	ses << "INSERT INTO Cache VALUES (1, 'one')", now;
+	RecordSet rs2(ses, "SELECT * FROM Cache");
+	assert (rs2.columnCount() == 2);
+	assert (rs2.value<std::string>(1, 0) == "one");
+
+	// statements changing the schema are never cached
+	hits = AnyCast<std::size_t>(ses.getProperty("statementCacheHits"));
+	for (int i = 0; i < 3; ++i)
+	{
+		ses << "CREATE TABLE CacheDDL (i INTEGER)", now;
+		ses << "DROP TABLE CacheDDL", now;
+	}
+	assert (AnyCast<std::size_t>(ses.getProperty("statementCacheHits")) == hits);
+
+	ses.setProperty("statementCacheSize", std::size_t(0));
+	assert (AnyCast<std::size_t>(ses.getProperty("statementCacheSize")) == 0);
+	hits = AnyCast<std::size_t>(ses.getProperty("statementCacheHits"));
+	for (int i = 0; i < 3; ++i)
+		ses << "SELECT COUNT(*) FROM Cache", into(count), now;
+	assert (count == 1);
+	assert (AnyCast<std::size_t>(ses.getProperty("statementCacheHits")) == hits);
+}
+
+
 void SQLiteTest::testAsync()
 {
 	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -2452,6 +2616,82 @@ void SQLiteTest::testSQLLogger()
 }
 
 
+void SQLiteTest::testSQLChannelBatch()
+{
+	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	tmp << "DROP TABLE IF EXISTS T_POCO_LOG", now;
+	tmp << "CREATE TABLE T_POCO_LOG (Source VARCHAR,"
+		"Name VARCHAR,"
+		"ProcessId INTEGER,"
+		"Thread VARCHAR, "
+		"ThreadId INTEGER," 
+		"Priority INTEGER,"
+		"Text VARCHAR,"
+		"DateTime DATE)", now;
+
+	AutoPtr<SQLChannel> pChannel = new SQLChannel(Poco::Data::SQLite::Connector::KEY, "dummy.db", "TestSQLChannel");
+	pChannel->setProperty("buffer", "64");
+	pChannel->setProperty("batch", "16");
+	pChannel->setProperty("latency", "50");
+	pChannel->setProperty("timeout", "0");
+	assert ("64" == pChannel->getProperty("buffer"));
+	assert ("16" == pChannel->getProperty("batch"));
+	assert ("50" == pChannel->getProperty("latency"));
+	assert ("block" == pChannel->getProperty("overflow"));
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		Message msg("BatchSource", Poco::format("Message %04d", i), Message::PRIO_INFORMATION);
+		pChannel->log(msg);
+	}
+	assert (1000 == pChannel->wait());
+
+	int count = 0;
+	tmp << "SELECT COUNT(*) FROM T_POCO_LOG", into(count), now;
+	assert (1000 == count);
+
+	RecordSet rs(tmp, "SELECT * FROM T_POCO_LOG ORDER by Text");
+	assert ("BatchSource" == rs["Source"]);
+	assert ("TestSQLChannel" == rs["Name"]);
+	assert ("Message 0000" == rs["Text"]);
+	rs.moveLast();
+	assert ("Message 0999" == rs["Text"]);
+
+	tmp << "DELETE FROM T_POCO_LOG", now;
+	pChannel->setProperty("buffer", "8");
+	pChannel->setProperty("latency", "1000");
+	// batch is larger than buffer, so the writer must not wait for 
+	// the latency to expire when the queue is full (all batches are full)
+	Poco::Stopwatch sw;
+	sw.start();
+	for (int i = 0; i < 96; ++i)
+	{
+		Message msg("BatchSource", Poco::format("Message %04d", i), Message::PRIO_INFORMATION);
+		pChannel->log(msg);
+	}
+	assert (96 == pChannel->wait());
+	sw.stop();
+	assert (sw.elapsed() < 1000000);
+
+	tmp << "SELECT COUNT(*) FROM T_POCO_LOG", into(count), now;
+	assert (96 == count);
+
+	tmp << "DELETE FROM T_POCO_LOG", now;
+	pChannel->setProperty("overflow", "drop");
+	// messages are logged faster than they are written, so the queue fills up
+	for (int i = 0; i < 100; ++i)
+	{
+		Message msg("BatchSource", Poco::format("Message %04d", i), Message::PRIO_INFORMATION);
+		pChannel->log(msg);
+	}
+	std::size_t written = pChannel->wait();
+	assert (written >= 8 && written < 100);
+
+	tmp << "SELECT COUNT(*) FROM T_POCO_LOG", into(count), now;
+	assert (written == count);
+}
+
+
 void SQLiteTest::testExternalBindingAndExtraction()
 {
 	AbstractExtractionVecVec extractionVec;
@@ -3437,11 +3677,14 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testNullable);
 	CppUnit_addTest(pSuite, SQLiteTest, testNulls);
 	CppUnit_addTest(pSuite, SQLiteTest, testRowIterator);
+	CppUnit_addTest(pSuite, SQLiteTest, testRecordCursor);
+	CppUnit_addTest(pSuite, SQLiteTest, testStatementCache);
 	CppUnit_addTest(pSuite, SQLiteTest, testAsync);
 	CppUnit_addTest(pSuite, SQLiteTest, testAny);
 	CppUnit_addTest(pSuite, SQLiteTest, testDynamicAny);
 	CppUnit_addTest(pSuite, SQLiteTest, testSQLChannel);
 	CppUnit_addTest(pSuite, SQLiteTest, testSQLLogger);
+	CppUnit_addTest(pSuite, SQLiteTest, testSQLChannelBatch);
 	CppUnit_addTest(pSuite, SQLiteTest, testExternalBindingAndExtraction);
 	CppUnit_addTest(pSuite, SQLiteTest, testBindingCount);
 	CppUnit_addTest(pSuite, SQLiteTest, testMultipleResults);
@@ -107,6 +107,8 @@ public:
 	void testNullable();
 	void testNulls();
 	void testRowIterator();
+	void testRecordCursor();
+	void testStatementCache();
 	void testAsync();
 
 	void testAny();
@@ -115,6 +117,7 @@ public:
 
 	void testSQLChannel();
 	void testSQLLogger();
+	void testSQLChannelBatch();
 
 	void testExternalBindingAndExtraction();
 	void testBindingCount();
@@ -0,0 +1,275 @@
+//
+// RecordCursor.h
+//
+// $Id$
+//
+// Library: Data
+// Package: DataCore
+// Module:  RecordCursor
+//
+// Definition of the RecordCursor class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_RecordCursor_INCLUDED
+#define Data_RecordCursor_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Data/Statement.h"
+#include "Poco/Data/Extraction.h"
+#include "Poco/Data/Column.h"
+#include "Poco/Data/RowFormatter.h"
+#include "Poco/Dynamic/Var.h"
+#include "Poco/Exception.h"
+#include "Poco/Format.h"
+#include <ostream>
+#include <vector>
+#include <typeinfo>
+
+
+namespace Poco {
+namespace Data {
+
+
+class Data_API RecordCursor: private Statement
+	/// RecordCursor provides forward-only, streaming access to
+	/// data returned from a query.
+	///
+	/// Unlike RecordSet, which keeps the complete result of a
+	/// query in memory, RecordCursor fetches the result in chunks
+	/// of a fixed number of rows (using a Limit), and only keeps
+	/// the current chunk in memory. Column values are stored in
+	/// std::vector containers (one per column), which can be
+	/// accessed directly via column(), without creating Row or
+	/// Poco::Dynamic::Var objects.
+	///
+	/// A RecordCursor is used as follows:
+	///
+	///     RecordCursor cursor(session, "SELECT Name, Age FROM Person", 10000);
+	///     while (cursor.fetch())
+	///     {
+	///         const Column<std::vector<std::string> >& names = cursor.column<std::string>(0);
+	///         const Column<std::vector<int> >& ages = cursor.column<int>(1);
+	///         for (std::size_t row = 0; row < cursor.rowCount(); ++row)
+	///         {
+	///             ...
+	///         }
+	///     }
+	///
+	/// The column type given to column() must match the type
+	/// of the internal storage for the column, which is determined
+	/// by the column's MetaColumn::ColumnDataType (e.g., Poco::Int32
+	/// for MetaColumn::FDT_INT32).
+	///
+	/// Column information is available after the first call to fetch().
+	///
+	/// The whole result can be written to a stream, formatted
+	/// with a RowFormatter, with copy(). Unlike with RecordSet,
+	/// the amount of memory needed for this does not depend on
+	/// the number of rows in the result, as long as the RowFormatter
+	/// operates in progressive mode.
+{
+public:
+	enum
+	{
+		DEFAULT_CHUNK_SIZE = 1024
+	};
+
+	RecordCursor(Session& rSession,
+		const std::string& query,
+		std::size_t chunkSize = DEFAULT_CHUNK_SIZE,
+		RowFormatter::Ptr pRowFormatter = 0);
+		/// Creates the RecordCursor for the given query.
+		/// The query is executed with the first call to fetch().
+
+	explicit RecordCursor(const Statement& rStatement,
+		std::size_t chunkSize = DEFAULT_CHUNK_SIZE,
+		RowFormatter::Ptr pRowFormatter = 0);
+		/// Creates the RecordCursor for the given Statement,
+		/// which can have bindings, but must not have been executed
+		/// yet and must not have extractions (into()). A limit set
+		/// for the Statement is replaced with the chunk size.
+		///
+		/// Throws an InvalidArgumentException if the Statement
+		/// cannot be used.
+
+	~RecordCursor();
+		/// Destroys the RecordCursor.
+
+	bool fetch();
+		/// Fetches the next chunk of up to chunkSize() rows,
+		/// replacing the current one.
+		///
+		/// Returns true if at least one row has been fetched, or
+		/// false if the end of the result has been reached.
+
+	std::size_t chunkSize() const;
+		/// Returns the maximum number of rows in a chunk.
+
+	std::size_t rowCount() const;
+		/// Returns the number of rows in the current chunk.
+
+	std::size_t fetchedRowCount() const;
+		/// Returns the total number of rows fetched so far.
+
+	bool eof() const;
+		/// Returns true if the end of the result has been reached.
+
+	std::size_t columnCount() const;
+		/// Returns the number of columns.
+
+	MetaColumn::ColumnDataType columnType(std::size_t pos) const;
+		/// Returns the type for the column at specified position.
+
+	const std::string& columnName(std::size_t pos) const;
+		/// Returns column name for the column at specified position.
+
+	std::size_t columnPosition(const std::string& name) const;
+		/// Returns the position of the column with the given name.
+
+	template <class T>
+	const Column<std::vector<T> >& column(std::size_t pos) const
+		/// Returns the column at the specified position, holding
+		/// the values of the current chunk.
+		///
+		/// The Column object remains valid for the lifetime of the
+		/// RecordCursor, but its contents are replaced with each
+		/// call to fetch(). The values are stored contiguously and
+		/// can be obtained with Column::data().
+		///
+		/// Throws a BadCastException if T does not match the
+		/// column's storage type.
+	{
+		typedef InternalExtraction<std::vector<T> > E;
+
+		const AbstractExtractionVec& rExtractions = extractions();
+		if (pos >= rExtractions.size())
+			throw RangeException(Poco::format("Invalid column index: %z", pos));
+
+		const E* pExtraction = dynamic_cast<const E*>(rExtractions[pos].get());
+		if (!pExtraction)
+		{
+			throw Poco::BadCastException(Poco::format("Type cast failed!\nColumn: %z\nTarget type:\t%s",
+				pos,
+				std::string(typeid(T).name())));
+		}
+		return pExtraction->column();
+	}
+
+	template <class T>
+	const Column<std::vector<T> >& column(const std::string& name) const
+		/// Returns the column with the specified name, holding
+		/// the values of the current chunk.
+	{
+		return column<T>(columnPosition(name));
+	}
+
+	bool isNull(std::size_t col, std::size_t row) const;
+		/// Returns true if the value in the given column and row
+		/// of the current chunk is null.
+
+	Poco::Dynamic::Var value(std::size_t col, std::size_t row) const;
+		/// Returns the value in the given column and row of the
+		/// current chunk. An empty Var is returned for null values.
+
+	void setRowFormatter(RowFormatter::Ptr pRowFormatter);
+		/// Assigns the row formatter used by copy().
+
+	std::ostream& copy(std::ostream& os);
+		/// Fetches all remaining rows of the result and writes them,
+		/// including the column names, to the given stream, formatted by
+		/// the row formatter. If no row formatter has been assigned,
+		/// a SimpleRowFormatter is used.
+		///
+		/// A single value vector is reused for all rows, and in
+		/// progressive mode, each row is written to the stream
+		/// as soon as it has been formatted.
+
+private:
+	RecordCursor();
+	RecordCursor(const RecordCursor&);
+	RecordCursor& operator = (const RecordCursor&);
+
+	void init(std::size_t chunkSize, RowFormatter::Ptr pRowFormatter);
+
+	std::size_t _chunkSize;
+	std::size_t _rowCount;
+	std::size_t _fetchedRowCount;
+	bool        _eof;
+};
+
+
+//
+// inlines
+//
+inline std::size_t RecordCursor::chunkSize() const
+{
+	return _chunkSize;
+}
+
+
+inline std::size_t RecordCursor::rowCount() const
+{
+	return _rowCount;
+}
+
+
+inline std::size_t RecordCursor::fetchedRowCount() const
+{
+	return _fetchedRowCount;
+}
+
+
+inline bool RecordCursor::eof() const
+{
+	return _eof;
+}
+
+
+inline std::size_t RecordCursor::columnCount() const
+{
+	return static_cast<std::size_t>(extractions().size());
+}
+
+
+inline MetaColumn::ColumnDataType RecordCursor::columnType(std::size_t pos) const
+{
+	return metaColumn(static_cast<UInt32>(pos)).type();
+}
+
+
+inline const std::string& RecordCursor::columnName(std::size_t pos) const
+{
+	return metaColumn(static_cast<UInt32>(pos)).name();
+}
+
+
+inline std::size_t RecordCursor::columnPosition(const std::string& name) const
+{
+	return metaColumn(name).position();
+}
+
+
+inline bool RecordCursor::isNull(std::size_t col, std::size_t row) const
+{
+	return Statement::isNull(col, row);
+}
+
+
+inline std::ostream& operator << (std::ostream &os, RecordCursor& cursor)
+{
+	return cursor.copy(os);
+}
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_RecordCursor_INCLUDED
@@ -29,13 +29,19 @@
 #include "Poco/Message.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/String.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Exception.h"
+#include <vector>
 
 
 namespace Poco {
 namespace Data {
 
 
-class Data_API SQLChannel: public Poco::Channel
+class Data_API SQLChannel: public Poco::Channel, public Poco::Runnable
 	/// This Channel implements logging to a SQL database.
 	/// The channel is dependent on the schema. The DDL for
 	/// table creation (subject to target DDL dialect dependent 
@@ -55,9 +61,17 @@ class Data_API SQLChannel: public Poco::Channel
 	/// field names are not mandated. However, it is recomended to use names as specified above.
 	/// 
 	/// To provide as non-intrusive operation as possbile, the log entries are cached and 
-	/// inserted into the target database asynchronously by default . The blocking, however, will occur 
-	/// before the next entry insertion with default timeout of 1 second. The default settings can be 
-	/// overriden (see async, timeout and throw properties for details).
+	/// inserted into the target database asynchronously by default. Messages are stored
+	/// in a ring buffer of fixed size, from which a background thread writes them to
+	/// the database in batches of up to a configurable number of messages, each batch
+	/// within a single transaction. If the session supports the "bulk" feature, bulk
+	/// binding is used for inserting a batch. The background thread starts writing
+	/// as soon as messages are available, or, if a maximum latency is configured,
+	/// when a batch is complete, the ring buffer is full, or the latency has expired.
+	///
+	/// If the ring buffer is full, the channel either drops the message or blocks until
+	/// space is available, with a default timeout of 1 second (see buffer, overflow,
+	/// timeout and throw properties for details).
 	/// If throw property is false, insertion timeouts are ignored, otherwise a TimeoutException is thrown.
 	/// To force insertion of every entry, set timeout to 0. This setting, however, introduces
 	/// a risk of long blocking periods in case of remote server communication delays.
@@ -105,17 +119,31 @@ public:
 		///                  set this property to empty string.
 		///
 		///     * async:     Indicates asynchronous execution. When excuting asynchronously,
-		///                  messages are sent to the target using asyncronous execution.
-		///                  However, prior to the next message being processed and sent to
-		///                  the target, the previous operation must have been either completed 
-		///                  or timed out (see timeout and throw properties for details on
-		///                  how abnormal conditos are handled).
+		///                  messages are queued and sent to the target in batches by a
+		///                  background thread. Defaults to true.
+		///
+		///     * buffer:    Capacity of the message queue (number of messages) for
+		///                  asynchronous execution. Defaults to 1024.
+		///
+		///     * batch:     Maximum number of messages inserted into the target at once
+		///                  (within a single transaction). Defaults to 100. A batch
+		///                  never contains more messages than the buffer can hold.
+		///
+		///     * latency:   Maximum time (ms) a message is held back to complete a batch.
+		///                  Defaults to 0, meaning that queued messages are inserted
+		///                  immediately. Larger values result in larger batches.
+		///
+		///     * overflow:  Policy for a full message queue. If "block" (the default), log()
+		///                  waits for free space in the queue (see timeout and throw properties
+		///                  for details). If "drop", the message is discarded.
 		///
-		///     * timeout:   Timeout (ms) to wait for previous log operation completion.
+		///     * timeout:   Timeout (ms) to wait for free space in the message queue, or
+		///                  for all queued messages to be written in wait().
 		///                  Values "0" and "" mean no timeout. Only valid when logging
 		///                  is asynchronous, otherwise ignored.
 		///
-		///     * throw:     Boolean value indicating whether to throw in case of timeout.
+		///     * throw:     Boolean value indicating whether to throw in case of timeout,
+		///                  or if writing queued messages to the target has failed.
 		///                  Setting this property to false may result in log entries being lost.
 		///                  True values are (case insensitive) "true", "t", "yes", "y".
 		///                  Anything else yields false.
@@ -124,8 +152,12 @@ public:
 		/// Returns the value of the property with the given name.
 
 	std::size_t wait();
-		/// Waits for the completion of the previous operation and returns
-		/// the result. If chanel is in synchronous mode, returns 0 immediately.
+		/// Waits until all queued messages have been written to the target
+		/// and returns the number of messages written since the previous
+		/// call to wait(). If chanel is in synchronous mode, returns 0 immediately.
+		///
+		/// If writing messages has failed in the meantime and the throw
+		/// property is true, the exception is rethrown.
 
 	static void registerChannel();
 		/// Registers the channel with the global LoggingFactory.
@@ -139,9 +171,14 @@ public:
 	static const std::string PROP_ASYNC;
 	static const std::string PROP_TIMEOUT;
 	static const std::string PROP_THROW;
+	static const std::string PROP_BUFFER;
+	static const std::string PROP_BATCH;
+	static const std::string PROP_LATENCY;
+	static const std::string PROP_OVERFLOW;
 
 protected:
 	~SQLChannel();
+	void run();
 
 private:
 	typedef Poco::SharedPtr<Session>         SessionPtr;
@@ -156,29 +193,55 @@ private:
 	/// Initiallizes the archive statement.
 
 	void logAsync(const Message& msg);
-		/// Waits for previous operation completion and
-		/// calls logSync(). If the previous operation times out,
-		/// and _throw is true, TimeoutException is thrown, oterwise
-		/// the timeout is ignored and log entry is lost.
+		/// Stores the message in the message queue, from which it is
+		/// inserted into the target database by the background thread.
+		/// If the queue is full, and overflow policy is "block", waits
+		/// for free space. If this times out, and _throw is true,
+		/// TimeoutException is thrown, oterwise the log entry is lost.
 
 	void logSync(const Message& msg);
 		/// Inserts the message in the target database.
 
+	void writeBatch(StrategyPtr pArchiveStrategy);
+		/// Inserts the messages in the batch vectors into the
+		/// target database, within a single transaction.
+
+	void startWriter();
+		/// Starts the background thread.
+
+	void stopWriter();
+		/// Writes all queued messages and stops the background thread.
+
 	bool isTrue(const std::string& value) const;
 		/// Returns true is value is "true", "t", "yes" or "y".
 		/// Case insensitive.
 
+	struct LogEntry
+	{
+		std::string source;
+		std::string name;
+		long        pid;
+		std::string thread;
+		long        tid;
+		int         priority;
+		std::string text;
+		DateTime    dateTime;
+	};
+
+	typedef std::vector<LogEntry> LogEntryVec;
+
 	std::string  _connector;
 	std::string  _connect;
 	SessionPtr   _pSession;
 	StatementPtr _pLogStatement;
 	std::string  _name;
 	std::string  _table;
+	std::string  _sql;
 	int          _timeout;
 	bool         _throw;
 	bool         _async;
 	
-	// members for log entry cache (needed for async mode)
+	// members for log entry cache (needed for sync mode)
 	std::string _source;
 	long        _pid;
 	std::string _thread;
@@ -187,6 +250,33 @@ private:
 	std::string _text;
 	DateTime    _dateTime;
 
+	// message queue (ring buffer) and background thread (needed for async mode)
+	LogEntryVec     _queue;
+	std::size_t     _head;
+	std::size_t     _count;
+	std::size_t     _batchSize;
+	long            _latency;
+	bool            _drop;
+	bool            _running;
+	bool            _stop;
+	bool            _writing;
+	std::size_t     _written;
+	Exception*      _pError;
+	Poco::Thread    _writer;
+	Poco::FastMutex _mutex;
+	Poco::Condition _ready;
+	Poco::Condition _done;
+
+	// batch of messages being inserted by the background thread
+	std::vector<std::string> _sources;
+	std::vector<std::string> _names;
+	std::vector<long>        _pids;
+	std::vector<std::string> _threads;
+	std::vector<long>        _tids;
+	std::vector<int>         _priorities;
+	std::vector<std::string> _texts;
+	std::vector<DateTime>    _dateTimes;
+
 	StrategyPtr _pArchiveStrategy;
 };
 
@@ -195,15 +285,6 @@ private:
 // inlines
 //
 
-inline std::size_t SQLChannel::wait()
-{
-	if (_async && _pLogStatement) 
-		return _pLogStatement->wait(_timeout);
-	
-	return 0;
-}
-
-
 inline bool SQLChannel::isTrue(const std::string& value) const
 {
 	return ((0 == icompare(value, "true")) ||
@@ -18,6 +18,7 @@
 #include "Poco/Data/Session.h"
 #include "Poco/Data/Statement.h"
 #include "Poco/Data/RecordSet.h"
+#include "Poco/Data/RecordCursor.h"
 #include "Poco/Data/RowFormatter.h"
 #include "Poco/Data/SQLite/Connector.h"
 #include <iostream>
@@ -28,6 +29,7 @@ using Poco::DateTime;
 using Poco::Data::Session;
 using Poco::Data::Statement;
 using Poco::Data::RecordSet;
+using Poco::Data::RecordCursor;
 using Poco::Data::RowFormatter;
 
 
@@ -119,5 +121,11 @@ int main(int argc, char** argv)
 	std::cout << std::endl << "Simple formatting:" << std::endl << std::endl;
 	std::cout << RecordSet(session, "SELECT * FROM Simpsons");
 
+	// streaming example; rows are fetched and formatted in chunks of two rows,
+	// so that results of any size can be exported in constant memory
+	std::cout << std::endl << "Streaming:" << std::endl << std::endl;
+	RecordCursor cursor(session, "SELECT * FROM Simpsons", 2, new HTMLTableFormatter);
+	std::cout << cursor;
+
 	return 0;
 }
@@ -47,6 +47,7 @@ using Poco::NullPointerException;
 using Poco::Net::ServerSocket;
 using Poco::Net::WebSocket;
 using Poco::Net::WebSocketException;
+using Poco::Net::PerMessageDeflate;
 using Poco::Net::HTTPRequestHandler;
 using Poco::Net::HTTPRequestHandlerFactory;
 using Poco::Net::HTTPServer;
@@ -120,7 +121,8 @@ public:
 		{
 			if (!_pWS)
 			{
-				_pWS = new WebSocket(request, response);
+				// Compress the rows sent to the browser, if supported.
+				_pWS = new WebSocket(request, response, PerMessageDeflate::Params());
 				Timespan ts(600, 0);
 				_pWS->setReceiveTimeout(ts);
 				_pWS->setSendTimeout(ts);
@@ -0,0 +1,188 @@
+//
+// RecordCursor.cpp
+//
+// $Id$
+//
+// Library: Data
+// Package: DataCore
+// Module:  RecordCursor
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/RecordCursor.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/DateTime.h"
+#include "Poco/UTFString.h"
+
+
+using namespace Poco::Data::Keywords;
+using Poco::DateTime;
+using Poco::UTF16String;
+
+
+namespace Poco {
+namespace Data {
+
+
+namespace
+{
+	template <class T>
+	Poco::Dynamic::Var columnValue(const RecordCursor& cursor, std::size_t col, std::size_t row)
+	{
+		return cursor.column<T>(col).value(row);
+	}
+}
+
+
+RecordCursor::RecordCursor(Session& rSession,
+	const std::string& query,
+	std::size_t chunkSize,
+	RowFormatter::Ptr pRowFormatter):
+	Statement((rSession << query)),
+	_chunkSize(chunkSize),
+	_rowCount(0),
+	_fetchedRowCount(0),
+	_eof(false)
+{
+	init(chunkSize, pRowFormatter);
+}
+
+
+RecordCursor::RecordCursor(const Statement& rStatement,
+	std::size_t chunkSize,
+	RowFormatter::Ptr pRowFormatter):
+	Statement(rStatement),
+	_chunkSize(chunkSize),
+	_rowCount(0),
+	_fetchedRowCount(0),
+	_eof(false)
+{
+	if (!initialized() || extractionCount() > 0)
+		throw InvalidArgumentException("RecordCursor requires an unexecuted statement without extractions.");
+	if (isAsync())
+		throw InvalidArgumentException("RecordCursor requires a synchronous statement.");
+
+	init(chunkSize, pRowFormatter);
+}
+
+
+RecordCursor::~RecordCursor()
+{
+}
+
+
+void RecordCursor::init(std::size_t chunkSize, RowFormatter::Ptr pRowFormatter)
+{
+	if (chunkSize == 0 || chunkSize >= Limit::LIMIT_UNLIMITED)
+		throw InvalidArgumentException("Invalid chunk size.");
+
+	vector(*this);
+	Statement::operator , (limit(static_cast<Limit::SizeT>(chunkSize)));
+	if (pRowFormatter) setRowFormatter(pRowFormatter);
+}
+
+
+bool RecordCursor::fetch()
+{
+	if (_eof) return false;
+
+	if (initialized() || paused())
+	{
+		execute();
+		_rowCount = rowsExtracted();
+	}
+	else _rowCount = 0;
+
+	if (_rowCount == 0)
+	{
+		_eof = true;
+		return false;
+	}
+	_fetchedRowCount += _rowCount;
+	return true;
+}
+
+
+Poco::Dynamic::Var RecordCursor::value(std::size_t col, std::size_t row) const
+{
+	if (isNull(col, row)) return Poco::Dynamic::Var();
+
+	switch (columnType(col))
+	{
+		case MetaColumn::FDT_BOOL:      return columnValue<bool>(*this, col, row);
+		case MetaColumn::FDT_INT8:      return columnValue<Int8>(*this, col, row);
+		case MetaColumn::FDT_UINT8:     return columnValue<UInt8>(*this, col, row);
+		case MetaColumn::FDT_INT16:     return columnValue<Int16>(*this, col, row);
+		case MetaColumn::FDT_UINT16:    return columnValue<UInt16>(*this, col, row);
+		case MetaColumn::FDT_INT32:     return columnValue<Int32>(*this, col, row);
+		case MetaColumn::FDT_UINT32:    return columnValue<UInt32>(*this, col, row);
+		case MetaColumn::FDT_INT64:     return columnValue<Int64>(*this, col, row);
+		case MetaColumn::FDT_UINT64:    return columnValue<UInt64>(*this, col, row);
+		case MetaColumn::FDT_FLOAT:     return columnValue<float>(*this, col, row);
+		case MetaColumn::FDT_DOUBLE:    return columnValue<double>(*this, col, row);
+		case MetaColumn::FDT_STRING:    return columnValue<std::string>(*this, col, row);
+		case MetaColumn::FDT_WSTRING:   return columnValue<UTF16String>(*this, col, row);
+		case MetaColumn::FDT_BLOB:      return columnValue<BLOB>(*this, col, row);
+		case MetaColumn::FDT_CLOB:      return columnValue<CLOB>(*this, col, row);
+		case MetaColumn::FDT_DATE:      return columnValue<Date>(*this, col, row);
+		case MetaColumn::FDT_TIME:      return columnValue<Time>(*this, col, row);
+		case MetaColumn::FDT_TIMESTAMP: return columnValue<DateTime>(*this, col, row);
+		default:
+			throw UnknownTypeException("Data type not supported.");
+	}
+}
+
+
+void RecordCursor::setRowFormatter(RowFormatter::Ptr pRowFormatter)
+{
+	pRowFormatter->setTotalRowCount(RowFormatter::INVALID_ROW_COUNT);
+	Statement::setRowFormatter(pRowFormatter);
+}
+
+
+std::ostream& RecordCursor::copy(std::ostream& os)
+{
+	RowFormatter& rf = const_cast<RowFormatter&>(*getRowFormatter());
+	bool progressive = RowFormatter::FORMAT_PROGRESSIVE == rf.getMode();
+	RowFormatter::NameVecPtr pNames;
+	RowFormatter::ValueVec values;
+	std::string str;
+
+	if (progressive) os << rf.prefix();
+	while (fetch())
+	{
+		std::size_t cols = columnCount();
+		if (!pNames)
+		{
+			pNames = new RowFormatter::NameVec;
+			for (std::size_t col = 0; col < cols; ++col)
+				pNames->push_back(columnName(col));
+			values.resize(cols);
+
+			if (progressive) os << rf.formatNames(pNames, str);
+			else rf.formatNames(pNames);
+		}
+		for (std::size_t row = 0; row < _rowCount; ++row)
+		{
+			for (std::size_t col = 0; col < cols; ++col)
+				values[col] = value(col, row);
+
+			if (progressive) os << rf.formatValues(values, str);
+			else rf.formatValues(values);
+		}
+	}
+	if (progressive) os << rf.postfix();
+	else os << rf.toString();
+
+	return os;
+}
+
+
+} } // namespace Poco::Data
@@ -16,12 +16,15 @@
 
 #include "Poco/Data/SQLChannel.h"
 #include "Poco/Data/SessionFactory.h"
+#include "Poco/Data/BulkBinding.h"
+#include "Poco/Data/Transaction.h"
 #include "Poco/DateTime.h"
 #include "Poco/LoggingFactory.h"
 #include "Poco/Instantiator.h"
 #include "Poco/NumberParser.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Format.h"
+#include "Poco/ScopedUnlock.h"
 
 
 namespace Poco {
@@ -40,6 +43,10 @@ const std::string SQLChannel::PROP_MAX_AGE("keep");
 const std::string SQLChannel::PROP_ASYNC("async");
 const std::string SQLChannel::PROP_TIMEOUT("timeout");
 const std::string SQLChannel::PROP_THROW("throw");
+const std::string SQLChannel::PROP_BUFFER("buffer");
+const std::string SQLChannel::PROP_BATCH("batch");
+const std::string SQLChannel::PROP_LATENCY("latency");
+const std::string SQLChannel::PROP_OVERFLOW("overflow");
 
 
 SQLChannel::SQLChannel():
@@ -47,7 +54,19 @@ SQLChannel::SQLChannel():
 	_table("T_POCO_LOG"),
 	_timeout(1000),
 	_throw(true),
-	_async(true)
+	_async(true),
+	_queue(1024),
+	_head(0),
+	_count(0),
+	_batchSize(100),
+	_latency(0),
+	_drop(false),
+	_running(false),
+	_stop(false),
+	_writing(false),
+	_written(0),
+	_pError(0),
+	_writer("SQLChannel")
 {
 }
 
@@ -61,7 +80,19 @@ SQLChannel::SQLChannel(const std::string& connector,
 	_table("T_POCO_LOG"),
 	_timeout(1000),
 	_throw(true),
-	_async(true)
+	_async(true),
+	_queue(1024),
+	_head(0),
+	_count(0),
+	_batchSize(100),
+	_latency(0),
+	_drop(false),
+	_running(false),
+	_stop(false),
+	_writing(false),
+	_written(0),
+	_pError(0),
+	_writer("SQLChannel")
 {
 	open();
 }
@@ -77,6 +108,7 @@ SQLChannel::~SQLChannel()
 	{
 		poco_unexpected();
 	}
+	delete _pError;
 }
 
 
@@ -92,7 +124,7 @@ void SQLChannel::open()
 	
 void SQLChannel::close()
 {
-	wait();
+	stopWriter();
 }
 
 
@@ -105,16 +137,214 @@ void SQLChannel::log(const Message& msg)
 
 void SQLChannel::logAsync(const Message& msg)
 {
-	poco_check_ptr (_pLogStatement);
-	if (0 == wait() && !_pLogStatement->done() && !_pLogStatement->initialized()) 
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (!_running) startWriter();
+
+	while (_count == _queue.size())
 	{
-		if (_throw) 
-			throw TimeoutException("Timed out waiting for previous statement completion");
-		else return;
+		if (_drop) return;
+
+		if (_timeout == Statement::WAIT_FOREVER)
+		{
+			_done.wait(_mutex);
+		}
+		else if (!_done.tryWait(_mutex, _timeout))
+		{
+			if (_throw) 
+				throw TimeoutException("Timed out waiting for free space in message queue");
+			else return;
+		}
+	}
+
+	LogEntry& entry = _queue[(_head + _count) % _queue.size()];
+	entry.source   = msg.getSource();
+	entry.name     = _name;
+	entry.pid      = msg.getPid();
+	entry.thread   = msg.getThread();
+	entry.tid      = msg.getTid();
+	entry.priority = msg.getPriority();
+	entry.text     = msg.getText();
+	entry.dateTime = msg.getTime();
+	if (entry.source.empty()) entry.source = _name;
+
+	// wake up the writer for the first message, once a batch is complete,
+	// and when the queue is full (batch may be larger than buffer)
+	if (++_count == 1 || _count == _batchSize || _count == _queue.size()) _ready.signal();
+}
+
+
+void SQLChannel::run()
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	for (;;)
+	{
+		while (_count == 0 && !_stop) _ready.wait(_mutex);
+		if (_count == 0) break;
+
+		// a batch cannot be larger than the queue
+		std::size_t batchSize = _batchSize < _queue.size() ? _batchSize : _queue.size();
+		if (_latency > 0 && _count < batchSize && !_stop)
+		{
+			// give the batch a chance to fill up
+			_ready.tryWait(_mutex, _latency);
+		}
+
+		std::size_t count = _count < batchSize ? _count : batchSize;
+		_sources.resize(count);
+		_names.resize(count);
+		_pids.resize(count);
+		_threads.resize(count);
+		_tids.resize(count);
+		_priorities.resize(count);
+		_texts.resize(count);
+		_dateTimes.resize(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			LogEntry& entry = _queue[_head];
+			_sources[i].swap(entry.source);
+			_names[i].swap(entry.name);
+			_pids[i] = entry.pid;
+			_threads[i].swap(entry.thread);
+			_tids[i] = entry.tid;
+			_priorities[i] = entry.priority;
+			_texts[i].swap(entry.text);
+			_dateTimes[i] = entry.dateTime;
+			_head = (_head + 1) % _queue.size();
+		}
+		_count -= count;
+		_writing = true;
+		_done.broadcast();
+
+		StrategyPtr pArchiveStrategy = _pArchiveStrategy;
+		try
+		{
+			ScopedUnlock<FastMutex> unlock(_mutex);
+			writeBatch(pArchiveStrategy);
+			_written += count;
+		}
+		catch (Exception& exc)
+		{
+			if (!_pError) _pError = exc.clone();
+		}
+		catch (std::exception& exc)
+		{
+			if (!_pError) _pError = new Exception(exc.what());
+		}
+		catch (...)
+		{
+			if (!_pError) _pError = new Exception("Unknown exception");
+		}
+		_writing = false;
+		_done.broadcast();
 	}
+}
+
 
+void SQLChannel::writeBatch(StrategyPtr pArchiveStrategy)
+{
 	if (!_pSession || !_pSession->isConnected()) open();
-	logSync(msg);
+	if (pArchiveStrategy) pArchiveStrategy->archive();
+
+	Statement stmt(*_pSession);
+	if (_pSession->getFeature("bulk"))
+	{
+		stmt << _sql,
+			use(_sources, bulk),
+			use(_names, bulk),
+			use(_pids, bulk),
+			use(_threads, bulk),
+			use(_tids, bulk),
+			use(_priorities, bulk),
+			use(_texts, bulk),
+			use(_dateTimes, bulk);
+	}
+	else
+	{
+		stmt << _sql,
+			use(_sources),
+			use(_names),
+			use(_pids),
+			use(_threads),
+			use(_tids),
+			use(_priorities),
+			use(_texts),
+			use(_dateTimes);
+	}
+
+	Transaction transaction(*_pSession);
+	stmt.execute();
+	transaction.commit();
+}
+
+
+void SQLChannel::startWriter()
+{
+	_stop = false;
+	_writer.start(*this);
+	_running = true;
+}
+
+
+void SQLChannel::stopWriter()
+{
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (!_running) return;
+		_stop = true;
+		_ready.signal();
+	}
+	_writer.join();
+
+	FastMutex::ScopedLock lock(_mutex);
+	_running = false;
+}
+
+
+std::size_t SQLChannel::wait()
+{
+	if (!_async) return 0;
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	while (_count > 0 || _writing)
+	{
+		if (_timeout == Statement::WAIT_FOREVER)
+		{
+			_done.wait(_mutex);
+		}
+		else if (!_done.tryWait(_mutex, _timeout))
+		{
+			if (_throw) 
+				throw TimeoutException("Timed out waiting for queued messages to be written");
+			else break;
+		}
+	}
+
+	if (_pError)
+	{
+		Exception* pError = _pError;
+		_pError = 0;
+		if (_throw)
+		{
+			try
+			{
+				pError->rethrow();
+			}
+			catch (...)
+			{
+				delete pError;
+				throw;
+			}
+		}
+		delete pError;
+	}
+
+	std::size_t written = _written;
+	_written = 0;
+	return written;
 }
 
 
@@ -151,21 +381,26 @@ void SQLChannel::setProperty(const std::string& name, const std::string& value)
 	}
 	else if (name == PROP_CONNECTOR)
 	{
+		close();
 		_connector = value;
-		close(); open();
+		open();
 	}
 	else if (name == PROP_CONNECT)
 	{
+		close();
 		_connect = value;
-		close(); open();
+		open();
 	}
 	else if (name == PROP_TABLE)
 	{
+		close();
 		_table = value;
 		initLogStatement();
 	}
 	else if (name == PROP_ARCHIVE_TABLE)
 	{
+		close();
+
 		if (value.empty())
 		{
 			_pArchiveStrategy = 0;
@@ -181,6 +416,7 @@ void SQLChannel::setProperty(const std::string& name, const std::string& value)
 	}
 	else if (name == PROP_MAX_AGE)
 	{
+		close();
 		if (value.empty() || "forever" == value)
 		{
 			_pArchiveStrategy = 0;
@@ -198,8 +434,37 @@ void SQLChannel::setProperty(const std::string& name, const std::string& value)
 	}
 	else if (name == PROP_ASYNC)
 	{
+		close();
 		_async = isTrue(value);
-		initLogStatement();
+	}
+	else if (name == PROP_BUFFER)
+	{
+		std::size_t size = NumberParser::parseUnsigned(value);
+		if (size == 0) throw InvalidArgumentException("Buffer size must be greater than zero.");
+		close();
+		FastMutex::ScopedLock lock(_mutex);
+		LogEntryVec queue(size);
+		_queue.swap(queue);
+		_head = 0;
+		_count = 0;
+	}
+	else if (name == PROP_BATCH)
+	{
+		std::size_t size = NumberParser::parseUnsigned(value);
+		if (size == 0) throw InvalidArgumentException("Batch size must be greater than zero.");
+		FastMutex::ScopedLock lock(_mutex);
+		_batchSize = size;
+	}
+	else if (name == PROP_LATENCY)
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		_latency = value.empty() ? 0 : NumberParser::parse(value);
+	}
+	else if (name == PROP_OVERFLOW)
+	{
+		if (value == "drop") _drop = true;
+		else if (value == "block") _drop = false;
+		else throw InvalidArgumentException("Invalid overflow policy", value);
 	}
 	else if (name == PROP_TIMEOUT)
 	{
@@ -246,6 +511,28 @@ std::string SQLChannel::getProperty(const std::string& name) const
 	{
 		return _pArchiveStrategy ? _pArchiveStrategy->getThreshold() : "forever";
 	}
+	else if (name == PROP_ASYNC)
+	{
+		if (_async) return "true";
+		else return "false";
+	}
+	else if (name == PROP_BUFFER)
+	{
+		return NumberFormatter::format(_queue.size());
+	}
+	else if (name == PROP_BATCH)
+	{
+		return NumberFormatter::format(_batchSize);
+	}
+	else if (name == PROP_LATENCY)
+	{
+		return NumberFormatter::format(_latency);
+	}
+	else if (name == PROP_OVERFLOW)
+	{
+		if (_drop) return "drop";
+		else return "block";
+	}
 	else if (name == PROP_TIMEOUT)
 	{
 		return NumberFormatter::format(_timeout);
@@ -266,9 +553,8 @@ void SQLChannel::initLogStatement()
 {
 	_pLogStatement = new Statement(*_pSession);
 
-	std::string sql;
-	Poco::format(sql, "INSERT INTO %s VALUES (?,?,?,?,?,?,?,?)", _table);
-	*_pLogStatement << sql,
+	Poco::format(_sql, "INSERT INTO %s VALUES (?,?,?,?,?,?,?,?)", _table);
+	*_pLogStatement << _sql,
 		use(_source),
 		use(_name),
 		use(_pid),
@@ -277,8 +563,6 @@ void SQLChannel::initLogStatement()
 		use(_priority),
 		use(_text),
 		use(_dateTime);
-
-	if (_async) _pLogStatement->setAsync();
 }
 
 
@@ -23,6 +23,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/SingletonHolder.h"
 #include "Poco/SharedPtr.h"
+#include "Poco/AtomicCounter.h"
 #include "Poco/ActiveResult.h"
 #include "Poco/ActiveMethod.h"
 #include "Poco/Mutex.h"
@@ -149,6 +150,11 @@ class AbstractEvent
 	/// Working with PriorityDelegate's as similar to working with BasicEvent.
 	/// Instead of delegate(), the priorityDelegate() function must be used
 	/// to create the PriorityDelegate.
+	///
+	/// The TStrategy holding the delegates is shared with all notifications
+	/// in progress, and only copied if delegates are added or removed while
+	/// it is shared. Firing an event therefore never copies the delegate list,
+	/// and an event without delegates is fired without locking its mutex.
 {
 public:
 	typedef TDelegate* DelegateHandle;
@@ -156,14 +162,17 @@ public:
 
 	AbstractEvent(): 
 		_executeAsync(this, &AbstractEvent::executeAsyncImpl),
-		_enabled(true)
+		_pStrategy(new TStrategy),
+		_enabled(true),
+		_hasDelegates(0)
 	{
 	}
 
 	AbstractEvent(const TStrategy& strat): 
 		_executeAsync(this, &AbstractEvent::executeAsyncImpl),
-		_strategy(strat),
-		_enabled(true)
+		_pStrategy(new TStrategy(strat)),
+		_enabled(true),
+		_hasDelegates(strat.empty() ? 0 : 1)
 	{	
 	}
 
@@ -177,7 +186,8 @@ public:
 		/// Exact behavior is determined by the TStrategy.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.add(aDelegate);
+		writableStrategy().add(aDelegate);
+		updateHasDelegates();
 	}
 	
 	void operator -= (const TDelegate& aDelegate)
@@ -186,7 +196,8 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.remove(aDelegate);
+		writableStrategy().remove(aDelegate);
+		updateHasDelegates();
 	}
 	
 	DelegateHandle add(const TDelegate& aDelegate)
@@ -198,7 +209,9 @@ public:
 		/// remove() to remove the delegate.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		return _strategy.add(aDelegate);
+		DelegateHandle delegateHandle = writableStrategy().add(aDelegate);
+		updateHasDelegates();
+		return delegateHandle;
 	}
 	
 	void remove(DelegateHandle delegateHandle)
@@ -208,7 +221,8 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.remove(delegateHandle);
+		writableStrategy().remove(delegateHandle);
+		updateHasDelegates();
 	}
 		
 	void operator () (const void* pSender, TArgs& args)
@@ -234,20 +248,22 @@ public:
 		/// the notify method is immediately aborted and the exception is propagated
 		/// to the caller.
 	{
+		if (_hasDelegates == 0) return;
+
 		Poco::ScopedLockWithUnlock<TMutex> lock(_mutex);
 		
 		if (!_enabled) return;
 		
 		// thread-safeness: 
-		// copy should be faster and safer than blocking until
-		// execution ends
-		TStrategy strategy(_strategy);
+		// the strategy is never modified while it is shared,
+		// so holding a reference to it is sufficient
+		SharedPtr<TStrategy> pStrategy(_pStrategy);
 		lock.unlock();
-		strategy.notify(pSender, args);
+		pStrategy->notify(pSender, args);
 	}
 
 	bool hasDelegates() const {
-		return !(_strategy.empty());
+		return _hasDelegates != 0;
 	}
 
 	ActiveResult<TArgs> notifyAsync(const void* pSender, const TArgs& args)
@@ -267,12 +283,10 @@ public:
 			typename TMutex::ScopedLock lock(_mutex);
 
 			// thread-safeness: 
-			// copy should be faster and safer than blocking until
-			// execution ends
-			// make a copy of the strategy here to guarantee that
+			// the strategy is never modified while it is shared, so
 			// between notifyAsync and the execution of the method no changes can occur
 				
-			params.ptrStrat = SharedPtr<TStrategy>(new TStrategy(_strategy));
+			params.ptrStrat = _pStrategy;
 			params.enabled  = _enabled;
 		}
 		ActiveResult<TArgs> result = _executeAsync(params);
@@ -304,14 +318,14 @@ public:
 		/// Removes all delegates.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.clear();
+		writableStrategy().clear();
+		updateHasDelegates();
 	}
 	
 	bool empty() const
 		/// Checks if any delegates are registered at the delegate.
 	{
-		typename TMutex::ScopedLock lock(_mutex);
-		return _strategy.empty();
+		return _hasDelegates == 0;
 	}
 
 protected:
@@ -343,9 +357,29 @@ protected:
 		return retArgs;
 	}
 
-	TStrategy _strategy; /// The strategy used to notify observers.
+	TStrategy& writableStrategy()
+		/// Returns the strategy for modification, after replacing
+		/// it with a copy if it is shared with a notification
+		/// in progress. The mutex must be locked.
+	{
+		if (_pStrategy.referenceCount() > 1)
+		{
+			_pStrategy = new TStrategy(*_pStrategy);
+		}
+		return *_pStrategy;
+	}
+
+	void updateHasDelegates()
+		/// Updates _hasDelegates after the strategy has been modified.
+		/// The mutex must be locked.
+	{
+		_hasDelegates = _pStrategy->empty() ? 0 : 1;
+	}
+
+	SharedPtr<TStrategy> _pStrategy; /// The strategy used to notify observers.
 	bool      _enabled;  /// Stores if an event is enabled. Notfies on disabled events have no effect
 	                     /// but it is possible to change the observers.
+	AtomicCounter _hasDelegates; /// 1 if delegates are registered, otherwise 0. Can be read without locking the mutex.
 	mutable TMutex _mutex;
 
 private:
@@ -362,14 +396,17 @@ public:
 
 	AbstractEvent(): 
 		_executeAsync(this, &AbstractEvent::executeAsyncImpl),
-		_enabled(true)
+		_pStrategy(new TStrategy),
+		_enabled(true),
+		_hasDelegates(0)
 	{
 	}
 
 	AbstractEvent(const TStrategy& strat): 
 		_executeAsync(this, &AbstractEvent::executeAsyncImpl),
-		_strategy(strat),
-		_enabled(true)
+		_pStrategy(new TStrategy(strat)),
+		_enabled(true),
+		_hasDelegates(strat.empty() ? 0 : 1)
 	{	
 	}
 
@@ -383,7 +420,8 @@ public:
 		/// Exact behavior is determined by the TStrategy.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.add(aDelegate);
+		writableStrategy().add(aDelegate);
+		updateHasDelegates();
 	}
 	
 	void operator -= (const TDelegate& aDelegate)
@@ -392,7 +430,8 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.remove(aDelegate);
+		writableStrategy().remove(aDelegate);
+		updateHasDelegates();
 	}
 
 	DelegateHandle add(const TDelegate& aDelegate)
@@ -404,7 +443,9 @@ public:
 		/// remove() to remove the delegate.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		return _strategy.add(aDelegate);
+		DelegateHandle delegateHandle = writableStrategy().add(aDelegate);
+		updateHasDelegates();
+		return delegateHandle;
 	}
 	
 	void remove(DelegateHandle delegateHandle)
@@ -414,7 +455,8 @@ public:
 		/// If the delegate is not found, this function does nothing.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.remove(delegateHandle);
+		writableStrategy().remove(delegateHandle);
+		updateHasDelegates();
 	}
 	
 	void operator () (const void* pSender)
@@ -440,16 +482,18 @@ public:
 		/// the notify method is immediately aborted and the exception is propagated
 		/// to the caller.
 	{
+		if (_hasDelegates == 0) return;
+
 		Poco::ScopedLockWithUnlock<TMutex> lock(_mutex);
 		
 		if (!_enabled) return;
 		
 		// thread-safeness: 
-		// copy should be faster and safer than blocking until
-		// execution ends
-		TStrategy strategy(_strategy);
+		// the strategy is never modified while it is shared,
+		// so holding a reference to it is sufficient
+		SharedPtr<TStrategy> pStrategy(_pStrategy);
 		lock.unlock();
-		strategy.notify(pSender);
+		pStrategy->notify(pSender);
 	}
 
 	ActiveResult<void> notifyAsync(const void* pSender)
@@ -469,12 +513,10 @@ public:
 			typename TMutex::ScopedLock lock(_mutex);
 
 			// thread-safeness: 
-			// copy should be faster and safer than blocking until
-			// execution ends
-			// make a copy of the strategy here to guarantee that
+			// the strategy is never modified while it is shared, so
 			// between notifyAsync and the execution of the method no changes can occur
 				
-			params.ptrStrat = SharedPtr<TStrategy>(new TStrategy(_strategy));
+			params.ptrStrat = _pStrategy;
 			params.enabled  = _enabled;
 		}
 		ActiveResult<void> result = _executeAsync(params);
@@ -506,14 +548,14 @@ public:
 		/// Removes all delegates.
 	{
 		typename TMutex::ScopedLock lock(_mutex);
-		_strategy.clear();
+		writableStrategy().clear();
+		updateHasDelegates();
 	}
 	
 	bool empty() const
 		/// Checks if any delegates are registered at the delegate.
 	{
-		typename TMutex::ScopedLock lock(_mutex);
-		return _strategy.empty();
+		return _hasDelegates == 0;
 	}
 
 protected:
@@ -543,9 +585,29 @@ protected:
 		return;
 	}
 
-	TStrategy _strategy; /// The strategy used to notify observers.
+	TStrategy& writableStrategy()
+		/// Returns the strategy for modification, after replacing
+		/// it with a copy if it is shared with a notification
+		/// in progress. The mutex must be locked.
+	{
+		if (_pStrategy.referenceCount() > 1)
+		{
+			_pStrategy = new TStrategy(*_pStrategy);
+		}
+		return *_pStrategy;
+	}
+
+	void updateHasDelegates()
+		/// Updates _hasDelegates after the strategy has been modified.
+		/// The mutex must be locked.
+	{
+		_hasDelegates = _pStrategy->empty() ? 0 : 1;
+	}
+
+	SharedPtr<TStrategy> _pStrategy; /// The strategy used to notify observers.
 	bool      _enabled;  /// Stores if an event is enabled. Notfies on disabled events have no effect
 	                     /// but it is possible to change the observers.
+	AtomicCounter _hasDelegates; /// 1 if delegates are registered, otherwise 0. Can be read without locking the mutex.
 	mutable TMutex _mutex;
 
 private:
@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <typeinfo>
 #include <cstring>
+#ifndef POCO_NO_SOO
+#include <type_traits>
+#endif
 
 
 namespace Poco {
@@ -41,7 +44,7 @@ template <class> class VarHolderImpl;
 
 #ifndef POCO_NO_SOO
 
-#ifndef POCO_ENABLE_CPP11
+#ifndef POCO_HAVE_CPP11
 	// C++11 needed for std::aligned_storage
 	#error "Any SOO can only be enabled with C++11 support"
 #endif
@@ -70,7 +73,8 @@ public:
 
 	void erase()
 	{
-		std::memset(holder, 0, sizeof(Placeholder));
+		pHolder = 0;
+		holder[SizeV] = 0;
 	}
 
 	bool isLocal() const
@@ -108,6 +112,20 @@ private:
 };
 
 
+template <typename HolderT, typename ValueT>
+struct SmallObject
+	/// SmallObject<HolderT, ValueT>::value is true if a HolderT
+	/// holding a ValueT is stored in the local buffer of a Placeholder.
+	///
+	/// This is the case if HolderT fits into POCO_SMALL_OBJECT_SIZE
+	/// bytes and ValueT is trivially copyable. The latter guarantees
+	/// that copying a locally stored holder (e.g., when moving or
+	/// swapping Any or Dynamic::Var values) is cheap and does not throw.
+{
+	static const bool value = (sizeof(HolderT) <= POCO_SMALL_OBJECT_SIZE) && std::is_trivially_copyable<ValueT>::value;
+};
+
+
 #else // !POCO_NO_SOO
 
 
@@ -191,21 +209,14 @@ public:
 		/// Destructor. If Any is locally held, calls ValueHolder destructor;
 		/// otherwise, deletes the placeholder from the heap.
 	{
-		if (!empty())
-		{
-			if (_valueHolder.isLocal())
-				destruct();
-			else
-				delete content();
-		}
+		destruct();
 	}
 
 	Any& swap(Any& other)
 		/// Swaps the content of the two Anys.
-		/// 
-		/// When small object optimizaton is enabled, swap only
-		/// has no-throw guarantee when both (*this and other)
-		/// objects are allocated on the heap.
+		///
+		/// Only trivially copyable values are held locally,
+		/// so swap does not throw.
 	{
 		if (this == &other) return *this;
 
@@ -215,18 +226,10 @@ public:
 		}
 		else
 		{
-			Any tmp(*this);
-			try
-			{
-				if (_valueHolder.isLocal()) destruct();
-				construct(other);
-				other = tmp;
-			}
-			catch (...)
-			{
-				construct(tmp);
-				throw;
-			}
+			Any tmp;
+			tmp.move(*this);
+			move(other);
+			other.move(tmp);
 		}
 
 		return *this;
@@ -240,26 +243,21 @@ public:
 		///   Any a = 13; 
 		///   Any a = string("12345");
 	{
-		construct(rhs);
+		Any(rhs).swap(*this);
 		return *this;
 	}
 	
 	Any& operator = (const Any& rhs)
 		/// Assignment operator for Any.
 	{
-		if ((this != &rhs) && !rhs.empty())
-			construct(rhs);
-		else if ((this != &rhs) && rhs.empty())
-			_valueHolder.erase();
-
+		Any(rhs).swap(*this);
 		return *this;
 	}
 	
 	bool empty() const
 		/// Returns true if the Any is empty.
 	{
-		char buf[POCO_SMALL_OBJECT_SIZE] = { 0 };
-		return 0 == std::memcmp(_valueHolder.holder, buf, POCO_SMALL_OBJECT_SIZE);
+		return !_valueHolder.isLocal() && !_valueHolder.pHolder;
 	}
 	
 	const std::type_info & type() const
@@ -300,7 +298,7 @@ private:
 
 		virtual void clone(Placeholder<ValueHolder>* pPlaceholder) const
 		{
-			if ((sizeof(Holder<ValueType>) <= POCO_SMALL_OBJECT_SIZE))
+			if (SmallObject<Holder<ValueType>, ValueType>::value)
 			{
 				new ((ValueHolder*) pPlaceholder->holder) Holder(_held);
 				pPlaceholder->setLocal(true);
@@ -326,7 +324,7 @@ private:
 	template<typename ValueType>
 	void construct(const ValueType& value)
 	{
-		if (sizeof(Holder<ValueType>) <= Placeholder<ValueType>::Size::value)
+		if (SmallObject<Holder<ValueType>, ValueType>::value)
 		{
 			new (reinterpret_cast<ValueHolder*>(_valueHolder.holder)) Holder<ValueType>(value);
 			_valueHolder.setLocal(true);
@@ -345,10 +343,30 @@ private:
 		else
 			_valueHolder.erase();
 	}
+
+	void move(Any& other)
+		/// Moves the content of other, which is empty afterwards,
+		/// into this Any, which must be empty.
+	{
+		if (other._valueHolder.isLocal())
+		{
+			other.content()->clone(&_valueHolder);
+			other.destruct();
+		}
+		else
+		{
+			_valueHolder.pHolder = other._valueHolder.pHolder;
+			other._valueHolder.erase();
+		}
+	}
 	
 	void destruct()
 	{
-		content()->~ValueHolder();
+		if (_valueHolder.isLocal())
+			content()->~ValueHolder();
+		else
+			delete content();
+		_valueHolder.erase();
 	}
 
 	Placeholder<ValueHolder> _valueHolder;
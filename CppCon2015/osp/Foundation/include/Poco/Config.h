@@ -83,23 +83,22 @@
 // cases when value holder fits into POCO_SMALL_OBJECT_SIZE
 // (see below).
 // 
-// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-// !!! NOTE: Any/Dynamic::Var SOO will NOT work reliably   !!!
-// !!! without C++11 (std::aligned_storage in particular). !!!
-// !!! Only comment this out if your compiler has support  !!!
-// !!! for std::aligned_storage.                           !!!
-// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-// 
-#define POCO_NO_SOO
+// Small object optimization changes the layout of Any and
+// Dynamic::Var. Therefore, this setting must be the same
+// for the POCO libraries and all code using them. 
+// Small object optimization requires C++11 (std::aligned_storage
+// in particular), so POCO_NO_SOO must be defined if the 
+// POCO libraries or code using them are compiled with a 
+// compiler that is not in C++11 (or later) mode 
+// (see Foundation.h).
+// #define POCO_NO_SOO
 
 
 // Small object size in bytes. When assigned to Any or Var,
 // objects larger than this value will be alocated on the heap,
 // while those smaller will be placement new-ed into an
-// internal buffer.
-#if !defined(POCO_SMALL_OBJECT_SIZE) && !defined(POCO_NO_SOO)
-	#define POCO_SMALL_OBJECT_SIZE 32
-#endif
+// internal buffer. Defaults to 32 (see Foundation.h).
+// #define POCO_SMALL_OBJECT_SIZE 32
 
 
 // Define to disable compilation of DirectoryWatcher
@@ -105,6 +105,11 @@ public:
 	Var(const Var& other);
 		/// Copy constructor.
 
+#ifdef POCO_HAVE_CPP11
+	Var(Var&& other) throw();
+		/// Move constructor. Leaves other empty.
+#endif
+
 	~Var();
 		/// Destroys the Var.
 
@@ -229,11 +234,12 @@ public:
 	Var& operator = (const T& other)
 		/// Assignment operator for assigning POD to Var
 	{
-#ifdef POCO_NO_SOO
 		Var tmp(other);
+#ifdef POCO_NO_SOO
 		swap(tmp);
 #else
-		construct(other);
+		destruct();
+		move(tmp);
 #endif
 		return *this;
 	}
@@ -244,6 +250,11 @@ public:
 	Var& operator = (const Var& other);
 		/// Assignment operator specialization for Var
 
+#ifdef POCO_HAVE_CPP11
+	Var& operator = (Var&& other) throw();
+		/// Move assignment operator. Leaves other empty.
+#endif
+
 	template <typename T>
 	const Var operator + (const T& other) const
 		/// Addition operator for adding POD to Var
@@ -584,6 +595,10 @@ private:
 
 	Var& structIndexOperator(VarHolderImpl<Struct<int> >* pStr, int n) const;
 
+	void move(Var& other);
+		/// Moves the content of other, which is empty afterwards,
+		/// into this Var, which must be empty.
+
 #ifdef POCO_NO_SOO
 
 	VarHolder* content() const
@@ -608,7 +623,7 @@ private:
 	template<typename ValueType>
 	void construct(const ValueType& value)
 	{
-		if (sizeof(VarHolderImpl<ValueType>) <= Placeholder<ValueType>::Size::value)
+		if (SmallObject<VarHolderImpl<ValueType>, ValueType>::value)
 		{
 			new (reinterpret_cast<VarHolder*>(_placeholder.holder)) VarHolderImpl<ValueType>(value);
 			_placeholder.setLocal(true);
@@ -623,7 +638,7 @@ private:
 	void construct(const char* value)
 	{
 		std::string val(value);
-		if (sizeof(VarHolderImpl<std::string>) <= Placeholder<std::string>::Size::value)
+		if (SmallObject<VarHolderImpl<std::string>, std::string>::value)
 		{
 			new (reinterpret_cast<VarHolder*>(_placeholder.holder)) VarHolderImpl<std::string>(val);
 			_placeholder.setLocal(true);
@@ -651,6 +666,7 @@ private:
 				content()->~VarHolder();
 			else
 				delete content();
+			_placeholder.erase();
 		}
 	}
 
@@ -685,24 +701,70 @@ inline void Var::swap(Var& other)
 	}
 	else
 	{
-		Var tmp(*this);
-		try
-		{
-			if (_placeholder.isLocal()) destruct();
-			construct(other);
-			other = tmp;
-		}
-		catch (...)
-		{
-			construct(tmp);
-			throw;
-		}
+		Var tmp;
+		tmp.move(*this);
+		move(other);
+		other.move(tmp);
+	}
+
+#endif
+}
+
+
+inline void Var::move(Var& other)
+{
+#ifdef POCO_NO_SOO
+
+	_pHolder = other._pHolder;
+	other._pHolder = 0;
+
+#else
+
+	if (other._placeholder.isLocal())
+	{
+		// only trivially copyable values are held locally
+		other.content()->clone(&_placeholder);
+		other.destruct();
+	}
+	else
+	{
+		_placeholder.pHolder = other._placeholder.pHolder;
+		other._placeholder.erase();
 	}
 
 #endif
 }
 
 
+#ifdef POCO_HAVE_CPP11
+
+
+inline Var::Var(Var&& other) throw()
+#ifdef POCO_NO_SOO
+	: _pHolder(0)
+#endif
+{
+	move(other);
+}
+
+
+inline Var& Var::operator = (Var&& other) throw()
+{
+	if (this != &other)
+	{
+		// other may be part of the value held by this Var
+		Var tmp;
+		tmp.move(other);
+		destruct();
+		move(tmp);
+	}
+	return *this;
+}
+
+
+#endif // POCO_HAVE_CPP11
+
+
 inline const std::type_info& Var::type() const
 {
 	VarHolder* pHolder = content();
@@ -131,7 +131,8 @@ public:
 		/// If small object optimization is enabled (i.e. if 
 		/// POCO_NO_SOO is not defined), VarHolder will be
 		/// instantiated in-place if it's size is smaller
-		/// than POCO_SMALL_OBJECT_SIZE.
+		/// than POCO_SMALL_OBJECT_SIZE and the held value is
+		/// trivially copyable.
 
 	virtual const std::type_info& type() const = 0;
 		/// Implementation must return the type information
@@ -264,9 +265,10 @@ protected:
 	template <typename T>
 	VarHolder* cloneHolder(Placeholder<VarHolder>* pVarHolder, const T& val) const
 		/// Instantiates value holder wrapper. If size of the wrapper is
-		/// larger than POCO_SMALL_OBJECT_SIZE, holder is instantiated on
-		/// the heap, otherwise it is instantiated in-place (in the 
-		/// pre-allocated buffer inside the holder).
+		/// larger than POCO_SMALL_OBJECT_SIZE, or if the value is not
+		/// trivially copyable, holder is instantiated on the heap,
+		/// otherwise it is instantiated in-place (in the pre-allocated
+		/// buffer inside the holder).
 		/// 
 		/// Called from clone() member function of the implementation when
 		/// smal object optimization is enabled.
@@ -276,7 +278,7 @@ protected:
 		return new VarHolderImpl<T>(val);
 #else
 		poco_check_ptr (pVarHolder);
-		if ((sizeof(VarHolderImpl<T>) <= Placeholder<T>::Size::value))
+		if (SmallObject<VarHolderImpl<T>, T>::value)
 		{
 			new ((VarHolder*) pVarHolder->holder) VarHolderImpl<T>(val);
 			pVarHolder->setLocal(true);
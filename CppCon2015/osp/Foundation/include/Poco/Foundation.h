@@ -114,6 +114,33 @@
 //
 #include "Poco/Alignment.h"
 
+
+//
+// POCO_HAVE_CPP11 is defined if C++11 language features
+// (e.g., rvalue references) are available, either because the 
+// compiler is in C++11 (or later) mode, or because 
+// POCO_ENABLE_CPP11 has been defined.
+//
+#if (__cplusplus >= 201103L || defined(POCO_ENABLE_CPP11)) && !defined(POCO_HAVE_CPP11)
+	#define POCO_HAVE_CPP11
+#endif
+
+
+//
+// Small object optimization (see Config.h) requires C++11.
+// It changes the layout of Any and Dynamic::Var, so it is
+// not disabled automatically for a compiler that is not in
+// C++11 mode, as the setting must be the same for the
+// POCO libraries and all code using them.
+//
+#if !defined(POCO_HAVE_CPP11) && !defined(POCO_NO_SOO)
+	#error "Small object optimization requires C++11. Define POCO_NO_SOO (see Config.h) for the POCO libraries and all code using them."
+#endif
+#if !defined(POCO_SMALL_OBJECT_SIZE) && !defined(POCO_NO_SOO)
+	#define POCO_SMALL_OBJECT_SIZE 32
+#endif
+
+
 //
 // Cleanup inconsistencies
 //
@@ -0,0 +1,222 @@
+//
+// DynamicVarBenchmark.cpp
+//
+// $Id$
+//
+// This sample measures the performance of Poco::Dynamic::Var for
+// conversions between strings and numbers (the doDynamicVar benchmark
+// from the "Dynamic C++ Performance" talk at ACCU 2014), for small values
+// and for containers of Vars, and counts the heap allocations needed.
+//
+// If small object optimization is enabled, the program exits with
+// a non-zero status if a Var holding an int or a double allocates
+// memory on the heap, so it can be used as a regression test.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Dynamic/Var.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Format.h"
+#include "Poco/Exception.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <new>
+#include <cstdlib>
+
+
+using Poco::Dynamic::Var;
+using Poco::Stopwatch;
+
+
+namespace
+{
+	int iterations = 100000;
+	unsigned long allocations = 0;
+}
+
+
+void* operator new(std::size_t size)
+{
+	++allocations;
+	void* p = std::malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+
+
+void operator delete(void* p) throw()
+{
+	std::free(p);
+}
+
+
+void printResult(const std::string& name, const Stopwatch& sw, unsigned long allocs)
+{
+	std::cout << Poco::format("%-36s %8.2f ms %8.1f ns/op %6.2f allocs/op",
+		name,
+		sw.elapsed()/1000.0,
+		sw.elapsed()*1000.0/iterations,
+		double(allocs)/iterations) << std::endl;
+}
+
+
+void benchmarkConversions(const std::vector<std::string>& strvec)
+	/// The doDynamicVar benchmark: string to number conversions
+	/// and back, with the Var being re-assigned for each step.
+{
+	std::vector<std::string>::const_iterator it = strvec.begin();
+	std::vector<std::string>::const_iterator end = strvec.end();
+
+	unsigned long allocs = allocations;
+	Stopwatch sw;
+	sw.start();
+	for (; it != end; ++it)
+	{
+		Var var(*it);
+
+		int i = var;
+
+		double d = var;
+
+		var = i;
+		std::string s = var.toString();
+
+		var = d;
+		s = var.toString();
+	}
+	sw.stop();
+	printResult("String/number conversions", sw, allocations - allocs);
+}
+
+
+unsigned long benchmarkSmallValues()
+	/// Constructs, assigns, copies and extracts int and double values.
+	/// Returns the number of heap allocations needed.
+{
+	double sum = 0;
+	unsigned long allocs = allocations;
+	Stopwatch sw;
+	sw.start();
+	for (int k = 0; k < iterations; k++)
+	{
+		Var var(k);
+		sum += var.extract<int>();
+		var = 0.5*k;
+		Var copy(var);
+		sum += copy.extract<double>();
+		copy = k;
+		var.swap(copy);
+		sum += var.convert<double>();
+	}
+	sw.stop();
+	allocs = allocations - allocs;
+	printResult("Small values (int, double)", sw, allocs);
+	if (sum < 0) std::cout << sum << std::endl;
+	return allocs;
+}
+
+
+void benchmarkContainer()
+	/// Fills a std::vector<Var> with ints and strings,
+	/// then wraps the vector in a Var and copies it.
+{
+	unsigned long allocs = allocations;
+	Stopwatch sw;
+	sw.start();
+	std::vector<Var> vec;
+	for (int k = 0; k < iterations; k++)
+	{
+		if (k % 2)
+			vec.push_back(Var(k));
+		else
+			vec.push_back(Var(std::string("a string value too large for a local buffer")));
+	}
+	Var var(vec);
+	Var copy(var);
+	sw.stop();
+	printResult("std::vector<Var> growth and copy", sw, allocations - allocs);
+}
+
+
+void benchmarkMove()
+	/// Passes Vars holding strings through a chain of assignments.
+{
+	std::vector<Var> vec(iterations, Var(std::string("a string value too large for a local buffer")));
+
+	unsigned long allocs = allocations;
+	Stopwatch sw;
+	sw.start();
+	Var var;
+	for (int k = 0; k < iterations; k++)
+	{
+#ifdef POCO_HAVE_CPP11
+		var = std::move(vec[k]);
+#else
+		var = vec[k];
+#endif
+		vec[k] = k;
+	}
+	sw.stop();
+	printResult("Assignment of string Vars", sw, allocations - allocs);
+}
+
+
+std::vector<std::string> makeStrings()
+{
+	static const char num[] = "123456789";
+	std::vector<std::string> strvec(iterations);
+	std::vector<std::string>::iterator it = strvec.begin();
+	std::vector<std::string>::iterator end = strvec.end();
+	for (; it != end; ++it)
+	{
+		for (int i = 0; i < 9; ++i)
+			it->append(1, num[std::rand() % 8]);
+	}
+	return strvec;
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		if (argc > 1) iterations = Poco::NumberParser::parse(argv[1]);
+
+		std::cout << "Dynamic::Var Benchmark" << std::endl;
+		std::cout << "======================" << std::endl;
+#ifdef POCO_NO_SOO
+		std::cout << "Small object optimization: disabled" << std::endl;
+#else
+		std::cout << "Small object optimization: enabled (" << POCO_SMALL_OBJECT_SIZE << " bytes)" << std::endl;
+#endif
+		std::cout << "sizeof(Var): " << sizeof(Var) << ", " << iterations << " iterations" << std::endl << std::endl;
+
+		benchmarkConversions(makeStrings());
+		unsigned long smallAllocs = benchmarkSmallValues();
+		benchmarkContainer();
+		benchmarkMove();
+
+#ifndef POCO_NO_SOO
+		if (smallAllocs > 0)
+		{
+			std::cerr << std::endl << "FAILED: small values have been allocated on the heap." << std::endl;
+			return 2;
+		}
+#else
+		(void) smallAllocs;
+#endif
+	}
+	catch (Poco::Exception& exc)
+	{
+		std::cerr << exc.displayText() << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -72,10 +72,13 @@ Var& Var::operator = (const Var& rhs)
 	Var tmp(rhs);
 	swap(tmp);
 #else
-	if ((this != &rhs) && !rhs.isEmpty())
-		construct(rhs);
-	else if ((this != &rhs) && rhs.isEmpty())
-		_placeholder.erase();
+	if (this != &rhs)
+	{
+		// rhs may be part of the value held by this Var
+		Var tmp(rhs);
+		destruct();
+		move(tmp);
+	}
 #endif
 	return *this;
 }
@@ -332,9 +335,7 @@ void Var::empty()
 	delete _pHolder;
 	_pHolder = 0;
 #else
-	if (_placeholder.isLocal()) this->~Var();
-	else delete content();
-	_placeholder.erase();
+	destruct();
 #endif
 }
 
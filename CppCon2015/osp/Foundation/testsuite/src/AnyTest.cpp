@@ -210,6 +210,31 @@ void AnyTest::testEmptyCopy()
 }
 
 
+void AnyTest::testAssignReplace()
+{
+	Any a = 42;
+	assert (AnyCast<int>(a) == 42);
+	a = std::string("a string that is too long for small object optimization");
+	assert (AnyCast<std::string>(a) == "a string that is too long for small object optimization");
+	a = 1.5;
+	assert (AnyCast<double>(a) == 1.5);
+
+	Any b = std::string("test");
+	a.swap(b);
+	assert (AnyCast<std::string>(a) == "test");
+	assert (AnyCast<double>(b) == 1.5);
+
+	a = RefAnyCast<std::string>(a);
+	assert (AnyCast<std::string>(a) == "test");
+
+	Any empty;
+	a = empty;
+	assert (a.empty());
+	b = a;
+	assert (b.empty());
+}
+
+
 void AnyTest::testInt()
 {
 	Any e;
@@ -289,6 +314,7 @@ CppUnit::Test* AnyTest::suite()
 	CppUnit_addTest(pSuite, AnyTest, testDefaultCtor);
 	CppUnit_addTest(pSuite, AnyTest, testCopyCtor);
 	CppUnit_addTest(pSuite, AnyTest, testCopyAssign);
+	CppUnit_addTest(pSuite, AnyTest, testAssignReplace);
 	CppUnit_addTest(pSuite, AnyTest, testConvertingAssign);
 	CppUnit_addTest(pSuite, AnyTest, testBadCast);
 	CppUnit_addTest(pSuite, AnyTest, testSwap);
@@ -33,6 +33,7 @@ public:
 	void testBadCast();
 	void testSwap();
 	void testEmptyCopy();
+	void testAssignReplace();
 	void testCastToReference();
 
 	void testInt();
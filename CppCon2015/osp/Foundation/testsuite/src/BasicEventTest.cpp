@@ -317,6 +317,30 @@ void BasicEventTest::testAsyncNotify()
 	assert (_count == LARGEINC);
 }
 
+void BasicEventTest::testModifyDuringNotify()
+{
+	int tmp = 0;
+
+	assert (Simple.empty());
+	Simple.notify(this, tmp);
+	assert (_count == 0);
+
+	Simple += delegate(this, &BasicEventTest::onSimpleModify);
+	assert (!Simple.empty());
+
+	// onSimpleModify replaces itself with onSimple, which must
+	// not be invoked by the notification in progress
+	Simple.notify(this, tmp);
+	assert (_count == 1);
+	Simple.notify(this, tmp);
+	assert (_count == 2);
+
+	Simple -= delegate(this, &BasicEventTest::onSimple);
+	assert (Simple.empty());
+	Simple.notify(this, tmp);
+	assert (_count == 2);
+}
+
 void BasicEventTest::onStaticVoid(const void* pSender)
 {
 	BasicEventTest* p = const_cast<BasicEventTest*>(reinterpret_cast<const BasicEventTest*>(pSender));
@@ -359,6 +383,14 @@ void BasicEventTest::onStaticSimple3(int& i)
 }
 
 
+void BasicEventTest::onSimpleModify(const void* pSender, int& i)
+{
+	_count++;
+	Simple -= delegate(this, &BasicEventTest::onSimpleModify);
+	Simple += delegate(this, &BasicEventTest::onSimple);
+}
+
+
 void BasicEventTest::onSimpleOther(const void* pSender, int& i)
 {
 	_count+=100;
@@ -436,5 +468,6 @@ CppUnit::Test* BasicEventTest::suite()
 	CppUnit_addTest(pSuite, BasicEventTest, testOverwriteDelegate);
 	CppUnit_addTest(pSuite, BasicEventTest, testAsyncNotify);
 	CppUnit_addTest(pSuite, BasicEventTest, testNullMutex);
+	CppUnit_addTest(pSuite, BasicEventTest, testModifyDuringNotify);
 	return pSuite;
 }
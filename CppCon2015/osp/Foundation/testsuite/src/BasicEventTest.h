@@ -46,6 +46,7 @@ public:
 	void testOverwriteDelegate();
 	void testAsyncNotify();
 	void testNullMutex();
+	void testModifyDuringNotify();
 	
 	void setUp();
 	void tearDown();
@@ -63,6 +64,7 @@ protected:
 
 	void onSimpleNoSender(int& i);
 	void onSimple(const void* pSender, int& i);
+	void onSimpleModify(const void* pSender, int& i);
 	void onSimpleOther(const void* pSender, int& i);
 	void onConstSimple(const void* pSender, const int& i);
 	void onComplex(const void* pSender, Poco::EventArgs* & i);
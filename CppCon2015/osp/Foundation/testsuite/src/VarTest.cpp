@@ -2509,6 +2509,91 @@ void VarTest::testEmpty()
 }
 
 
+void VarTest::testSwapAndAssign()
+{
+	Var i = 42;
+	Var d = 1.5;
+	Var s = std::string("a string that is too long for small object optimization");
+	Var e;
+
+	i.swap(s);
+	assert (i == "a string that is too long for small object optimization");
+	assert (s == 42);
+	s.swap(d);
+	assert (s == 1.5);
+	assert (d == 42);
+	e.swap(d);
+	assert (e == 42);
+	assert (d.isEmpty());
+	e.swap(e);
+	assert (e == 42);
+
+	s = i;
+	assert (s == "a string that is too long for small object optimization");
+	s = 7;
+	assert (s == 7);
+	s = e;
+	assert (s == 42);
+	s = d;
+	assert (s.isEmpty());
+	s = s;
+	assert (s.isEmpty());
+
+	std::vector<Var> vec;
+	vec.push_back(1);
+	vec.push_back(std::string("two"));
+	Var arr = vec;
+	arr = arr[1];
+	assert (arr == "two");
+	arr = vec;
+	arr = arr[0].extract<int>();
+	assert (arr == 1);
+}
+
+
+void VarTest::testMove()
+{
+#ifdef POCO_HAVE_CPP11
+	Var i = 42;
+	Var m(std::move(i));
+	assert (i.isEmpty());
+	assert (m == 42);
+
+	Var s = std::string("a string that is too long for small object optimization");
+	const std::string* pStr = &s.extract<std::string>();
+	Var n(std::move(s));
+	assert (s.isEmpty());
+	assert (n == "a string that is too long for small object optimization");
+	assert (pStr == &n.extract<std::string>());
+
+	m = std::move(n);
+	assert (n.isEmpty());
+	assert (m == "a string that is too long for small object optimization");
+	assert (pStr == &m.extract<std::string>());
+	n = std::move(m);
+	m = 1.5;
+	m = std::move(m);
+	assert (m == 1.5);
+	n = std::move(m);
+	assert (m.isEmpty());
+	assert (n == 1.5);
+
+	std::vector<Var> vec;
+	vec.push_back(1);
+	vec.push_back(std::string("two"));
+	Var arr = vec;
+	arr = std::move(arr[1]);
+	assert (arr == "two");
+
+	std::vector<Var> vars;
+	for (int k = 0; k < 100; ++k)
+		vars.push_back(Var(k));
+	for (int k = 0; k < 100; ++k)
+		assert (vars[k] == k);
+#endif
+}
+
+
 void VarTest::testIterator()
 {
 	Var da;
@@ -2631,6 +2716,8 @@ CppUnit::Test* VarTest::suite()
 	CppUnit_addTest(pSuite, VarTest, testDate);
 	CppUnit_addTest(pSuite, VarTest, testEmpty);
 	CppUnit_addTest(pSuite, VarTest, testIterator);
+	CppUnit_addTest(pSuite, VarTest, testSwapAndAssign);
+	CppUnit_addTest(pSuite, VarTest, testMove);
 
 	return pSuite;
 }
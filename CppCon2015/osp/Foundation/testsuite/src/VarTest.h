@@ -72,6 +72,8 @@ public:
 	void testDate();
 	void testEmpty();
 	void testIterator();
+	void testSwapAndAssign();
+	void testMove();
 
 
 	void setUp();
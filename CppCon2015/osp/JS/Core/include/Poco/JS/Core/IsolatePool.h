@@ -0,0 +1,192 @@
+//
+// IsolatePool.h
+//
+// $Id: //poco/1.4/JS/Core/include/Poco/JS/Core/IsolatePool.h#1 $
+//
+// Library: JSCore
+// Package: JSCore
+// Module:  IsolatePool
+//
+// Definition of the IsolatePool class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef JS_Core_IsolatePool_INCLUDED
+#define JS_Core_IsolatePool_INCLUDED
+
+
+#include "Poco/JS/Core/Core.h"
+#include "Poco/JS/Core/PooledIsolate.h"
+#include "Poco/JS/Core/Wrapper.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/ObjectPool.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Mutex.h"
+#include <vector>
+
+
+namespace Poco {
+namespace JS {
+namespace Core {
+
+
+class IsolatePool;
+
+
+class JSCore_API PooledIsolateFactory
+	/// The PoolableObjectFactory used by IsolatePool.
+	///
+	/// Creates isolates with the pool's memory limit and
+	/// instantiates the object templates of all wrappers
+	/// registered with the pool. Isolates given back to the
+	/// pool are reset.
+{
+public:
+	PooledIsolateFactory(IsolatePool& pool);
+	PooledIsolate* createObject();
+	bool validateObject(PooledIsolate* pPooledIso);
+	void activateObject(PooledIsolate* pPooledIso);
+	void deactivateObject(PooledIsolate* pPooledIso);
+	void destroyObject(PooledIsolate* pPooledIso);
+
+private:
+	IsolatePool* _pPool;
+};
+
+
+class JSCore_API IsolatePool: public Poco::RefCountedObject
+	/// IsolatePool maintains a number of pre-warmed isolates
+	/// (PooledIsolate), which can be borrowed by JSExecutor instances,
+	/// instead of creating a new isolate for every executor.
+	///
+	/// Creating an isolate and its first context, as well as setting up
+	/// the object templates for the wrapper classes, takes a considerable
+	/// amount of time. IsolatePool does all this up front, for all
+	/// isolates created by prestart(), and for all wrappers registered
+	/// with registerWrapper().
+	///
+	/// As the resource constraints of an isolate cannot be changed once
+	/// it has been created, all isolates in a pool have the same memory limit.
+	/// JSExecutor only borrows isolates from the default pool if its memory
+	/// limit matches the one of the pool.
+	///
+	/// All member functions are thread-safe.
+{
+public:
+	typedef Poco::AutoPtr<IsolatePool> Ptr;
+	typedef Poco::SharedPtr<Wrapper> WrapperPtr;
+
+	IsolatePool(Poco::UInt64 memoryLimit, std::size_t capacity, std::size_t peakCapacity);
+		/// Creates the IsolatePool.
+		///
+		/// All isolates created by the pool use the given memory limit.
+		/// At most capacity unused isolates are kept in the pool, and at
+		/// most peakCapacity isolates can be borrowed from the pool at
+		/// the same time.
+
+	~IsolatePool();
+		/// Destroys the IsolatePool and all isolates kept in it.
+
+	void registerWrapper(WrapperPtr pWrapper);
+		/// Registers a Wrapper, whose object template is instantiated
+		/// in every isolate created by the pool, before the isolate
+		/// is handed out for the first time.
+		///
+		/// Wrappers should be registered before calling prestart(),
+		/// as isolates already created are not updated.
+
+	void prestart(std::size_t count);
+		/// Creates isolates, until count isolates (but not more than
+		/// the capacity of the pool) are available in the pool.
+
+	PooledIsolate* borrowIsolate();
+		/// Takes an isolate from the pool, or creates a new isolate if the
+		/// pool is empty. Returns null if the peak capacity of the
+		/// pool has been reached.
+		///
+		/// The isolate must be given back with returnIsolate().
+
+	void returnIsolate(PooledIsolate* pPooledIso);
+		/// Resets the given isolate and gives it back to the pool.
+		/// If the pool is already at capacity, the isolate is destroyed.
+
+	Poco::UInt64 memoryLimit() const;
+		/// Returns the memory limit of the isolates in the pool.
+
+	std::size_t capacity() const;
+		/// Returns the capacity of the pool.
+
+	std::size_t peakCapacity() const;
+		/// Returns the peak capacity of the pool.
+
+	std::size_t size() const;
+		/// Returns the number of isolates currently managed by the pool,
+		/// including borrowed ones.
+
+	static Ptr defaultPool();
+		/// Returns the default IsolatePool, used by JSExecutor,
+		/// or null if no default pool has been set.
+
+	static void setDefaultPool(Ptr pPool);
+		/// Sets the default IsolatePool. Can be null to disable pooling.
+
+protected:
+	void instantiateTemplates(PooledIsolate* pPooledIso);
+
+private:
+	IsolatePool();
+	IsolatePool(const IsolatePool&);
+	IsolatePool& operator = (const IsolatePool&);
+
+	typedef Poco::ObjectPool<PooledIsolate, PooledIsolate*, PooledIsolateFactory> Pool;
+	typedef std::vector<WrapperPtr> WrapperVec;
+
+	Poco::UInt64 _memoryLimit;
+	Pool _pool;
+	WrapperVec _wrappers;
+	Poco::FastMutex _mutex;
+
+	static Ptr _pDefaultPool;
+	static Poco::FastMutex _defaultPoolMutex;
+
+	friend class PooledIsolateFactory;
+};
+
+
+//
+// inlines
+//
+inline Poco::UInt64 IsolatePool::memoryLimit() const
+{
+	return _memoryLimit;
+}
+
+
+inline std::size_t IsolatePool::capacity() const
+{
+	return _pool.capacity();
+}
+
+
+inline std::size_t IsolatePool::peakCapacity() const
+{
+	return _pool.peakCapacity();
+}
+
+
+inline std::size_t IsolatePool::size() const
+{
+	return _pool.size();
+}
+
+
+} } } // namespace Poco::JS::Core
+
+
+#endif // JS_Core_IsolatePool_INCLUDED
@@ -29,6 +29,7 @@
 #include "Poco/Util/Timer.h"
 #include "Poco/Util/TimerTask.h"
 #include "Poco/JS/Core/PooledIsolate.h"
+#include "Poco/JS/Core/IsolatePool.h"
 #include "v8.h"
 #include <set>
 
@@ -67,6 +68,10 @@ public:
 
 	JSExecutor(const std::string& source, const Poco::URI& sourceURI, Poco::UInt64 memoryLimit = DEFAULT_MEMORY_LIMIT);
 		/// Creates the JSExecutor with the given JavaScript source, sourceURI and memoryLimit.
+		///
+		/// If a default IsolatePool with the same memory limit has been set,
+		/// the executor borrows its isolate from the pool. Otherwise, a new
+		/// isolate is created.
 		
 	virtual ~JSExecutor();
 		/// Destroys the JSExecutor.
@@ -148,6 +153,10 @@ protected:
 	void runImpl();
 	void setup();
 	void compile();
+	v8::Local<v8::Script> compileScript(v8::Isolate* pIsolate, const std::string& source, const std::string& uri);
+		/// Compiles the given script source, using and updating
+		/// the ScriptCache. Must be called within a HandleScope
+		/// and a Context::Scope.
 	void reportError(v8::TryCatch& tryCatch);
 	void reportError(const ErrorInfo& errorInfo);
 
@@ -160,7 +169,8 @@ protected:
 	std::string _source;
 	Poco::URI _sourceURI;
 	Poco::UInt64 _memoryLimit;
-	Poco::JS::Core::PooledIsolate _pooledIso;
+	IsolatePool::Ptr _pIsolatePool;
+	PooledIsolate* _pPooledIso;
 	v8::Persistent<v8::ObjectTemplate> _globalObject;
 	v8::Persistent<v8::Context> _globalContext;
 	v8::Persistent<v8::Context> _scriptContext;
@@ -224,7 +234,7 @@ inline const Poco::URI& JSExecutor::uri() const
 
 inline v8::Isolate* JSExecutor::isolate()
 {
-	return _pooledIso.isolate();
+	return _pPooledIso->isolate();
 }
 
 
@@ -32,12 +32,26 @@ namespace Core {
 
 
 class JSCore_API PooledIsolate
+	/// PooledIsolate owns a v8::Isolate, together with the
+	/// object templates created for it by the Wrapper classes.
+	///
+	/// PooledIsolate objects are either owned by a JSExecutor,
+	/// or borrowed by it from an IsolatePool.
 {
 public:
 	typedef Poco::ObjectPool<PooledIsolate> Pool;
 
 	PooledIsolate();
-		/// Creates the PooledIsolate.
+		/// Creates the PooledIsolate with default resource constraints.
+
+	explicit PooledIsolate(Poco::UInt64 memoryLimit);
+		/// Creates the PooledIsolate, limiting the heap size of
+		/// the isolate to the given memoryLimit (in bytes).
+		///
+		/// Note that the resource constraints of an isolate can
+		/// only be set before it is used for the first time.
+		/// Throws a Poco::SystemException if the constraints 
+		/// cannot be set.
 
 	~PooledIsolate();
 		/// Destroys the PooledIsolate.
@@ -45,6 +59,15 @@ public:
 	v8::Isolate* isolate();
 		/// Returns the underlying v8::Isolate.
 		
+	Poco::UInt64 memoryLimit() const;
+		/// Returns the memory limit given to the constructor,
+		/// or 0 if the isolate uses default resource constraints.
+		
+	void reset();
+		/// Releases all native objects still referenced by wrappers
+		/// in the isolate, so that the isolate can be reused
+		/// by another JSExecutor. Object templates are kept.
+		
 	static PooledIsolate* fromIsolate(v8::Isolate* pIsolate);
 		/// Returns the PooledIsolate for the given Isolate.
 		
@@ -93,6 +116,7 @@ private:
 	typedef std::map<std::string, OTHolder> OTMap;
 	
 	v8::Isolate* _pIsolate;
+	Poco::UInt64 _memoryLimit;
 	OTMap _objectTemplates;
 };
 
@@ -106,6 +130,12 @@ inline v8::Isolate* PooledIsolate::isolate()
 }
 
 
+inline Poco::UInt64 PooledIsolate::memoryLimit() const
+{
+	return _memoryLimit;
+}
+
+
 } } } // namespace Poco::JS::Core
 
 
@@ -0,0 +1,139 @@
+//
+// ScriptCache.h
+//
+// $Id: //poco/1.4/JS/Core/include/Poco/JS/Core/ScriptCache.h#1 $
+//
+// Library: JSCore
+// Package: JSCore
+// Module:  ScriptCache
+//
+// Definition of the ScriptCache class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef JS_Core_ScriptCache_INCLUDED
+#define JS_Core_ScriptCache_INCLUDED
+
+
+#include "Poco/JS/Core/Core.h"
+#include "Poco/LRUCache.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Path.h"
+#include "Poco/Mutex.h"
+
+
+namespace Poco {
+namespace JS {
+namespace Core {
+
+
+class JSCore_API ScriptCache
+	/// ScriptCache is a process-wide cache for the data V8 produces
+	/// when compiling a script (ScriptCompiler::CachedData).
+	/// Passing this data to a subsequent compilation of the same
+	/// script source allows V8 to skip most of the parsing work.
+	///
+	/// Entries are keyed by the script's URI and checked against
+	/// a hash of the script source, so a modified script is never
+	/// compiled with outdated data.
+	///
+	/// Optionally, entries can be persisted to a directory, so that
+	/// they survive a restart of the application. Persisted entries
+	/// are only used if they have been created by the same version
+	/// of V8.
+	///
+	/// All member functions are thread-safe.
+{
+public:
+	struct Entry
+	{
+		std::string hash;
+			/// The hash of the script source (see contentHash()).
+
+		std::string data;
+			/// The cached data produced by V8. May be empty if V8
+			/// did not produce any data for the script (e.g., because
+			/// the script is too small).
+	};
+
+	typedef Poco::SharedPtr<Entry> EntryPtr;
+
+	enum
+	{
+		DEFAULT_CAPACITY = 512
+	};
+
+	ScriptCache(std::size_t capacity = DEFAULT_CAPACITY);
+		/// Creates the ScriptCache, holding at most capacity entries
+		/// in memory.
+
+	~ScriptCache();
+		/// Destroys the ScriptCache.
+
+	EntryPtr find(const std::string& uri, const std::string& hash);
+		/// Returns the entry for the given script URI if it exists
+		/// and matches the given content hash. If the entry is not in
+		/// memory and a persistency directory has been set, the entry
+		/// is loaded from the directory.
+		///
+		/// Returns a null pointer if no matching entry exists.
+
+	void add(const std::string& uri, const std::string& hash, const std::string& data);
+		/// Adds or replaces the entry for the given script URI.
+		///
+		/// If a persistency directory has been set, the entry is
+		/// also written to the directory. Failure to write the entry
+		/// is silently ignored.
+
+	void remove(const std::string& uri);
+		/// Removes the entry for the given script URI, from memory
+		/// and from the persistency directory.
+
+	void clear();
+		/// Removes all entries from memory and from the persistency
+		/// directory.
+
+	void setPersistencyDirectory(const std::string& path);
+		/// Sets the directory where entries are persisted.
+		/// The directory is created if it does not exist.
+		///
+		/// If an empty path is given, entries are only kept
+		/// in memory (default).
+
+	std::string getPersistencyDirectory() const;
+		/// Returns the directory where entries are persisted,
+		/// or an empty string if entries are only kept in memory.
+
+	static std::string contentHash(const std::string& source);
+		/// Returns the hash of the given script source,
+		/// as hex string.
+
+	static ScriptCache& instance();
+		/// Returns the global ScriptCache instance.
+
+protected:
+	Poco::Path pathFor(const std::string& uri) const;
+	EntryPtr load(const Poco::Path& path, const std::string& uri) const;
+	void store(const Poco::Path& path, const std::string& uri, const Entry& entry) const;
+
+private:
+	ScriptCache(const ScriptCache&);
+	ScriptCache& operator = (const ScriptCache&);
+
+	typedef Poco::LRUCache<std::string, Entry> Cache;
+
+	Cache _cache;
+	Poco::Path _persistencyDir;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+} } } // namespace Poco::JS::Core
+
+
+#endif // JS_Core_ScriptCache_INCLUDED
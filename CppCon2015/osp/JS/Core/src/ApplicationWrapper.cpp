@@ -15,6 +15,7 @@
 
 
 #include "Poco/JS/Core/ApplicationWrapper.h"
+#include "Poco/JS/Core/PooledIsolate.h"
 #include "Poco/JS/Core/DateTimeWrapper.h"
 #include "Poco/JS/Core/LoggerWrapper.h"
 #include "Poco/JS/Core/ConfigurationWrapper.h"
@@ -39,13 +40,21 @@ ApplicationWrapper::~ApplicationWrapper()
 v8::Handle<v8::ObjectTemplate> ApplicationWrapper::objectTemplate(v8::Isolate* pIsolate)
 {
 	v8::EscapableHandleScope handleScope(pIsolate);
-	v8::Local<v8::ObjectTemplate> applicationTemplate = v8::ObjectTemplate::New();
-	applicationTemplate->SetInternalFieldCount(1);
-	applicationTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "name"), name);
-	applicationTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "startTime"), startTime);
-	applicationTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "uptime"), uptime);
-	applicationTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "config"), config);
-	applicationTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "logger"), logger);
+	PooledIsolate* pPooledIso = PooledIsolate::fromIsolate(pIsolate);
+	poco_check_ptr (pPooledIso);
+	v8::Persistent<v8::ObjectTemplate>& pooledObjectTemplate(pPooledIso->objectTemplate("Core.Application"));
+	if (pooledObjectTemplate.IsEmpty())
+	{
+		v8::Handle<v8::ObjectTemplate> objectTemplate = v8::ObjectTemplate::New();
+		objectTemplate->SetInternalFieldCount(1);
+		objectTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "name"), name);
+		objectTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "startTime"), startTime);
+		objectTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "uptime"), uptime);
+		objectTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "config"), config);
+		objectTemplate->SetAccessor(v8::String::NewFromUtf8(pIsolate, "logger"), logger);
+		pooledObjectTemplate.Reset(pIsolate, objectTemplate);
+	}
+	v8::Local<v8::ObjectTemplate> applicationTemplate = v8::Local<v8::ObjectTemplate>::New(pIsolate, pooledObjectTemplate);
 	return handleScope.Escape(applicationTemplate);
 }
 
@@ -15,6 +15,7 @@
 
 
 #include "Poco/JS/Core/ConfigurationWrapper.h"
+#include "Poco/JS/Core/PooledIsolate.h"
 #include "Poco/Util/AbstractConfiguration.h"
 
 
@@ -36,13 +37,21 @@ ConfigurationWrapper::~ConfigurationWrapper()
 v8::Handle<v8::ObjectTemplate> ConfigurationWrapper::objectTemplate(v8::Isolate* pIsolate)
 {
 	v8::EscapableHandleScope handleScope(pIsolate);
-	v8::Local<v8::ObjectTemplate> configurationTemplate = v8::ObjectTemplate::New();
-	configurationTemplate->SetInternalFieldCount(1);
-	configurationTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getInt"), v8::FunctionTemplate::New(pIsolate, getInt));
-	configurationTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getDouble"), v8::FunctionTemplate::New(pIsolate, getDouble));
-	configurationTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getBool"), v8::FunctionTemplate::New(pIsolate, getBool));
-	configurationTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getString"), v8::FunctionTemplate::New(pIsolate, getString));
-	configurationTemplate->Set(v8::String::NewFromUtf8(pIsolate, "has"), v8::FunctionTemplate::New(pIsolate, has));
+	PooledIsolate* pPooledIso = PooledIsolate::fromIsolate(pIsolate);
+	poco_check_ptr (pPooledIso);
+	v8::Persistent<v8::ObjectTemplate>& pooledObjectTemplate(pPooledIso->objectTemplate("Core.Configuration"));
+	if (pooledObjectTemplate.IsEmpty())
+	{
+		v8::Handle<v8::ObjectTemplate> objectTemplate = v8::ObjectTemplate::New();
+		objectTemplate->SetInternalFieldCount(1);
+		objectTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getInt"), v8::FunctionTemplate::New(pIsolate, getInt));
+		objectTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getDouble"), v8::FunctionTemplate::New(pIsolate, getDouble));
+		objectTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getBool"), v8::FunctionTemplate::New(pIsolate, getBool));
+		objectTemplate->Set(v8::String::NewFromUtf8(pIsolate, "getString"), v8::FunctionTemplate::New(pIsolate, getString));
+		objectTemplate->Set(v8::String::NewFromUtf8(pIsolate, "has"), v8::FunctionTemplate::New(pIsolate, has));
+		pooledObjectTemplate.Reset(pIsolate, objectTemplate);
+	}
+	v8::Local<v8::ObjectTemplate> configurationTemplate = v8::Local<v8::ObjectTemplate>::New(pIsolate, pooledObjectTemplate);
 	return handleScope.Escape(configurationTemplate);
 }
 	
@@ -0,0 +1,183 @@
+//
+// IsolatePool.cpp
+//
+// $Id: //poco/1.4/JS/Core/src/IsolatePool.cpp#1 $
+//
+// Library: JSCore
+// Package: JSCore
+// Module:  IsolatePool
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "Poco/JS/Core/IsolatePool.h"
+#include <memory>
+
+
+namespace Poco {
+namespace JS {
+namespace Core {
+
+
+//
+// PooledIsolateFactory
+//
+
+
+PooledIsolateFactory::PooledIsolateFactory(IsolatePool& pool):
+	_pPool(&pool)
+{
+}
+
+
+PooledIsolate* PooledIsolateFactory::createObject()
+{
+	std::auto_ptr<PooledIsolate> pPooledIso(new PooledIsolate(_pPool->memoryLimit()));
+	_pPool->instantiateTemplates(pPooledIso.get());
+	return pPooledIso.release();
+}
+
+
+bool PooledIsolateFactory::validateObject(PooledIsolate* pPooledIso)
+{
+	return true;
+}
+
+
+void PooledIsolateFactory::activateObject(PooledIsolate* pPooledIso)
+{
+}
+
+
+void PooledIsolateFactory::deactivateObject(PooledIsolate* pPooledIso)
+{
+	try
+	{
+		pPooledIso->reset();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void PooledIsolateFactory::destroyObject(PooledIsolate* pPooledIso)
+{
+	delete pPooledIso;
+}
+
+
+//
+// IsolatePool
+//
+
+
+IsolatePool::Ptr IsolatePool::_pDefaultPool;
+Poco::FastMutex IsolatePool::_defaultPoolMutex;
+
+
+IsolatePool::IsolatePool(Poco::UInt64 memoryLimit, std::size_t capacity, std::size_t peakCapacity):
+	_memoryLimit(memoryLimit),
+	_pool(PooledIsolateFactory(*this), capacity, peakCapacity)
+{
+}
+
+
+IsolatePool::~IsolatePool()
+{
+}
+
+
+void IsolatePool::registerWrapper(WrapperPtr pWrapper)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_wrappers.push_back(pWrapper);
+}
+
+
+void IsolatePool::prestart(std::size_t count)
+{
+	if (count > _pool.capacity()) count = _pool.capacity();
+
+	std::vector<PooledIsolate*> isolates;
+	try
+	{
+		while (isolates.size() < count)
+		{
+			PooledIsolate* pPooledIso = _pool.borrowObject();
+			if (!pPooledIso) break;
+			isolates.push_back(pPooledIso);
+		}
+	}
+	catch (...)
+	{
+		for (std::vector<PooledIsolate*>::iterator it = isolates.begin(); it != isolates.end(); ++it)
+		{
+			_pool.returnObject(*it);
+		}
+		throw;
+	}
+	for (std::vector<PooledIsolate*>::iterator it = isolates.begin(); it != isolates.end(); ++it)
+	{
+		_pool.returnObject(*it);
+	}
+}
+
+
+PooledIsolate* IsolatePool::borrowIsolate()
+{
+	return _pool.borrowObject();
+}
+
+
+void IsolatePool::returnIsolate(PooledIsolate* pPooledIso)
+{
+	_pool.returnObject(pPooledIso);
+}
+
+
+void IsolatePool::instantiateTemplates(PooledIsolate* pPooledIso)
+{
+	WrapperVec wrappers;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		wrappers = _wrappers;
+	}
+
+	// Creating the first context also sets up the isolate's heap
+	// and builtins, which is the bulk of the isolate startup cost.
+	v8::Isolate* pIsolate = pPooledIso->isolate();
+	v8::Isolate::Scope isoScope(pIsolate);
+	v8::HandleScope handleScope(pIsolate);
+	v8::Local<v8::Context> context = v8::Context::New(pIsolate);
+	v8::Context::Scope contextScope(context);
+	for (WrapperVec::iterator it = wrappers.begin(); it != wrappers.end(); ++it)
+	{
+		(*it)->objectTemplate(pIsolate);
+	}
+}
+
+
+IsolatePool::Ptr IsolatePool::defaultPool()
+{
+	Poco::FastMutex::ScopedLock lock(_defaultPoolMutex);
+
+	return _pDefaultPool;
+}
+
+
+void IsolatePool::setDefaultPool(Ptr pPool)
+{
+	Poco::FastMutex::ScopedLock lock(_defaultPoolMutex);
+
+	_pDefaultPool = pPool;
+}
+
+
+} } } // namespace Poco::JS::Core
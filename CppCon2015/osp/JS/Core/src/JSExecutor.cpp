@@ -21,6 +21,7 @@
 #include "Poco/JS/Core/ApplicationWrapper.h"
 #include "Poco/JS/Core/URIWrapper.h"
 #include "Poco/JS/Core/TimerWrapper.h"
+#include "Poco/JS/Core/ScriptCache.h"
 #include "Poco/Delegate.h"
 #include "Poco/URIStreamOpener.h"
 #include "Poco/StreamCopier.h"
@@ -43,8 +44,19 @@ Poco::ThreadLocal<JSExecutor*> JSExecutor::_pCurrentExecutor;
 JSExecutor::JSExecutor(const std::string& source, const Poco::URI& sourceURI, Poco::UInt64 memoryLimit):
 	_source(source),
 	_sourceURI(sourceURI),
-	_memoryLimit(memoryLimit)
+	_memoryLimit(memoryLimit),
+	_pIsolatePool(IsolatePool::defaultPool()),
+	_pPooledIso(0)
 {
+	if (_pIsolatePool && _pIsolatePool->memoryLimit() == memoryLimit)
+	{
+		_pPooledIso = _pIsolatePool->borrowIsolate();
+	}
+	if (!_pPooledIso)
+	{
+		_pIsolatePool = 0;
+		_pPooledIso = new PooledIsolate(memoryLimit);
+	}
 	_importStack.push_back(sourceURI);
 }
 
@@ -56,7 +68,15 @@ JSExecutor::~JSExecutor()
 	_globalContext.Reset();
 	_globalObject.Reset();
 	
-	WeakPersistentWrapperRegistry::cleanupIsolate(_pooledIso.isolate());
+	if (_pIsolatePool)
+	{
+		_pIsolatePool->returnIsolate(_pPooledIso);
+	}
+	else
+	{
+		WeakPersistentWrapperRegistry::cleanupIsolate(_pPooledIso->isolate());
+		delete _pPooledIso;
+	}
 }
 
 
@@ -73,16 +93,9 @@ void JSExecutor::stop()
 
 void JSExecutor::setup()
 {
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::HandleScope handleScope(pIsolate);
 
-	v8::ResourceConstraints resourceConstraints;
-	resourceConstraints.ConfigureDefaults(_memoryLimit, 1);
-	if (!v8::SetResourceConstraints(pIsolate, &resourceConstraints))
-	{
-		throw Poco::SystemException("cannot set resource constraints");
-	}
-
 	v8::Local<v8::Context> globalContext = v8::Context::New(pIsolate);
 	v8::Context::Scope globalContextScope(globalContext);
 	_globalContext.Reset(pIsolate, globalContext);
@@ -98,14 +111,11 @@ void JSExecutor::setup()
 
 void JSExecutor::compile()
 {
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::HandleScope handleScope(pIsolate);
 
-	v8::Local<v8::String> sourceURI = v8::String::NewFromUtf8(pIsolate, _sourceURI.toString().c_str());
-	v8::Local<v8::String> source = v8::String::NewFromUtf8(pIsolate, _source.c_str());
 	v8::TryCatch tryCatch;
-	v8::ScriptOrigin scriptOrigin(sourceURI);
-	v8::Local<v8::Script> script = v8::Script::Compile(source, &scriptOrigin);
+	v8::Local<v8::Script> script = compileScript(pIsolate, _source, _sourceURI.toString());
 	if (script.IsEmpty() || tryCatch.HasCaught())
 	{
 		reportError(tryCatch);
@@ -117,11 +127,48 @@ void JSExecutor::compile()
 }
 
 
+v8::Local<v8::Script> JSExecutor::compileScript(v8::Isolate* pIsolate, const std::string& source, const std::string& uri)
+{
+	ScriptCache& scriptCache = ScriptCache::instance();
+	std::string hash = ScriptCache::contentHash(source);
+	ScriptCache::EntryPtr pEntry = scriptCache.find(uri, hash);
+
+	// pEntry keeps the cached data alive until compilation is complete
+	v8::ScriptCompiler::CachedData* pCachedData = 0;
+	v8::ScriptCompiler::CompileOptions options = v8::ScriptCompiler::kNoCompileOptions;
+	if (!pEntry)
+	{
+		options = v8::ScriptCompiler::kProduceDataToCache;
+	}
+	else if (!pEntry->data.empty())
+	{
+		pCachedData = new v8::ScriptCompiler::CachedData(reinterpret_cast<const uint8_t*>(pEntry->data.data()), static_cast<int>(pEntry->data.size()), v8::ScriptCompiler::CachedData::BufferNotOwned);
+	}
+
+	v8::ScriptOrigin scriptOrigin(v8::String::NewFromUtf8(pIsolate, uri.c_str()));
+	v8::ScriptCompiler::Source scriptSource(v8::String::NewFromUtf8(pIsolate, source.c_str()), scriptOrigin, pCachedData);
+	v8::Local<v8::Script> script = v8::ScriptCompiler::Compile(pIsolate, &scriptSource, options);
+	if (!script.IsEmpty() && options == v8::ScriptCompiler::kProduceDataToCache)
+	{
+		// An entry without data is added if V8 did not produce any data
+		// (e.g., for small scripts), so we don't try again with every compile.
+		std::string data;
+		const v8::ScriptCompiler::CachedData* pProducedData = scriptSource.GetCachedData();
+		if (pProducedData && pProducedData->data && pProducedData->length > 0)
+		{
+			data.assign(reinterpret_cast<const char*>(pProducedData->data), pProducedData->length);
+		}
+		scriptCache.add(uri, hash, data);
+	}
+	return script;
+}
+
+
 void JSExecutor::runImpl()
 {
 	*_pCurrentExecutor = this;
 	
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::Isolate::Scope isoScope(pIsolate);
 	v8::HandleScope handleScope(pIsolate);
 
@@ -171,7 +218,7 @@ void JSExecutor::run()
 
 void JSExecutor::call(v8::Handle<v8::Function>& function, v8::Handle<v8::Value>& receiver, int argc, v8::Handle<v8::Value> argv[])
 {
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::Isolate::Scope isoScope(pIsolate);
 	v8::HandleScope handleScope(pIsolate);
 
@@ -195,7 +242,7 @@ void JSExecutor::callInContext(v8::Handle<v8::Function>& function, v8::Handle<v8
 
 void JSExecutor::call(v8::Persistent<v8::Object>& jsObject, const std::string& method, const std::string& args)
 {
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::Isolate::Scope isoScope(pIsolate);
 	v8::HandleScope handleScope(pIsolate);
 
@@ -229,7 +276,7 @@ void JSExecutor::call(v8::Persistent<v8::Object>& jsObject, const std::string& m
 
 void JSExecutor::call(v8::Persistent<v8::Function>& function)
 {
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::Isolate::Scope isoScope(pIsolate);
 	v8::HandleScope handleScope(pIsolate);
 
@@ -251,7 +298,7 @@ void JSExecutor::call(v8::Persistent<v8::Function>& function)
 
 void JSExecutor::includeScript(const std::string& uri)
 {
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::HandleScope handleScope(pIsolate);
 
 	v8::Local<v8::Context> context(v8::Local<v8::Context>::New(pIsolate, _scriptContext));
@@ -262,11 +309,8 @@ void JSExecutor::includeScript(const std::string& uri)
 	std::string source;
 	Poco::StreamCopier::copyToString(*istr, source);
 
-	v8::Local<v8::String> sourceURI = v8::String::NewFromUtf8(pIsolate, includeURI.toString().c_str());
-	v8::Local<v8::String> sourceObject = v8::String::NewFromUtf8(pIsolate, source.c_str());
 	v8::TryCatch tryCatch;
-	v8::ScriptOrigin scriptOrigin(sourceURI);
-	v8::Local<v8::Script> scriptObject = v8::Script::Compile(sourceObject, &scriptOrigin);
+	v8::Local<v8::Script> scriptObject = compileScript(pIsolate, source, includeURI.toString());
 	if (scriptObject.IsEmpty() || tryCatch.HasCaught())
 	{
 		reportError(tryCatch);
@@ -435,7 +479,7 @@ void JSExecutor::importModule(const v8::FunctionCallbackInfo<v8::Value>& args, c
 	std::string moduleURIString = moduleURI.toString();
 
 	// Set up import context	
-	v8::Isolate* pIsolate = _pooledIso.isolate();
+	v8::Isolate* pIsolate = _pPooledIso->isolate();
 	v8::EscapableHandleScope handleScope(pIsolate);
 
 	v8::Local<v8::Context> scriptContext(v8::Local<v8::Context>::New(pIsolate, _scriptContext));
@@ -475,10 +519,8 @@ void JSExecutor::importModule(const v8::FunctionCallbackInfo<v8::Value>& args, c
 		std::auto_ptr<std::istream> istr(Poco::URIStreamOpener::defaultOpener().open(moduleURIString));
 		Poco::StreamCopier::copyToString(*istr, source);
 
-		v8::Local<v8::String> sourceObject = v8::String::NewFromUtf8(pIsolate, source.c_str());
 		v8::TryCatch tryCatch;
-		v8::ScriptOrigin scriptOrigin(jsModuleURI);
-		v8::Local<v8::Script> scriptObject = v8::Script::Compile(sourceObject, &scriptOrigin);
+		v8::Local<v8::Script> scriptObject = compileScript(pIsolate, source, moduleURIString);
 		if (scriptObject.IsEmpty() || tryCatch.HasCaught())
 		{
 			args.GetReturnValue().Set(tryCatch.ReThrow());
@@ -15,6 +15,7 @@
 
 
 #include "Poco/JS/Core/PooledIsolate.h"
+#include "Poco/JS/Core/Wrapper.h"
 #include "Poco/Exception.h"
 
 
@@ -24,12 +25,29 @@ namespace Core {
 
 
 PooledIsolate::PooledIsolate():
-	_pIsolate(v8::Isolate::New())
+	_pIsolate(v8::Isolate::New()),
+	_memoryLimit(0)
 {
 	_pIsolate->SetData(0, this);
 }
 
 
+PooledIsolate::PooledIsolate(Poco::UInt64 memoryLimit):
+	_pIsolate(v8::Isolate::New()),
+	_memoryLimit(memoryLimit)
+{
+	_pIsolate->SetData(0, this);
+
+	v8::ResourceConstraints resourceConstraints;
+	resourceConstraints.ConfigureDefaults(_memoryLimit, 1);
+	if (!v8::SetResourceConstraints(_pIsolate, &resourceConstraints))
+	{
+		_pIsolate->Dispose();
+		throw Poco::SystemException("cannot set resource constraints");
+	}
+}
+
+
 PooledIsolate::~PooledIsolate()
 {
 	try
@@ -54,6 +72,15 @@ PooledIsolate* PooledIsolate::fromIsolate(v8::Isolate* pIsolate)
 }
 
 
+void PooledIsolate::reset()
+{
+	WeakPersistentWrapperRegistry::cleanupIsolate(_pIsolate);
+
+	v8::Isolate::Scope isoScope(_pIsolate);
+	v8::V8::ContextDisposedNotification();
+}
+
+
 v8::Persistent<v8::ObjectTemplate>& PooledIsolate::objectTemplate(const std::string& name)
 {
 	return _objectTemplates[name].content();
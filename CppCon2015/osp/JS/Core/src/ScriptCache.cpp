@@ -0,0 +1,242 @@
+//
+// ScriptCache.cpp
+//
+// $Id: //poco/1.4/JS/Core/src/ScriptCache.cpp#1 $
+//
+// Library: JSCore
+// Package: JSCore
+// Module:  ScriptCache
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "Poco/JS/Core/ScriptCache.h"
+#include "Poco/SHA1Engine.h"
+#include "Poco/DigestEngine.h"
+#include "Poco/BinaryReader.h"
+#include "Poco/BinaryWriter.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include "Poco/Process.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/SingletonHolder.h"
+#include "Poco/Exception.h"
+#include "v8.h"
+
+
+namespace Poco {
+namespace JS {
+namespace Core {
+
+
+namespace
+{
+	const Poco::UInt32 FILE_MAGIC = 0x4A534331; // "JSC1"
+	const std::string FILE_EXTENSION("jsc");
+}
+
+
+ScriptCache::ScriptCache(std::size_t capacity):
+	_cache(static_cast<long>(capacity))
+{
+}
+
+
+ScriptCache::~ScriptCache()
+{
+}
+
+
+ScriptCache::EntryPtr ScriptCache::find(const std::string& uri, const std::string& hash)
+{
+	EntryPtr pEntry = _cache.get(uri);
+	if (pEntry)
+	{
+		return pEntry->hash == hash ? pEntry : EntryPtr();
+	}
+
+	Poco::Path path = pathFor(uri);
+	if (!path.getFileName().empty())
+	{
+		pEntry = load(path, uri);
+		if (pEntry && pEntry->hash == hash)
+		{
+			_cache.add(uri, pEntry);
+			return pEntry;
+		}
+	}
+	return EntryPtr();
+}
+
+
+void ScriptCache::add(const std::string& uri, const std::string& hash, const std::string& data)
+{
+	EntryPtr pEntry = new Entry;
+	pEntry->hash = hash;
+	pEntry->data = data;
+	_cache.update(uri, pEntry);
+
+	Poco::Path path = pathFor(uri);
+	if (!path.getFileName().empty())
+	{
+		try
+		{
+			store(path, uri, *pEntry);
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
+}
+
+
+void ScriptCache::remove(const std::string& uri)
+{
+	_cache.remove(uri);
+
+	Poco::Path path = pathFor(uri);
+	if (!path.getFileName().empty())
+	{
+		try
+		{
+			Poco::File file(path);
+			if (file.exists()) file.remove();
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
+}
+
+
+void ScriptCache::clear()
+{
+	_cache.clear();
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (!_persistencyDir.toString().empty())
+	{
+		Poco::File dir(_persistencyDir);
+		if (dir.exists())
+		{
+			dir.remove(true);
+			dir.createDirectories();
+		}
+	}
+}
+
+
+void ScriptCache::setPersistencyDirectory(const std::string& path)
+{
+	Poco::Path dirPath;
+	if (!path.empty())
+	{
+		dirPath = path;
+		dirPath.makeDirectory();
+		Poco::File dir(dirPath);
+		dir.createDirectories();
+	}
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_persistencyDir = dirPath;
+}
+
+
+std::string ScriptCache::getPersistencyDirectory() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _persistencyDir.toString();
+}
+
+
+std::string ScriptCache::contentHash(const std::string& source)
+{
+	Poco::SHA1Engine sha1;
+	sha1.update(source);
+	return Poco::DigestEngine::digestToHex(sha1.digest());
+}
+
+
+Poco::Path ScriptCache::pathFor(const std::string& uri) const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	Poco::Path path(_persistencyDir);
+	if (!path.toString().empty())
+	{
+		path.setFileName(contentHash(uri));
+		path.setExtension(FILE_EXTENSION);
+	}
+	return path;
+}
+
+
+ScriptCache::EntryPtr ScriptCache::load(const Poco::Path& path, const std::string& uri) const
+{
+	try
+	{
+		Poco::FileInputStream istr(path.toString());
+		Poco::BinaryReader reader(istr, Poco::BinaryReader::LITTLE_ENDIAN_BYTE_ORDER);
+		Poco::UInt32 magic;
+		std::string version;
+		std::string fileURI;
+		EntryPtr pEntry = new Entry;
+		reader >> magic >> version >> fileURI >> pEntry->hash >> pEntry->data;
+		if (reader.good() && magic == FILE_MAGIC && version == v8::V8::GetVersion() && fileURI == uri)
+		{
+			return pEntry;
+		}
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	return EntryPtr();
+}
+
+
+void ScriptCache::store(const Poco::Path& path, const std::string& uri, const Entry& entry) const
+{
+	// Write to a temporary file first, then rename, so that a concurrent
+	// load() never sees a partially written file.
+	Poco::Path tempPath(path);
+	tempPath.setExtension(Poco::NumberFormatter::format(Poco::Process::id()) + "." + Poco::NumberFormatter::formatHex(reinterpret_cast<Poco::UIntPtr>(&entry)));
+	{
+		Poco::FileOutputStream ostr(tempPath.toString());
+		Poco::BinaryWriter writer(ostr, Poco::BinaryWriter::LITTLE_ENDIAN_BYTE_ORDER);
+		writer << FILE_MAGIC << std::string(v8::V8::GetVersion()) << uri << entry.hash << entry.data;
+		writer.flush();
+		if (!writer.good()) throw Poco::WriteFileException(tempPath.toString());
+	}
+	Poco::File tempFile(tempPath);
+	try
+	{
+		tempFile.renameTo(path.toString());
+	}
+	catch (...)
+	{
+		tempFile.remove();
+		throw;
+	}
+}
+
+
+namespace
+{
+	static Poco::SingletonHolder<ScriptCache> sh;
+}
+
+
+ScriptCache& ScriptCache::instance()
+{
+	return *sh.get();
+}
+
+
+} } } // namespace Poco::JS::Core
@@ -15,6 +15,7 @@
 
 
 #include "Poco/JS/Core/URIWrapper.h"
+#include "Poco/JS/Core/PooledIsolate.h"
 #include "Poco/URIStreamOpener.h"
 #include "Poco/StreamCopier.h"
 #include <memory>
@@ -38,8 +39,16 @@ URIWrapper::~URIWrapper()
 v8::Handle<v8::ObjectTemplate> URIWrapper::objectTemplate(v8::Isolate* pIsolate)
 {
 	v8::EscapableHandleScope handleScope(pIsolate);
-	v8::Local<v8::ObjectTemplate> configurationTemplate = v8::ObjectTemplate::New();
-	configurationTemplate->Set(v8::String::NewFromUtf8(pIsolate, "loadString"), v8::FunctionTemplate::New(pIsolate, loadString));
+	PooledIsolate* pPooledIso = PooledIsolate::fromIsolate(pIsolate);
+	poco_check_ptr (pPooledIso);
+	v8::Persistent<v8::ObjectTemplate>& pooledObjectTemplate(pPooledIso->objectTemplate("Core.URI"));
+	if (pooledObjectTemplate.IsEmpty())
+	{
+		v8::Handle<v8::ObjectTemplate> objectTemplate = v8::ObjectTemplate::New();
+		objectTemplate->Set(v8::String::NewFromUtf8(pIsolate, "loadString"), v8::FunctionTemplate::New(pIsolate, loadString));
+		pooledObjectTemplate.Reset(pIsolate, objectTemplate);
+	}
+	v8::Local<v8::ObjectTemplate> configurationTemplate = v8::Local<v8::ObjectTemplate>::New(pIsolate, pooledObjectTemplate);
 	return handleScope.Escape(configurationTemplate);
 }
 	
@@ -127,6 +127,14 @@ public:
 	void read(std::istream& istr);
 		/// Reads the HTTP request from the
 		/// given input stream.
+
+	const char* parse(const char* begin, const char* end);
+		/// Parses the HTTP request line and header from the
+		/// given character buffer, with the same semantics as read().
+		/// See MessageHeader::parse() for details.
+		///
+		/// Returns a pointer to the first character after the
+		/// empty line terminating the header, or end.
 		
 	static const std::string HTTP_GET;
 	static const std::string HTTP_HEAD;
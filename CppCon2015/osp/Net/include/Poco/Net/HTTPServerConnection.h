@@ -48,6 +48,11 @@ public:
 		
 	void run();
 		/// Handles all HTTP requests coming in.
+		///
+		/// If parking of idle connections is enabled
+		/// (see HTTPServerParams::setParkIdleConnections()),
+		/// returns, after parking the connection, as soon as 
+		/// the connection is waiting for the next request.
 
 protected:
 	void sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status);
@@ -56,6 +61,7 @@ protected:
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	HTTPServerSession* _pSession;
 	bool _stopped;
 	Poco::FastMutex _mutex;
 };
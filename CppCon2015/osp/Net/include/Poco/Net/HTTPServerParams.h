@@ -45,6 +45,7 @@ public:
 		///   - keepAlive:            true
 		///   - maxKeepAliveRequests: 0
 		///   - keepAliveTimeout:     10 seconds
+		///   - parkIdleConnections:  false
 		
 	void setServerName(const std::string& serverName);
 		/// Sets the name and port (name:port) that the server uses to identify itself.
@@ -97,6 +98,26 @@ public:
 		/// during a persistent connection, or 0 if
 		/// unlimited connections are allowed.
 
+	void setParkIdleConnections(bool park);
+		/// Enables (park == true) or disables (park == false) parking
+		/// of idle persistent connections.
+		///
+		/// If enabled, a persistent connection waiting for its 
+		/// next request does not occupy a server thread. Instead,
+		/// the connection is parked (see TCPServerConnection::park()) 
+		/// until the next request arrives, or the keep-alive timeout
+		/// expires. The number of server threads needed then depends 
+		/// on the number of requests being handled, not on the
+		/// number of open connections.
+		///
+		/// Note that with parking enabled, subsequent requests
+		/// on the same connection may be handled by different 
+		/// threads.
+
+	bool getParkIdleConnections() const;
+		/// Returns true iff parking of idle persistent connections
+		/// is enabled.
+
 protected:
 	virtual ~HTTPServerParams();
 		/// Destroys the HTTPServerParams.
@@ -108,6 +129,7 @@ private:
 	bool           _keepAlive;
 	int            _maxKeepAliveRequests;
 	Poco::Timespan _keepAliveTimeout;
+	bool           _parkIdleConnections;
 };
 
 
@@ -150,6 +172,12 @@ inline const Poco::Timespan& HTTPServerParams::getKeepAliveTimeout() const
 }
 
 
+inline bool HTTPServerParams::getParkIdleConnections() const
+{
+	return _parkIdleConnections;
+}
+
+
 } } // namespace Poco::Net
 
 
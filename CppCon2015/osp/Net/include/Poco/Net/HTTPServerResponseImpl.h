@@ -72,9 +72,26 @@ public:
 		/// Must not be called after send(), sendBuffer() 
 		/// or redirect() has been called.
 		///
+		/// If the request contains a Range header specifying
+		/// a single byte range (and a If-Range header, if present,
+		/// matches the ETag or Last-Modified header of the response),
+		/// and the response status is 200 (OK), a 206 (Partial Content) 
+		/// response containing only the requested range is sent. 
+		/// If the requested range cannot be satisfied, a 416 
+		/// (Requested Range Not Satisfiable) response is sent.
+		///
+		/// On Linux, the file content is sent with sendfile()
+		/// (or splice(), if sendfile() is not available) 
+		/// if the connection is not secure, avoiding copying
+		/// the file content through user space.
+		///
 		/// Throws a FileNotFoundException if the file
 		/// cannot be found, or an OpenFileException if
-		/// the file cannot be opened.
+		/// the file cannot be opened. Throws a ReadFileException
+		/// if the file has been truncated and ends before the
+		/// response body is complete. As the response header
+		/// has already been sent in this case, the connection
+		/// must be closed.
 		
 	void sendBuffer(const void* pBuffer, std::size_t length);
 		/// Sends the response header to the client, followed
@@ -112,6 +129,18 @@ protected:
 	void attachRequest(HTTPServerRequestImpl* pRequest);
 	
 private:
+	enum RangeResult
+	{
+		RANGE_NONE,          /// no or unsupported Range header; send the entire file
+		RANGE_OK,            /// send the given range
+		RANGE_UNSATISFIABLE  /// the requested range is outside of the file
+	};
+	
+	RangeResult parseRange(Poco::UInt64 length, Poco::UInt64& first, Poco::UInt64& last) const;
+		/// Checks the Range and If-Range header fields of the request
+		/// and determines the byte range of a file of the given length
+		/// to send.
+
 	HTTPServerSession& _session;
 	HTTPServerRequestImpl* _pRequest;
 	std::ostream*      _pStream;
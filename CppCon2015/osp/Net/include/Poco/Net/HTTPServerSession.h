@@ -32,6 +32,9 @@ namespace Poco {
 namespace Net {
 
 
+class HTTPRequest;
+
+
 class Net_API HTTPServerSession: public HTTPSession
 	/// This class handles the server side of a
 	/// HTTP session. It is used internally by
@@ -49,6 +52,27 @@ public:
 	
 	bool canKeepAlive() const;
 		/// Returns true if the session can be kept alive.
+
+	bool canPark();
+		/// Returns true if the session is waiting for the next request
+		/// on a persistent connection, and no data belonging to that
+		/// request has been received yet. In that case, the connection
+		/// can be parked (see TCPServerConnection::park()) until
+		/// the next request arrives.
+	
+	bool parseRequest(HTTPRequest& request);
+		/// Parses the next request line and header directly from
+		/// the session's receive buffer, using HTTPRequest::parse().
+		///
+		/// This is only possible if the complete header has been
+		/// received with a single read from the socket, which is the
+		/// case for the vast majority of requests. Returns false, without
+		/// removing anything from the buffer, if this is not the case,
+		/// or if no more data can be received. The request must then be
+		/// read from a HTTPHeaderInputStream instead.
+		///
+		/// Returns true and removes the header from the buffer if
+		/// the request has been parsed.
 	
 	SocketAddress clientAddress();
 		/// Returns the client's address.
@@ -148,6 +148,15 @@ protected:
 	int buffered() const;
 		/// Returns the number of bytes in the buffer.
 
+	const char* bufferedData() const;
+		/// Returns a pointer to the data in the buffer.
+		/// The number of bytes available is returned
+		/// by buffered().
+
+	void skipBuffered(int n);
+		/// Removes the first n bytes, which must not be
+		/// more than buffered(), from the buffer.
+
 	void refill();
 		/// Refills the internal buffer.
 		
@@ -226,6 +235,20 @@ inline int HTTPSession::buffered() const
 }
 
 
+inline const char* HTTPSession::bufferedData() const
+{
+	return _pCurrent;
+}
+
+
+inline void HTTPSession::skipBuffered(int n)
+{
+	poco_assert_dbg (n >= 0 && n <= buffered());
+
+	_pCurrent += n;
+}
+
+
 inline const Poco::Any& HTTPSession::sessionData() const
 {
 	return _data;
@@ -88,6 +88,23 @@ public:
 		///
 		/// Throws a MessageException if the input stream is
 		/// malformed.
+
+	const char* parse(const char* begin, const char* end);
+		/// Parses the message header from the given character
+		/// buffer, with the same format, semantics and limits
+		/// as read(). The end of the buffer is treated like
+		/// the end of the stream.
+		///
+		/// Instead of extracting the header character by character
+		/// from a stream, the buffer is scanned for line and field
+		/// delimiters, and names and values are copied in one piece,
+		/// which is considerably faster.
+		///
+		/// Returns a pointer to the first character not belonging
+		/// to the header, which is the start of the empty line
+		/// terminating the header, or end.
+		///
+		/// Throws a MessageException if the buffer is malformed.
 		
 	int getFieldLimit() const;
 		/// Returns the maximum number of header fields
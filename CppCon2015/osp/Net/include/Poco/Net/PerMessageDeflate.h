@@ -0,0 +1,195 @@
+//
+// PerMessageDeflate.h
+//
+// $Id$
+//
+// Library: Net
+// Package: WebSocket
+// Module:  PerMessageDeflate
+//
+// Definition of the PerMessageDeflate class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_PerMessageDeflate_INCLUDED
+#define Net_PerMessageDeflate_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Buffer.h"
+#if defined(POCO_UNBUNDLED)
+#include <zlib.h>
+#else
+#include "Poco/zlib.h"
+#endif
+
+
+namespace Poco {
+namespace Net {
+
+
+class NameValueCollection;
+
+
+class Net_API PerMessageDeflate
+	/// This class implements the permessage-deflate WebSocket
+	/// extension (compression of message payloads), according to RFC 7692.
+	///
+	/// The extension is enabled by passing a PerMessageDeflate::Params
+	/// object to the WebSocket constructor. WebSocket then negotiates
+	/// the extension with the peer during the opening handshake, and
+	/// WebSocketImpl uses a PerMessageDeflate object with the negotiated
+	/// parameters to compress outgoing and decompress incoming messages.
+	/// The compressor and decompressor state is kept for the lifetime of
+	/// the connection, unless "no context takeover" has been negotiated
+	/// for the respective direction, so that messages repeating content
+	/// of earlier messages (like JSON objects with the same structure)
+	/// compress very well.
+	///
+	/// Only messages sent with a single frame (flag FRAME_FLAG_FIN
+	/// set) are compressed. Received messages are decompressed regardless
+	/// of the number of frames they consist of.
+{
+public:
+	struct Net_API Params
+		/// Parameters of the permessage-deflate extension.
+	{
+		Params();
+			/// Creates the Params with default values: context takeover
+			/// enabled in both directions, maximum window sizes,
+			/// default compression level and a minimum message size
+			/// of 64 bytes.
+
+		bool serverNoContextTakeover;
+			/// If true, the server resets the compressor after every message.
+
+		bool clientNoContextTakeover;
+			/// If true, the client resets the compressor after every message.
+
+		int serverMaxWindowBits;
+			/// The base-2 logarithm of the LZ77 window size used by the
+			/// server's compressor (9 - 15).
+
+		int clientMaxWindowBits;
+			/// The base-2 logarithm of the LZ77 window size used by the
+			/// client's compressor (9 - 15).
+
+		int compressionLevel;
+			/// The zlib compression level (0 - 9, or -1 for the default level).
+			/// Not negotiated.
+
+		int minMessageSize;
+			/// Messages smaller than the given size are sent uncompressed,
+			/// as compression does not pay off for them. Not negotiated.
+	};
+
+	enum
+	{
+		MIN_WINDOW_BITS = 9,
+			/// RFC 7692 also allows a window size of 8 bits,
+			/// which zlib's deflate does not support.
+		MAX_WINDOW_BITS = 15
+	};
+
+	static const std::string EXTENSION_NAME;
+		/// The name of the extension ("permessage-deflate").
+
+	PerMessageDeflate(const Params& params, bool server);
+		/// Creates the PerMessageDeflate, using the given (negotiated)
+		/// parameters for the server side or the client side of the
+		/// connection.
+
+	~PerMessageDeflate();
+		/// Destroys the PerMessageDeflate.
+
+	bool mustCompress(int length) const;
+		/// Returns true if a message with the given length should be
+		/// compressed.
+
+	void deflate(const char* data, int length, Poco::Buffer<char>& compressed);
+		/// Compresses the given message payload and stores the compressed
+		/// payload in compressed, which is resized accordingly.
+
+	void inflate(const char* data, int length, bool final, Poco::Buffer<char>& payload, int maxLength);
+		/// Decompresses the given (part of a) compressed message payload,
+		/// and appends the result to payload. final must be true
+		/// for the last frame of a message.
+		///
+		/// The payload buffer grows as decompressed data becomes
+		/// available, but by no more than maxLength bytes, so that
+		/// a small compressed message cannot exhaust memory.
+		///
+		/// Throws a WebSocketException if the decompressed data is longer
+		/// than maxLength (WS_ERR_PAYLOAD_TOO_BIG), or if the data is invalid.
+
+	int inflate(const char* data, int length, bool final, char* payload, int maxLength);
+		/// Decompresses the given (part of a) compressed message payload,
+		/// and stores the result in payload. final must be true
+		/// for the last frame of a message.
+		///
+		/// Returns the number of bytes stored in payload. Throws
+		/// a WebSocketException if the decompressed payload is longer
+		/// than maxLength, or if the data is invalid.
+
+	static std::string offer(const Params& params);
+		/// Returns the value of the Sec-WebSocket-Extensions header
+		/// of a client's handshake request, which offers the extension
+		/// with the given parameters to the server.
+
+	static bool accept(const std::string& offers, const Params& params, Params& negotiated, std::string& response);
+		/// Used by the server to accept the first acceptable offer
+		/// of the extension in the Sec-WebSocket-Extensions header (offers)
+		/// of a client's handshake request, taking into account the
+		/// server's own parameters.
+		///
+		/// If an offer is acceptable, stores the resulting parameters
+		/// in negotiated, stores the value for the Sec-WebSocket-Extensions
+		/// header of the handshake response in response, and returns true.
+		/// Otherwise, returns false.
+
+	static bool confirm(const std::string& response, const Params& params, Params& negotiated);
+		/// Used by the client to process the Sec-WebSocket-Extensions header
+		/// of the server's handshake response, after offering the extension
+		/// with the given parameters.
+		///
+		/// Returns true and stores the resulting parameters in negotiated if
+		/// the server has accepted the extension, or false if not.
+		/// Throws a WebSocketException if the server's response is invalid.
+
+protected:
+	void inflateData(const char* data, int length, Poco::Buffer<char>& payload, std::size_t maxSize);
+	int inflateData(const char* data, int length, char* payload, int maxLength);
+	void endInflate();
+	static bool parseParams(const NameValueCollection& params, bool response, Params& result, bool& clientMaxWindowBits);
+
+private:
+	PerMessageDeflate();
+	PerMessageDeflate(const PerMessageDeflate&);
+	PerMessageDeflate& operator = (const PerMessageDeflate&);
+
+	z_stream _deflateStream;
+	z_stream _inflateStream;
+	bool _deflateReset;
+	bool _inflateReset;
+	int _minMessageSize;
+};
+
+
+//
+// inlines
+//
+inline bool PerMessageDeflate::mustCompress(int length) const
+{
+	return length >= _minMessageSize;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_PerMessageDeflate_INCLUDED
@@ -0,0 +1,130 @@
+//
+// PollSet.h
+//
+// $Id: //poco/1.6/Net/include/Poco/Net/PollSet.h#1 $
+//
+// Library: Net
+// Package: Sockets
+// Module:  PollSet
+//
+// Definition of the PollSet class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_PollSet_INCLUDED
+#define Net_PollSet_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/Socket.h"
+#include <map>
+
+
+namespace Poco {
+namespace Net {
+
+
+class PollSetImpl;
+
+
+class Net_API PollSet
+	/// A set of sockets that can be efficiently polled as a whole.
+	///
+	/// In contrast to Socket::select(), which has to pass all sockets
+	/// to the operating system with every call, a PollSet keeps its
+	/// state between calls to poll(). Sockets are registered once
+	/// with add(), their event mask is changed with update() and they
+	/// are unregistered with remove().
+	///
+	/// If supported (POCO_HAVE_FD_EPOLL), PollSet is implemented using
+	/// a single epoll instance, and the cost of a call to poll() is
+	/// proportional to the number of ready sockets, not to the
+	/// number of registered sockets. Otherwise, poll() (POCO_HAVE_FD_POLL)
+	/// or select() is used.
+	///
+	/// All member functions except poll() can be called from different
+	/// threads. poll() must only be called from one thread at a time.
+	/// With the epoll implementation, sockets added, updated or removed
+	/// while another thread is blocked in poll() take effect immediately.
+	/// With the other implementations, changes take effect with the next
+	/// call to poll().
+{
+public:
+	enum Mode
+	{
+		POLL_READ  = Socket::SELECT_READ,
+		POLL_WRITE = Socket::SELECT_WRITE,
+		POLL_ERROR = Socket::SELECT_ERROR,
+		POLL_EDGE  = 0x08
+			/// Request edge-triggered notification for the socket.
+			/// Only supported by the epoll implementation, ignored
+			/// otherwise.
+	};
+
+	typedef std::map<Poco::Net::Socket, int> SocketModeMap;
+
+	PollSet();
+		/// Creates an empty PollSet.
+
+	~PollSet();
+		/// Destroys the PollSet.
+
+	void add(const Poco::Net::Socket& socket, int mode);
+		/// Adds the given socket to the set, for polling with
+		/// the given mode, which is a combination of Mode values.
+		///
+		/// If the socket is already in the set, its mode is updated.
+
+	void remove(const Poco::Net::Socket& socket);
+		/// Removes the given socket from the set.
+		///
+		/// Does nothing if the socket is not in the set.
+
+	void update(const Poco::Net::Socket& socket, int mode);
+		/// Updates the mode of the given socket.
+		///
+		/// Throws a NotFoundException if the socket is not in the set.
+
+	bool has(const Poco::Net::Socket& socket) const;
+		/// Returns true if the given socket is in the set.
+
+	bool empty() const;
+		/// Returns true if no socket is in the set.
+
+	std::size_t count() const;
+		/// Returns the number of sockets in the set.
+
+	void clear();
+		/// Removes all sockets from the set.
+
+	SocketModeMap poll(const Poco::Timespan& timeout);
+		/// Waits until the state of at least one of the sockets in
+		/// the set changes accordingly to its mode, or the timeout
+		/// expires.
+		///
+		/// Returns a map containing the sockets that are ready,
+		/// together with their ready state (a combination of POLL_READ,
+		/// POLL_WRITE and POLL_ERROR). The map is empty if the timeout
+		/// expired, or if the set is empty.
+		///
+		/// A hang-up condition on a socket is reported as POLL_READ,
+		/// so that the subsequent read operation can detect the
+		/// closed connection.
+
+private:
+	PollSet(const PollSet&);
+	PollSet& operator = (const PollSet&);
+
+	PollSetImpl* _pImpl;
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_PollSet_INCLUDED
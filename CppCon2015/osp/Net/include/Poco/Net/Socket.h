@@ -280,6 +280,10 @@ public:
 		/// Returns true iff the socket's connection is secure
 		/// (using SSL or TLS).
 		
+	static SocketBuf makeBuffer(void* buffer, std::size_t length);
+		/// Creates and returns a SocketBuf for use with
+		/// SocketImpl::sendBytes(const SocketBufVec&, int).
+
 	static bool supportsIPv4();
 		/// Returns true if the system supports IPv4.
 		
@@ -605,6 +609,20 @@ inline bool Socket::secure() const
 }
 
 
+inline SocketBuf Socket::makeBuffer(void* buffer, std::size_t length)
+{
+	SocketBuf buf;
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	buf.buf = reinterpret_cast<char*>(buffer);
+	buf.len = static_cast<ULONG>(length);
+#else
+	buf.iov_base = buffer;
+	buf.iov_len = length;
+#endif
+	return buf;
+}
+
+
 inline bool Socket::supportsIPv4()
 {
 	return true;
@@ -83,6 +83,7 @@
 	#include <resolvLib.h>
 	#include <types.h>
 	#include <socket.h>
+	#include <sys/uio.h>
 	#include <netinet/tcp.h>
 	#define POCO_INVALID_SOCKET  -1
 	#define poco_socket_t        int
@@ -144,6 +145,7 @@
 	#else
 		#include <arpa/inet.h>
 	#endif
+	#include <sys/uio.h>
 	#include <netinet/in.h>
 	#include <netinet/tcp.h>
 	#include <netdb.h>
@@ -348,4 +350,24 @@
 #endif
 
 
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	typedef WSABUF SocketBuf;
+#else
+	typedef iovec SocketBuf;
+#endif
+
+typedef std::vector<SocketBuf> SocketBufVec;
+	/// A vector of buffers for gathering writes (see SocketImpl::sendBytes()).
+
+
+} } // namespace Poco::Net
+
+
 #endif // Net_SocketDefs_INCLUDED
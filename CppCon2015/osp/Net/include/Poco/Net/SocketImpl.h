@@ -25,6 +25,7 @@
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/Timespan.h"
+#include "Poco/Buffer.h"
 
 
 namespace Poco {
@@ -135,6 +136,21 @@ public:
 		///
 		/// Certain socket implementations may also return a negative
 		/// value denoting a certain condition.
+
+	virtual int sendBytes(const SocketBufVec& buffers, int flags = 0);
+		/// Sends the contents of the given buffers through
+		/// the socket, using a single system call (sendmsg()
+		/// or WSASend()). This avoids copying data that is kept
+		/// in different buffers into a single buffer first.
+		///
+		/// Returns the number of bytes sent, which may be
+		/// less than the total number of bytes in the buffers.
+		///
+		/// Subclasses overriding sendBytes(const void*, int, int)
+		/// to transform the data must also override this method.
+		/// If each write results in a separate record or frame
+		/// (e.g., TLS), the override should combine the buffers 
+		/// (see gatherBuffers()) and send them with a single write.
 	
 	virtual int receiveBytes(void* buffer, int length, int flags = 0);
 		/// Receives data from the socket and stores it
@@ -401,6 +417,14 @@ protected:
 	void reset(poco_socket_t fd = POCO_INVALID_SOCKET);
 		/// Allows subclasses to set the socket manually, iff no valid socket is set yet.
 
+	static void gatherBuffers(const SocketBufVec& buffers, Poco::Buffer<char>& buffer);
+		/// Copies the contents of all given buffers, in order, 
+		/// into buffer, which is resized to their total length.
+		///
+		/// Can be used by subclasses overriding 
+		/// sendBytes(const SocketBufVec&, int) that must send 
+		/// the buffers with a single write.
+
 	static int lastError();
 		/// Returns the last error code.
 
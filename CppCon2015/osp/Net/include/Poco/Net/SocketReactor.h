@@ -22,6 +22,7 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/Socket.h"
+#include "Poco/Net/PollSet.h"
 #include "Poco/Runnable.h"
 #include "Poco/Timespan.h"
 #include "Poco/Observer.h"
@@ -71,7 +72,13 @@ class Net_API SocketReactor: public Poco::Runnable
 	/// as argument.
 	///
 	/// Once started, the SocketReactor waits for events
-	/// on the registered sockets, using Socket::select().
+	/// on the registered sockets, using a PollSet. The set of events
+	/// a socket is watched for is only updated in addEventHandler()
+	/// and removeEventHandler(), and only sockets that are actually
+	/// ready are dispatched. With the epoll-based PollSet implementation
+	/// (POCO_HAVE_FD_EPOLL), the cost of a wakeup is therefore
+	/// proportional to the number of ready sockets, not to the number
+	/// of registered sockets.
 	/// If an event is detected, the corresponding event handler
 	/// is invoked. There are five event types (and corresponding
 	/// notification classes) defined: ReadableNotification, WritableNotification,
@@ -90,7 +97,7 @@ class Net_API SocketReactor: public Poco::Runnable
 	/// timeout processing.
 	///
 	/// If there are no sockets for the SocketReactor to pass to
-	/// Socket::select(), an IdleNotification will be dispatched to
+	/// PollSet::poll(), an IdleNotification will be dispatched to
 	/// all event handlers registered for it. This is done in the
 	/// onIdle() method which can be overridden by subclasses
 	/// to perform custom idle processing. Since onIdle() will be
@@ -144,12 +151,28 @@ public:
 		///
 		/// The default timeout is 250 milliseconds;
 		///
-		/// The timeout is passed to the Socket::select()
+		/// The timeout is passed to the PollSet::poll()
 		/// method.
 		
 	const Poco::Timespan& getTimeout() const;
 		/// Returns the timeout.
 
+	void setEdgeTriggered(bool flag);
+		/// Enables or disables edge-triggered event notification.
+		///
+		/// In edge-triggered mode, a ReadableNotification or
+		/// WritableNotification is only dispatched when the state
+		/// of a socket changes, e.g. when new data arrives. Event handlers
+		/// must therefore read (or write) until the operation
+		/// would block, otherwise they will not be notified again.
+		///
+		/// Edge-triggered mode is only available with the epoll-based
+		/// PollSet implementation. On other platforms, the flag is ignored.
+		/// The default is level-triggered notification.
+
+	bool getEdgeTriggered() const;
+		/// Returns true if edge-triggered event notification is enabled.
+
 	void addEventHandler(const Socket& socket, const Poco::AbstractObserver& observer);
 		/// Registers an event handler with the SocketReactor.
 		///
@@ -176,7 +199,7 @@ protected:
 		/// implementations.
 
 	virtual void onIdle();
-		/// Called if no sockets are available to call select() on.
+		/// Called if no sockets are available to call poll() on.
 		///
 		/// Can be overridden by subclasses. The default implementation
 		/// dispatches the IdleNotification and thus should be called by overriding
@@ -209,6 +232,10 @@ private:
 	typedef std::map<Socket, NotifierPtr>     EventHandlerMap;
 
 	void dispatch(NotifierPtr& pNotifier, SocketNotification* pNotification);
+	void updateInterest(const Socket& socket, NotifierPtr& pNotifier);
+		/// Adds the socket to, removes it from, or updates its mode in,
+		/// the PollSet, according to the notifications accepted by
+		/// the socket's event handlers. Must be called with _mutex locked.
 
 	enum
 	{
@@ -218,6 +245,8 @@ private:
 	bool            _stop;
 	Poco::Timespan  _timeout;
 	EventHandlerMap _handlers;
+	PollSet         _pollSet;
+	bool            _edgeTriggered;
 	NotificationPtr _pReadableNotification;
 	NotificationPtr _pWritableNotification;
 	NotificationPtr _pErrorNotification;
@@ -136,6 +136,8 @@ public:
 		///
 		/// No new connections will be accepted.
 		/// Already handled connections will continue to be served.
+		/// Parked connections (see TCPServerConnection::park()) 
+		/// are closed.
 		///
 		/// Once the server has been stopped, it cannot be restarted.
 		
@@ -160,6 +162,10 @@ public:
 	int refusedConnections() const;
 		/// Returns the number of refused connections.
 
+	int parkedConnections() const;
+		/// Returns the number of parked connections.
+		/// See TCPServerConnection::park().
+
 	const ServerSocket& socket() const;
 		/// Returns the underlying server socket.
 
@@ -23,6 +23,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Runnable.h"
+#include "Poco/Timespan.h"
 
 
 namespace Poco {
@@ -62,12 +63,41 @@ protected:
 		/// Calls run() and catches any exceptions that
 		/// might be thrown by run().
 
+	void park(const Poco::Timespan& idleTimeout);
+		/// Can be called by run() to request that the connection
+		/// is parked, instead of being destroyed, once run() returns.
+		///
+		/// A parked connection does not occupy a thread. Instead,
+		/// TCPServer watches the connection's socket, and calls run() 
+		/// again, from one of its threads, as soon as data can be read 
+		/// from the socket, or the peer has closed the connection. 
+		/// If this does not happen within the given idle timeout,
+		/// the connection is destroyed, which closes the socket.
+		///
+		/// This is useful for protocols where connections are
+		/// idle most of the time, like HTTP with persistent
+		/// connections. run() must be prepared to be called
+		/// several times, and must keep all state it needs 
+		/// in member variables.
+		///
+		/// Parking only works if no data has already been read
+		/// from the socket into a buffer.
+
+	bool parked() const;
+		/// Returns true if park() has been called during 
+		/// the last call to run().
+
+	const Poco::Timespan& parkTimeout() const;
+		/// Returns the idle timeout given to park().
+
 private:
 	TCPServerConnection();
 	TCPServerConnection(const TCPServerConnection&);
 	TCPServerConnection& operator = (const TCPServerConnection&);
 	
 	StreamSocket _socket;
+	Poco::Timespan _parkTimeout;
+	bool _parked;
 	
 	friend class TCPServerDispatcher;
 };
@@ -82,6 +112,18 @@ inline StreamSocket& TCPServerConnection::socket()
 }
 
 
+inline bool TCPServerConnection::parked() const
+{
+	return _parked;
+}
+
+
+inline const Poco::Timespan& TCPServerConnection::parkTimeout() const
+{
+	return _parkTimeout;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -24,10 +24,16 @@
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/TCPServerConnectionFactory.h"
 #include "Poco/Net/TCPServerParams.h"
+#include "Poco/Net/PollSet.h"
 #include "Poco/Runnable.h"
+#include "Poco/RunnableAdapter.h"
 #include "Poco/NotificationQueue.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/Thread.h"
+#include "Poco/Event.h"
+#include "Poco/Timestamp.h"
 #include "Poco/Mutex.h"
+#include <map>
 
 
 namespace Poco {
@@ -37,6 +43,11 @@ namespace Net {
 class Net_API TCPServerDispatcher: public Poco::Runnable
 	/// A helper class for TCPServer that dispatches
 	/// connections to server connection threads.
+	///
+	/// Connections that have been parked (see TCPServerConnection::park())
+	/// are watched by a separate reactor thread, which queues them again
+	/// as soon as they become readable. The reactor thread is started
+	/// when the first connection is parked.
 {
 public:
 	TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::ThreadPool& threadPool, TCPServerParams::Ptr pParams);
@@ -84,6 +95,9 @@ public:
 	int refusedConnections() const;
 		/// Returns the number of refused connections.
 
+	int parkedConnections() const;
+		/// Returns the number of parked connections.
+
 	const TCPServerParams& params() const;
 		/// Returns a const reference to the TCPServerParam object.
 
@@ -97,7 +111,50 @@ protected:
 	void endConnection();
 		/// Updates the performance counters.
 
+	void resumeConnection();
+		/// Updates the performance counters.
+
+	void park(TCPServerConnection* pConnection);
+		/// Hands the given connection, which has been parked,
+		/// over to the reactor thread. Takes ownership of
+		/// the connection.
+		
+	void resume(TCPServerConnection* pConnection);
+		/// Queues the given parked connection, regardless of
+		/// the maximum queue size. Takes ownership of the connection.
+
+	void runReactor();
+		/// Runs the reactor thread, which watches parked
+		/// connections.
+
+	void stopReactor();
+		/// Stops the reactor thread and destroys all
+		/// parked connections.
+
+	void startThread();
+		/// Starts a new thread if there is no idle thread
+		/// and the maximum number of threads has not been
+		/// reached yet. Must be called with the mutex locked.
+
 private:
+	enum
+	{
+		REACTOR_POLL_INTERVAL = 100 
+			/// Poll interval of the reactor thread in milliseconds.
+			/// Bounds the accuracy of park timeouts, and, if PollSet
+			/// is not implemented using epoll, the delay until a newly 
+			/// parked connection is watched.
+	};
+
+	struct ParkedConnection
+	{
+		TCPServerConnection* pConnection;
+		Poco::Timestamp parkedAt;
+		Poco::Timespan timeout;
+	};
+	
+	typedef std::map<Socket, ParkedConnection> ParkedMap;
+
 	TCPServerDispatcher();
 	TCPServerDispatcher(const TCPServerDispatcher&);
 	TCPServerDispatcher& operator = (const TCPServerDispatcher&);
@@ -114,6 +171,13 @@ private:
 	TCPServerConnectionFactory::Ptr _pConnectionFactory;
 	Poco::ThreadPool&               _threadPool;
 	mutable Poco::FastMutex         _mutex;
+	PollSet                         _parkedSet;
+	ParkedMap                       _parked;
+	Poco::Thread                    _reactorThread;
+	Poco::RunnableAdapter<TCPServerDispatcher> _reactorRunnable;
+	Poco::Event                     _parkedEvent;
+	bool                            _reactorStarted;
+	mutable Poco::FastMutex         _parkMutex;
 };
 
 
@@ -23,6 +23,8 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/HTTPCredentials.h"
+#include "Poco/Net/PerMessageDeflate.h"
+#include "Poco/Buffer.h"
 
 
 namespace Poco {
@@ -50,6 +52,11 @@ class Net_API WebSocket: public StreamSocket
 	/// Note that special frames like PING must be handled at
 	/// application level. In the case of a PING, a PONG message
 	/// must be returned.
+	///
+	/// The permessage-deflate extension (RFC 7692) can be enabled
+	/// by passing PerMessageDeflate::Params to the constructor.
+	/// Compression and decompression of messages is transparent
+	/// to the application.
 {
 public:
 	enum Mode
@@ -125,8 +132,10 @@ public:
 			/// The server rejected the username or password for authentication.
 		WS_ERR_PAYLOAD_TOO_BIG                = 10,
 			/// Payload too big for supplied buffer.
-		WS_ERR_INCOMPLETE_FRAME               = 11
+		WS_ERR_INCOMPLETE_FRAME               = 11,
 			/// Incomplete frame received.
+		WS_ERR_COMPRESSION                    = 12
+			/// Invalid compressed payload received.
 	};
 	
 	WebSocket(HTTPServerRequest& request, HTTPServerResponse& response);
@@ -139,6 +148,16 @@ public:
 		///
 		/// Throws an exception if the request is not a proper WebSocket
 		/// upgrade request.
+
+	WebSocket(HTTPServerRequest& request, HTTPServerResponse& response, const PerMessageDeflate::Params& deflateParams);
+		/// Creates a server-side WebSocket from within a
+		/// HTTPRequestHandler, supporting the permessage-deflate
+		/// extension.
+		///
+		/// If the client offers the permessage-deflate extension in
+		/// its handshake request, the extension is accepted according
+		/// to the given parameters, and messages are compressed.
+		/// Otherwise, works like the WebSocket without the extension.
 		
 	WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response);
 		/// Creates a client-side WebSocket, using the given
@@ -166,6 +185,23 @@ public:
 		///
 		/// The result of the handshake can be obtained from the response
 		/// object.
+
+	WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, const PerMessageDeflate::Params& deflateParams);
+		/// Creates a client-side WebSocket, using the given
+		/// HTTPClientSession and HTTPRequest for the initial handshake 
+		/// (HTTP Upgrade request), offering the permessage-deflate
+		/// extension with the given parameters to the server.
+		///
+		/// If the server accepts the extension, messages are compressed.
+
+	WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials, const PerMessageDeflate::Params& deflateParams);
+		/// Creates a client-side WebSocket, using the given
+		/// HTTPClientSession and HTTPRequest for the initial handshake 
+		/// (HTTP Upgrade request), offering the permessage-deflate
+		/// extension with the given parameters to the server.
+		///
+		/// The given credentials are used for authentication
+		/// if requested by the server.
 	
 	WebSocket(const Socket& socket);
 		/// Creates a WebSocket from another Socket, which must be a WebSocket,
@@ -220,6 +256,32 @@ public:
 		///
 		/// The frame flags and opcode (FrameFlags and FrameOpcodes)
 		/// is stored in flags.
+
+	int receiveFrame(Poco::Buffer<char>& buffer, int maxPayloadSize, int& flags);
+		/// Receives a frame from the socket and appends its payload
+		/// to the given buffer, which is resized to fit the payload.
+		/// The payload is received directly into the buffer, so the
+		/// buffer does not need to be allocated for maxPayloadSize 
+		/// bytes in advance.
+		/// To reuse the buffer for the next frame, call buffer.resize(0);
+		/// this keeps the buffer's capacity.
+		///
+		/// Throws a WebSocketException (WS_ERR_PAYLOAD_TOO_BIG) 
+		/// if the frame's payload is larger than maxPayloadSize.
+		/// Since the buffer is resized according to the payload 
+		/// size announced in the frame header, maxPayloadSize 
+		/// limits the memory a peer can make the receiver allocate.
+		///
+		/// Returns the number of bytes received. 
+		/// A return value of 0 means that the peer has
+		/// shut down or closed the connection.
+		///
+		/// Throws a TimeoutException if a receive timeout has
+		/// been set and nothing is received within that interval.
+		/// Throws a NetException (or a subclass) in case of other errors.
+		///
+		/// The frame flags and opcode (FrameFlags and FrameOpcodes)
+		/// is stored in flags.
 		
 	Mode mode() const;
 		/// Returns WS_SERVER if the WebSocket is a server-side
@@ -229,9 +291,9 @@ public:
 		/// The WebSocket protocol version supported (13).
 	
 protected:
-	static WebSocketImpl* accept(HTTPServerRequest& request, HTTPServerResponse& response);
-	static WebSocketImpl* connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials);
-	static WebSocketImpl* completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key);
+	static WebSocketImpl* accept(HTTPServerRequest& request, HTTPServerResponse& response, const PerMessageDeflate::Params* pDeflateParams = 0);
+	static WebSocketImpl* connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials, const PerMessageDeflate::Params* pDeflateParams = 0);
+	static WebSocketImpl* completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key, const PerMessageDeflate::Params* pDeflateParams = 0);
 	static std::string computeAccept(const std::string& key);
 	static std::string createKey();
 	
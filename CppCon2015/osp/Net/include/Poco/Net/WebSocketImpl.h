@@ -21,7 +21,9 @@
 
 
 #include "Poco/Net/StreamSocketImpl.h"
+#include "Poco/Net/PerMessageDeflate.h"
 #include "Poco/Random.h"
+#include "Poco/Buffer.h"
 
 
 namespace Poco {
@@ -33,15 +35,43 @@ class Net_API WebSocketImpl: public StreamSocketImpl
 	/// to the WebSocket protocol described in RFC 6455.
 {
 public:
-	WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, bool mustMaskPayload);
+	WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, bool mustMaskPayload, PerMessageDeflate* pDeflate = 0);
 		/// Creates a StreamSocketImpl using the given native socket.
+		///
+		/// If pDeflate is given, messages are compressed according
+		/// to the permessage-deflate extension. The WebSocketImpl
+		/// takes ownership of the PerMessageDeflate object.
 	
 	// StreamSocketImpl
 	virtual int sendBytes(const void* buffer, int length, int flags);
 		/// Sends a WebSocket protocol frame.
+		///
+		/// If the payload is not masked, the frame header and
+		/// the payload are passed to the underlying socket 
+		/// implementation with a single gathering write, 
+		/// without copying the payload.
+		///
+		/// If the permessage-deflate extension is in use, single-frame
+		/// text and binary messages are compressed.
+
+	virtual int sendBytes(const SocketBufVec& buffers, int flags);
+		/// Not supported by a WebSocketImpl.
+		///
+		/// Throws a Poco::InvalidAccessException.
 		
 	virtual int receiveBytes(void* buffer, int length, int flags);
 		/// Receives a WebSocket protocol frame.
+		///
+		/// If the permessage-deflate extension is in use, compressed
+		/// frames are decompressed into buffer.
+		
+	int receiveBytes(Poco::Buffer<char>& buffer, int maxPayloadSize, int flags);
+		/// Receives a WebSocket protocol frame and appends its
+		/// payload to buffer, which is resized as necessary.
+		/// The payload is received directly into the buffer.
+		///
+		/// Throws a WebSocketException (WS_ERR_PAYLOAD_TOO_BIG) 
+		/// if the frame's payload is larger than maxPayloadSize.
 		
 	virtual SocketImpl* acceptConnection(SocketAddress& clientAddr);
 	virtual void connect(const SocketAddress& address);
@@ -70,6 +100,15 @@ public:
 	bool mustMaskPayload() const;
 		/// Returns true if the payload must be masked.
 
+	bool compressed() const;
+		/// Returns true if the permessage-deflate extension is in use.
+
+	static void applyMask(const char* src, char* dst, int length, const char* mask);
+		/// XORs length bytes from src with the four-byte mask 
+		/// and stores the result in dst, which may be the same as src.
+		/// Uses SSE2 (or AVX2, if enabled in the compiler) instructions 
+		/// if available.
+
 protected:
 	enum
 	{
@@ -78,6 +117,31 @@ protected:
 	};
 	
 	int receiveNBytes(void* buffer, int bytes);
+	int receiveHeader(char* header, int& payloadOffset, Poco::UInt64& payloadLength, char* mask, bool& useMask);
+		/// Receives the header of the next frame into header, which
+		/// must be MAX_HEADER_LENGTH bytes. For small frames, also
+		/// receives the beginning of the payload, starting at payloadOffset.
+		///
+		/// Returns the number of bytes received, or a value <= 0
+		/// if the peer has shut down or closed the connection.
+		
+	int receivePayload(char* buffer, int payloadLength, const char* prefix, int prefixLength, const char* mask);
+		/// Receives the payload of the current frame into buffer, with
+		/// the first prefixLength bytes taken from prefix, and unmasks it
+		/// if mask is not null.
+
+	void sendFrame(const void* buffer, int length, int flags);
+		/// Sends a single frame with the given header flags and payload.
+
+	bool mustCompress(int flags, int length) const;
+		/// Returns true if a frame with the given flags and payload
+		/// length must be compressed.
+
+	bool mustInflate();
+		/// Returns true if the payload of the most recently received
+		/// frame must be decompressed. Also keeps track of fragmented
+		/// compressed messages.
+
 	virtual ~WebSocketImpl();
 
 private:
@@ -87,6 +151,10 @@ private:
 	int _frameFlags;
 	bool _mustMaskPayload;
 	Poco::Random _rnd;
+	PerMessageDeflate* _pDeflate;
+	Poco::Buffer<char> _deflateBuffer;
+	Poco::Buffer<char> _inflateBuffer;
+	bool _inflating;
 };
 
 
@@ -105,6 +173,12 @@ inline bool WebSocketImpl::mustMaskPayload() const
 }
 
 
+inline bool WebSocketImpl::compressed() const
+{
+	return _pDeflate != 0;
+}
+
+
 } } // namespace Poco::Net
 
 
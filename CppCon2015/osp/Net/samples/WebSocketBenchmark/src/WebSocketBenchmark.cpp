@@ -0,0 +1,276 @@
+//
+// WebSocketBenchmark.cpp
+//
+// $Id$
+//
+// This sample measures the throughput of WebSocket payload masking
+// and of sending and receiving WebSocket frames over the loopback
+// interface, as well as the compression ratio of the permessage-deflate
+// extension for typical event messages.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Net/WebSocketImpl.h"
+#include "Poco/Net/PerMessageDeflate.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Buffer.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Format.h"
+#include <iostream>
+#include <vector>
+#include <cstring>
+
+
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::ServerSocket;
+using Poco::Net::WebSocket;
+using Poco::Net::WebSocketImpl;
+using Poco::Net::PerMessageDeflate;
+
+
+namespace
+{
+	int frameSize = 65536;
+	int frameCount = 10000;
+}
+
+
+class SinkRequestHandler: public HTTPRequestHandler
+	/// Receives frames until the client closes the connection.
+	/// Used for measuring client to server (masked) throughput.
+{
+public:
+	void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+	{
+		WebSocket ws(request, response);
+		Poco::Buffer<char> buffer(0);
+		int flags;
+		int n;
+		do
+		{
+			buffer.resize(0);
+			n = ws.receiveFrame(buffer, frameSize, flags);
+		}
+		while (n > 0 && (flags & WebSocket::FRAME_OP_BITMASK) != WebSocket::FRAME_OP_CLOSE);
+		ws.shutdown();
+	}
+};
+
+
+class SourceRequestHandler: public HTTPRequestHandler
+	/// Sends frameCount frames with frameSize bytes to the client.
+	/// Used for measuring server to client (unmasked) throughput.
+{
+public:
+	void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+	{
+		WebSocket ws(request, response);
+		// Wait for the client to be ready, as data received by the
+		// client's HTTPClientSession together with the handshake
+		// response would be lost.
+		char start[16];
+		int flags;
+		ws.receiveFrame(start, sizeof(start), flags);
+		std::string payload(frameSize, 'x');
+		for (int i = 0; i < frameCount; i++)
+		{
+			ws.sendFrame(payload.data(), frameSize, WebSocket::FRAME_BINARY);
+		}
+		ws.shutdown();
+	}
+};
+
+
+class RequestHandlerFactory: public HTTPRequestHandlerFactory
+{
+public:
+	HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+	{
+		if (request.getURI() == "/sink")
+			return new SinkRequestHandler;
+		else
+			return new SourceRequestHandler;
+	}
+};
+
+
+void printResult(const std::string& name, Poco::UInt64 bytes, const Poco::Stopwatch& sw)
+{
+	double mbps = sw.elapsed() > 0 ? double(bytes)/sw.elapsed() : 0.0;
+	std::cout << Poco::format("%-40s %8.1f MB/s", name, mbps) << std::endl;
+}
+
+
+void benchmarkMasking()
+	/// Compares the byte-at-a-time masking loop used by earlier
+	/// versions of WebSocketImpl with WebSocketImpl::applyMask().
+{
+	const char mask[4] = {'\x12', '\x34', '\x56', '\x78'};
+	Poco::Buffer<char> src(frameSize);
+	Poco::Buffer<char> dst(frameSize);
+	std::memset(src.begin(), 'x', frameSize);
+	const Poco::UInt64 bytes = Poco::UInt64(frameSize)*frameCount;
+
+	Poco::Stopwatch sw;
+	sw.start();
+	for (int k = 0; k < frameCount; k++)
+	{
+		const char* b = src.begin();
+		char* p = dst.begin();
+		for (int i = 0; i < frameSize; i++)
+		{
+			p[i] = b[i] ^ mask[i % 4];
+		}
+	}
+	sw.stop();
+	printResult("Masking, byte by byte (before)", bytes, sw);
+
+	sw.restart();
+	for (int k = 0; k < frameCount; k++)
+	{
+		WebSocketImpl::applyMask(src.begin(), dst.begin(), frameSize, mask);
+	}
+	sw.stop();
+	printResult("Masking, WebSocketImpl::applyMask()", bytes, sw);
+}
+
+
+void benchmarkDeflate()
+	/// Compresses a sequence of JSON event messages, as sent by
+	/// the WebEventService, with and without context takeover.
+{
+	const int messageCount = 1000;
+	std::vector<std::string> messages;
+	std::size_t bytes = 0;
+	for (int i = 0; i < messageCount; i++)
+	{
+		std::string message = Poco::format("NOTIFY io.macchina.sensors.temperature.%d WebEvent/1.0\r\n"
+			"{\"id\":\"io.macchina.sensor#%d\",\"type\":\"io.macchina.temperature\","
+			"\"timestamp\":%d,\"value\":%.2f,\"unit\":\"Cel\"}", i % 8, i % 8, 1444990000 + i, 20.0 + (i % 50)/10.0);
+		bytes += message.size();
+		messages.push_back(message);
+	}
+
+	for (int noContextTakeover = 0; noContextTakeover < 2; noContextTakeover++)
+	{
+		PerMessageDeflate::Params params;
+		params.serverNoContextTakeover = noContextTakeover != 0;
+		params.minMessageSize = 0;
+		PerMessageDeflate deflate(params, true);
+		Poco::Buffer<char> compressed(0);
+		std::size_t compressedBytes = 0;
+		Poco::Stopwatch sw;
+		sw.start();
+		for (int i = 0; i < messageCount; i++)
+		{
+			deflate.deflate(messages[i].data(), static_cast<int>(messages[i].size()), compressed);
+			compressedBytes += compressed.size();
+		}
+		sw.stop();
+		std::cout << Poco::format("%-40s %8.1f : 1 (%z -> %z bytes, %.1f us/message)", 
+			std::string(noContextTakeover ? "Deflate, no context takeover" : "Deflate, context takeover"),
+			double(bytes)/compressedBytes, bytes, compressedBytes, double(sw.elapsed())/messageCount) << std::endl;
+	}
+}
+
+
+void benchmarkFrames(Poco::UInt16 port)
+{
+	const Poco::UInt64 bytes = Poco::UInt64(frameSize)*frameCount;
+	{
+		HTTPClientSession cs("localhost", port);
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/sink");
+		HTTPResponse response;
+		WebSocket ws(cs, request, response);
+		std::string payload(frameSize, 'x');
+		Poco::Stopwatch sw;
+		sw.start();
+		for (int i = 0; i < frameCount; i++)
+		{
+			ws.sendFrame(payload.data(), frameSize, WebSocket::FRAME_BINARY);
+		}
+		ws.shutdown();
+		Poco::Buffer<char> buffer(0);
+		int flags;
+		ws.receiveFrame(buffer, frameSize, flags);
+		sw.stop();
+		printResult("Client to server (masked)", bytes, sw);
+	}
+	{
+		HTTPClientSession cs("localhost", port);
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/source");
+		HTTPResponse response;
+		WebSocket ws(cs, request, response);
+		Poco::Buffer<char> buffer(0);
+		Poco::UInt64 received = 0;
+		int flags;
+		int n;
+		Poco::Stopwatch sw;
+		sw.start();
+		ws.sendFrame("start", 5);
+		do
+		{
+			buffer.resize(0);
+			n = ws.receiveFrame(buffer, frameSize, flags);
+			if ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE) break;
+			received += n;
+		}
+		while (n > 0);
+		sw.stop();
+		printResult("Server to client (unmasked)", received, sw);
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		if (argc > 1) frameSize = Poco::NumberParser::parse(argv[1]);
+		if (argc > 2) frameCount = Poco::NumberParser::parse(argv[2]);
+
+		std::cout << "WebSocket Benchmark" << std::endl;
+		std::cout << "===================" << std::endl;
+		std::cout << frameCount << " frames with " << frameSize << " bytes payload" << std::endl << std::endl;
+
+		benchmarkMasking();
+		benchmarkDeflate();
+
+		ServerSocket ss(0);
+		HTTPServer server(new RequestHandlerFactory, ss, new HTTPServerParams);
+		server.start();
+		benchmarkFrames(ss.address().port());
+		server.stop();
+	}
+	catch (Poco::Exception& exc)
+	{
+		std::cerr << exc.displayText() << std::endl;
+		return 1;
+	}
+	return 0;
+}
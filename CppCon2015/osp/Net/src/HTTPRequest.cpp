@@ -20,6 +20,7 @@
 #include "Poco/NumberFormatter.h"
 #include "Poco/Ascii.h"
 #include "Poco/String.h"
+#include <cstring>
 
 
 using Poco::NumberFormatter;
@@ -231,6 +232,40 @@ void HTTPRequest::read(std::istream& istr)
 }
 
 
+const char* HTTPRequest::parse(const char* begin, const char* end)
+{
+	const char* it = begin;
+	while (it != end && Poco::Ascii::isSpace(*it)) ++it;
+	if (it == end) throw MessageException("No HTTP request header");
+	const char* method = it;
+	const char* limit = end - it > MAX_METHOD_LENGTH ? it + MAX_METHOD_LENGTH : end;
+	while (it != limit && !Poco::Ascii::isSpace(*it)) ++it;
+	if (it == end || !Poco::Ascii::isSpace(*it)) throw MessageException("HTTP request method invalid or too long");
+	const char* methodEnd = it;
+	while (it != end && Poco::Ascii::isSpace(*it)) ++it;
+	const char* uri = it;
+	limit = end - it > MAX_URI_LENGTH ? it + MAX_URI_LENGTH : end;
+	while (it != limit && !Poco::Ascii::isSpace(*it)) ++it;
+	if (it == end || !Poco::Ascii::isSpace(*it)) throw MessageException("HTTP request URI invalid or too long");
+	const char* uriEnd = it;
+	while (it != end && Poco::Ascii::isSpace(*it)) ++it;
+	const char* version = it;
+	limit = end - it > MAX_VERSION_LENGTH ? it + MAX_VERSION_LENGTH : end;
+	while (it != limit && !Poco::Ascii::isSpace(*it)) ++it;
+	if (it == end || !Poco::Ascii::isSpace(*it)) throw MessageException("Invalid HTTP version string");
+	const char* versionEnd = it;
+	const char* nl = static_cast<const char*>(std::memchr(it, '\n', end - it));
+	it = nl ? nl + 1 : end;
+	it = HTTPMessage::parse(it, end);
+	nl = static_cast<const char*>(std::memchr(it, '\n', end - it));
+	it = nl ? nl + 1 : end;
+	setMethod(std::string(method, methodEnd));
+	setURI(std::string(uri, uriEnd));
+	setVersion(std::string(version, versionEnd));
+	return it;
+}
+
+
 void HTTPRequest::getCredentials(const std::string& header, std::string& scheme, std::string& authInfo) const
 {
 	scheme.clear();
@@ -35,6 +35,7 @@ HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServe
 	TCPServerConnection(socket),
 	_pParams(pParams),
 	_pFactory(pFactory),
+	_pSession(0),
 	_stopped(false)
 {
 	poco_check_ptr (pFactory);
@@ -53,13 +54,17 @@ HTTPServerConnection::~HTTPServerConnection()
 	{
 		poco_unexpected();
 	}
+	delete _pSession;
 }
 
 
 void HTTPServerConnection::run()
 {
 	std::string server = _pParams->getSoftwareVersion();
-	HTTPServerSession session(socket(), _pParams);
+	// The session is kept between calls to run() if the connection
+	// is parked while waiting for the next request.
+	if (!_pSession) _pSession = new HTTPServerSession(socket(), _pParams);
+	HTTPServerSession& session = *_pSession;
 	while (!_stopped && session.hasMoreRequests())
 	{
 		try
@@ -121,6 +126,12 @@ void HTTPServerConnection::run()
 			}
 			else throw;
 		}
+		
+		if (_pParams->getParkIdleConnections() && !_stopped && session.canPark())
+		{
+			park(_pParams->getKeepAliveTimeout());
+			break;
+		}
 	}
 }
 
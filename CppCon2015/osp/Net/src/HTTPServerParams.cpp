@@ -25,7 +25,8 @@ HTTPServerParams::HTTPServerParams():
 	_timeout(60000000),
 	_keepAlive(true),
 	_maxKeepAliveRequests(0),
-	_keepAliveTimeout(15000000)
+	_keepAliveTimeout(15000000),
+	_parkIdleConnections(false)
 {
 }
 
@@ -70,6 +71,12 @@ void HTTPServerParams::setMaxKeepAliveRequests(int maxKeepAliveRequests)
 	poco_assert (maxKeepAliveRequests >= 0);
 	_maxKeepAliveRequests = maxKeepAliveRequests;
 }
+
+
+void HTTPServerParams::setParkIdleConnections(bool park)
+{
+	_parkIdleConnections = park;
+}
 	
 
 } } // namespace Poco::Net
@@ -43,8 +43,11 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 {
 	response.attachRequest(this);
 
-	HTTPHeaderInputStream hs(session);
-	read(hs);
+	if (!session.parseRequest(*this))
+	{
+		HTTPHeaderInputStream hs(session);
+		read(hs);
+	}
 	
 	// Now that we know socket is still connected, obtain addresses
 	_clientAddress = session.clientAddress();
@@ -21,15 +21,26 @@
 #include "Poco/Net/HTTPStream.h"
 #include "Poco/Net/HTTPFixedLengthStream.h"
 #include "Poco/Net/HTTPChunkedStream.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/File.h"
 #include "Poco/Timestamp.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/CountingStream.h"
 #include "Poco/Exception.h"
+#include "Poco/Error.h"
 #include "Poco/FileStream.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/DateTimeFormat.h"
+#include "Poco/NumberParser.h"
+#include "Poco/String.h"
+#if POCO_OS == POCO_OS_LINUX
+#include <sys/types.h>
+#include <sys/sendfile.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 
 using Poco::File;
@@ -41,6 +52,117 @@ using Poco::DateTimeFormatter;
 using Poco::DateTimeFormat;
 
 
+namespace
+{
+	void copyRange(std::istream& istr, std::ostream& ostr, Poco::UInt64 count)
+	{
+		char buffer[8192];
+		while (count > 0 && istr.good())
+		{
+			std::streamsize n = count < sizeof(buffer) ? static_cast<std::streamsize>(count) : sizeof(buffer);
+			istr.read(buffer, n);
+			n = istr.gcount();
+			if (n == 0) break;
+			ostr.write(buffer, n);
+			count -= n;
+		}
+		if (count > 0) throw Poco::ReadFileException("File is shorter than the requested range");
+	}
+
+#if POCO_OS == POCO_OS_LINUX
+
+	enum
+	{
+		MAX_SEND_CHUNK = 1024*1024
+	};
+
+	void checkSendError(int err)
+	{
+		if (err == EAGAIN || err == EWOULDBLOCK)
+			throw Poco::TimeoutException();
+		else
+			throw Poco::Net::NetException(Poco::Error::getMessage(err), err);
+	}
+
+	bool spliceRange(int sockfd, int fd, off_t& offset, Poco::UInt64& count)
+		/// Sends the given file range via a pipe, using splice().
+		/// Returns false if splice() is not supported for the given
+		/// file or socket, and nothing has been sent.
+		/// Throws a ReadFileException if the file ends before
+		/// the end of the range.
+	{
+		int pipefd[2];
+		if (pipe2(pipefd, O_CLOEXEC) != 0) return false;
+		bool started = false;
+		try
+		{
+			while (count > 0)
+			{
+				std::size_t n = count < MAX_SEND_CHUNK ? static_cast<std::size_t>(count) : MAX_SEND_CHUNK;
+				ssize_t rc = splice(fd, &offset, pipefd[1], NULL, n, SPLICE_F_MOVE | SPLICE_F_MORE);
+				if (rc < 0)
+				{
+					if (errno == EINTR) continue;
+					if (!started && (errno == EINVAL || errno == ENOSYS)) break;
+					throw Poco::ReadFileException(Poco::Error::getMessage(errno));
+				}
+				if (rc == 0) throw Poco::ReadFileException("File is shorter than the requested range");
+				started = true;
+				count -= rc;
+				while (rc > 0)
+				{
+					ssize_t sent = splice(pipefd[0], NULL, sockfd, NULL, rc, SPLICE_F_MOVE | (count > 0 ? SPLICE_F_MORE : 0));
+					if (sent < 0)
+					{
+						if (errno == EINTR) continue;
+						checkSendError(errno);
+					}
+					rc -= sent;
+				}
+			}
+		}
+		catch (...)
+		{
+			close(pipefd[0]);
+			close(pipefd[1]);
+			throw;
+		}
+		close(pipefd[0]);
+		close(pipefd[1]);
+		return started || count == 0;
+	}
+
+	bool sendFileRange(int sockfd, int fd, Poco::UInt64 offset, Poco::UInt64 count)
+		/// Sends the given file range with sendfile(), or splice()
+		/// if sendfile() cannot be used. Returns false if neither
+		/// can be used for the given file and socket, and nothing
+		/// has been sent. Throws a ReadFileException if the file
+		/// ends before the end of the range.
+	{
+		off_t off = static_cast<off_t>(offset);
+		bool started = false;
+		while (count > 0)
+		{
+			std::size_t n = count < MAX_SEND_CHUNK ? static_cast<std::size_t>(count) : MAX_SEND_CHUNK;
+			ssize_t rc = sendfile(sockfd, fd, &off, n);
+			if (rc < 0)
+			{
+				if (errno == EINTR) continue;
+				if (!started && (errno == EINVAL || errno == ENOSYS))
+					return spliceRange(sockfd, fd, off, count);
+				checkSendError(errno);
+			}
+			if (rc == 0) throw Poco::ReadFileException("File is shorter than the requested range");
+			started = true;
+			count -= rc;
+		}
+		return true;
+	}
+
+#endif // POCO_OS == POCO_OS_LINUX
+}
+
+
 namespace Poco {
 namespace Net {
 
@@ -115,22 +237,71 @@ void HTTPServerResponseImpl::sendFile(const std::string& path, const std::string
 	Timestamp dateTime    = f.getLastModified();
 	File::FileSize length = f.getSize();
 	set("Last-Modified", DateTimeFormatter::format(dateTime, DateTimeFormat::HTTP_FORMAT));
+	set("Accept-Ranges", "bytes");
+	setContentType(mediaType);
+	setChunkedTransferEncoding(false);
+
+	Poco::UInt64 first = 0;
+	Poco::UInt64 last  = length > 0 ? length - 1 : 0;
+	switch (parseRange(length, first, last))
+	{
+	case RANGE_OK:
+		setStatusAndReason(HTTPResponse::HTTP_PARTIAL_CONTENT);
+		set("Content-Range", "bytes " + NumberFormatter::format(first) + "-" + NumberFormatter::format(last) + "/" + NumberFormatter::format(length));
+		break;
+	case RANGE_UNSATISFIABLE:
+		setStatusAndReason(HTTPResponse::HTTP_REQUESTED_RANGE_NOT_SATISFIABLE);
+		set("Content-Range", "bytes */" + NumberFormatter::format(length));
+		setContentLength(0);
+		_pStream = new HTTPHeaderOutputStream(_session);
+		write(*_pStream);
+		return;
+	case RANGE_NONE:
+		break;
+	}
+	Poco::UInt64 count = length > 0 ? last - first + 1 : 0;
 #if defined(POCO_HAVE_INT64)	
-	setContentLength64(length);
+	setContentLength64(count);
 #else
-	setContentLength(static_cast<int>(length));
+	setContentLength(static_cast<int>(count));
+#endif
+	bool sendBody = _pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD;
+
+#if POCO_OS == POCO_OS_LINUX
+	if (!_session.socket().impl()->secure())
+	{
+		int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) throw OpenFileException(path);
+		bool sent = false;
+		try
+		{
+			_pStream = new HTTPHeaderOutputStream(_session);
+			write(*_pStream);
+			_pStream->flush();
+			sent = !sendBody || sendFileRange(_session.socket().impl()->sockfd(), fd, first, count);
+		}
+		catch (...)
+		{
+			close(fd);
+			throw;
+		}
+		close(fd);
+		if (sent) return;
+	}
 #endif
-	setContentType(mediaType);
-	setChunkedTransferEncoding(false);
 
 	Poco::FileInputStream istr(path);
 	if (istr.good())
 	{
-		_pStream = new HTTPHeaderOutputStream(_session);
-		write(*_pStream);
-		if (_pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
+		if (!_pStream)
+		{
+			_pStream = new HTTPHeaderOutputStream(_session);
+			write(*_pStream);
+		}
+		if (sendBody)
 		{
-			StreamCopier::copyStream(istr, *_pStream);
+			if (first > 0) istr.seekg(static_cast<std::streamoff>(first));
+			copyRange(istr, *_pStream, count);
 		}
 	}
 	else throw OpenFileException(path);
@@ -168,6 +339,57 @@ void HTTPServerResponseImpl::redirect(const std::string& uri, HTTPStatus status)
 }
 
 
+HTTPServerResponseImpl::RangeResult HTTPServerResponseImpl::parseRange(Poco::UInt64 length, Poco::UInt64& first, Poco::UInt64& last) const
+{
+	if (!_pRequest || getStatus() != HTTPResponse::HTTP_OK || !_pRequest->has("Range")) 
+		return RANGE_NONE;
+
+	if (_pRequest->has("If-Range"))
+	{
+		// Both entity tags and dates must match exactly (RFC 7233, 3.2).
+		const std::string& ifRange = _pRequest->get("If-Range");
+		if (ifRange != get("ETag", "") && ifRange != get("Last-Modified", ""))
+			return RANGE_NONE;
+	}
+
+	// Only a single byte range is supported; for anything else
+	// the entire file is sent, which is allowed by RFC 7233.
+	std::string range = Poco::trim(_pRequest->get("Range"));
+	if (Poco::icompare(range, 0, 6, std::string("bytes=")) != 0 || range.find(',') != std::string::npos)
+		return RANGE_NONE;
+	std::string::size_type pos = range.find('-', 6);
+	if (pos == std::string::npos) 
+		return RANGE_NONE;
+	std::string firstStr = Poco::trim(range.substr(6, pos - 6));
+	std::string lastStr  = Poco::trim(range.substr(pos + 1));
+	
+	Poco::UInt64 n;
+	if (firstStr.empty())
+	{
+		// suffix range: last n bytes
+		if (!NumberParser::tryParseUnsigned64(lastStr, n)) return RANGE_NONE;
+		if (n == 0 || length == 0) return RANGE_UNSATISFIABLE;
+		first = n < length ? length - n : 0;
+		last  = length - 1;
+	}
+	else
+	{
+		if (!NumberParser::tryParseUnsigned64(firstStr, first)) return RANGE_NONE;
+		if (lastStr.empty())
+		{
+			last = length - 1;
+		}
+		else
+		{
+			if (!NumberParser::tryParseUnsigned64(lastStr, n) || n < first) return RANGE_NONE;
+			last = n < length ? n : length - 1;
+		}
+		if (first >= length) return RANGE_UNSATISFIABLE;
+	}
+	return RANGE_OK;
+}
+
+
 void HTTPServerResponseImpl::requireAuthentication(const std::string& realm)
 {
 	poco_assert (!_pStream);
@@ -15,12 +15,37 @@
 
 
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Ascii.h"
+#include <cstring>
 
 
 namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	const char* findHeaderEnd(const char* begin, const char* end)
+		/// Returns a pointer to the first character after the empty line
+		/// terminating the request header, or null if the header
+		/// is incomplete.
+	{
+		const char* it = begin;
+		while (it != end && Poco::Ascii::isSpace(*it)) ++it;
+		while (it != end)
+		{
+			it = static_cast<const char*>(std::memchr(it, '\n', end - it));
+			if (!it) return 0;
+			++it;
+			if (it != end && *it == '\n') return it + 1;
+			if (end - it > 1 && it[0] == '\r' && it[1] == '\n') return it + 2;
+		}
+		return 0;
+	}
+}
+
+
 HTTPServerSession::HTTPServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams):
 	HTTPSession(socket, pParams->getKeepAlive()),
 	_firstRequest(true),
@@ -57,6 +82,32 @@ bool HTTPServerSession::hasMoreRequests()
 }
 
 
+bool HTTPServerSession::canPark()
+{
+	return socket().impl()->initialized()
+		&& !_firstRequest
+		&& _maxKeepAliveRequests != 0 
+		&& getKeepAlive()
+		&& buffered() == 0
+		&& socket().available() == 0;
+}
+
+
+bool HTTPServerSession::parseRequest(HTTPRequest& request)
+{
+	if (peek() == std::char_traits<char>::eof()) return false;
+
+	const char* begin = bufferedData();
+	const char* end = begin + buffered();
+	const char* headerEnd = findHeaderEnd(begin, end);
+	if (!headerEnd) return false;
+
+	const char* it = request.parse(begin, headerEnd);
+	skipBuffered(static_cast<int>(it - begin));
+	return true;
+}
+
+
 SocketAddress HTTPServerSession::clientAddress()
 {
 	return socket().peerAddress();
@@ -18,12 +18,42 @@
 #include "Poco/Net/NetException.h"
 #include "Poco/String.h"
 #include "Poco/Ascii.h"
+#include <cstring>
 
 
 namespace Poco {
 namespace Net {
 
 
+namespace
+{
+	inline const char* findChar(const char* begin, const char* end, char ch)
+	{
+		return static_cast<const char*>(std::memchr(begin, ch, end - begin));
+	}
+	
+	const char* parseValue(const char* it, const char* end, std::string& value, std::size_t maxLength, const char* error)
+		/// Appends the field value (or folded part of it) starting
+		/// at it to value, and returns the start of the next line.
+	{
+		const char* stop = findChar(it, end, '\n');
+		if (!stop) stop = end;
+		const char* cr = findChar(it, stop, '\r');
+		if (cr) stop = cr;
+		if (static_cast<std::size_t>(stop - it) > maxLength - value.length()) throw MessageException(error);
+		value.append(it, stop);
+		it = stop;
+		if (it != end && *it == '\r') ++it;
+		if (it != end)
+		{
+			if (*it != '\n') throw MessageException(error);
+			++it;
+		}
+		return it;
+	}
+}
+
+
 MessageHeader::MessageHeader():
 	_fieldLimit(DFL_FIELD_LIMIT)
 {
@@ -105,6 +135,38 @@ void MessageHeader::read(std::istream& istr)
 }
 
 
+const char* MessageHeader::parse(const char* begin, const char* end)
+{
+	std::string value;
+	value.reserve(64);
+	const char* it = begin;
+	int fields = 0;
+	while (it != end && *it != '\r' && *it != '\n')
+	{
+		if (_fieldLimit > 0 && fields == _fieldLimit)
+			throw MessageException("Too many header fields");
+		const char* limit = end - it > MAX_NAME_LENGTH ? it + MAX_NAME_LENGTH + 1 : end;
+		const char* colon = findChar(it, limit, ':');
+		const char* nl = findChar(it, colon ? colon : limit, '\n');
+		if (nl) { it = nl + 1; continue; } // ignore invalid header lines
+		if (!colon) throw MessageException("Field name too long/no colon found");
+		std::string name(it, colon);
+		it = colon + 1;
+		while (it != end && Poco::Ascii::isSpace(*it) && *it != '\r' && *it != '\n') ++it;
+		value.clear();
+		it = parseValue(it, end, value, MAX_VALUE_LENGTH, "Field value too long/no CRLF found");
+		while (it != end && (*it == ' ' || *it == '\t')) // folding
+		{
+			it = parseValue(it, end, value, MAX_VALUE_LENGTH, "Folded field value too long/no CRLF found");
+		}
+		Poco::trimRightInPlace(value);
+		add(name, value);
+		++fields;
+	}
+	return it;
+}
+
+
 int MessageHeader::getFieldLimit() const
 {
 	return _fieldLimit;
@@ -0,0 +1,368 @@
+//
+// PerMessageDeflate.cpp
+//
+// $Id$
+//
+// Library: Net
+// Package: WebSocket
+// Module:  PerMessageDeflate
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/PerMessageDeflate.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Net/MessageHeader.h"
+#include "Poco/Net/NameValueCollection.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/String.h"
+#include "Poco/Ascii.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <cstring>
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	const char DEFLATE_TAIL[] = {'\x00', '\x00', '\xff', '\xff'};
+		/// The end of an empty stored block, which terminates the output
+		/// of a sync flush. Removed from compressed messages by the sender
+		/// and appended again by the receiver.
+
+	const std::size_t MIN_INFLATE_SPACE = 1024;
+
+	int clampWindowBits(int windowBits)
+	{
+		return std::max(static_cast<int>(PerMessageDeflate::MIN_WINDOW_BITS), std::min(windowBits, static_cast<int>(PerMessageDeflate::MAX_WINDOW_BITS)));
+	}
+
+	bool parseWindowBits(const std::string& value, int& windowBits)
+		/// Parses a window bits parameter value, which must be
+		/// a decimal number from 8 to 15 without leading zeros.
+	{
+		if (value.empty() || value[0] == '0') return false;
+		for (std::string::const_iterator it = value.begin(); it != value.end(); ++it)
+		{
+			if (!Poco::Ascii::isDigit(*it)) return false;
+		}
+		return Poco::NumberParser::tryParse(value, windowBits) && windowBits >= 8 && windowBits <= PerMessageDeflate::MAX_WINDOW_BITS;
+	}
+
+	bool inflateResult(z_stream& stream, int rc)
+		/// Checks the result of inflate(). Returns true if the end
+		/// of the deflate stream has been reached, false otherwise.
+	{
+		switch (rc)
+		{
+		case Z_OK:
+		case Z_BUF_ERROR:
+			return false;
+		case Z_STREAM_END:
+			// The sender has terminated the message with a final block,
+			// so the next message starts a new deflate stream.
+			inflateReset(&stream);
+			return true;
+		default:
+			throw WebSocketException("Invalid compressed payload", WebSocket::WS_ERR_COMPRESSION);
+		}
+	}
+}
+
+
+const std::string PerMessageDeflate::EXTENSION_NAME("permessage-deflate");
+
+
+PerMessageDeflate::Params::Params():
+	serverNoContextTakeover(false),
+	clientNoContextTakeover(false),
+	serverMaxWindowBits(MAX_WINDOW_BITS),
+	clientMaxWindowBits(MAX_WINDOW_BITS),
+	compressionLevel(Z_DEFAULT_COMPRESSION),
+	minMessageSize(64)
+{
+}
+
+
+PerMessageDeflate::PerMessageDeflate(const Params& params, bool server):
+	_deflateReset(server ? params.serverNoContextTakeover : params.clientNoContextTakeover),
+	_inflateReset(server ? params.clientNoContextTakeover : params.serverNoContextTakeover),
+	_minMessageSize(params.minMessageSize)
+{
+	std::memset(&_deflateStream, 0, sizeof(_deflateStream));
+	std::memset(&_inflateStream, 0, sizeof(_inflateStream));
+
+	const int windowBits = clampWindowBits(server ? params.serverMaxWindowBits : params.clientMaxWindowBits);
+	int rc = deflateInit2(&_deflateStream, params.compressionLevel, Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY);
+	if (rc != Z_OK) throw IOException(zError(rc));
+
+	// The peer may use any window size up to the maximum,
+	// so the decompressor always uses the largest window.
+	rc = inflateInit2(&_inflateStream, -MAX_WINDOW_BITS);
+	if (rc != Z_OK)
+	{
+		deflateEnd(&_deflateStream);
+		throw IOException(zError(rc));
+	}
+}
+
+
+PerMessageDeflate::~PerMessageDeflate()
+{
+	deflateEnd(&_deflateStream);
+	inflateEnd(&_inflateStream);
+}
+
+
+void PerMessageDeflate::deflate(const char* data, int length, Poco::Buffer<char>& compressed)
+{
+	_deflateStream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+	_deflateStream.avail_in = static_cast<uInt>(length);
+	compressed.resize(deflateBound(&_deflateStream, length) + 16, false);
+	std::size_t size = 0;
+	for (;;)
+	{
+		_deflateStream.next_out  = reinterpret_cast<Bytef*>(compressed.begin() + size);
+		_deflateStream.avail_out = static_cast<uInt>(compressed.size() - size);
+		int rc = ::deflate(&_deflateStream, Z_SYNC_FLUSH);
+		if (rc != Z_OK && rc != Z_BUF_ERROR) throw IOException(zError(rc));
+		size = compressed.size() - _deflateStream.avail_out;
+		if (_deflateStream.avail_out != 0) break;
+		compressed.resize(2*compressed.size());
+	}
+	poco_assert (size >= sizeof(DEFLATE_TAIL) && std::memcmp(compressed.begin() + size - sizeof(DEFLATE_TAIL), DEFLATE_TAIL, sizeof(DEFLATE_TAIL)) == 0);
+	compressed.resize(size - sizeof(DEFLATE_TAIL));
+	if (_deflateReset) deflateReset(&_deflateStream);
+}
+
+
+void PerMessageDeflate::inflate(const char* data, int length, bool final, Poco::Buffer<char>& payload, int maxLength)
+{
+	const std::size_t maxSize = payload.size() + static_cast<std::size_t>(maxLength);
+	inflateData(data, length, payload, maxSize);
+	if (final)
+	{
+		inflateData(DEFLATE_TAIL, sizeof(DEFLATE_TAIL), payload, maxSize);
+		endInflate();
+	}
+}
+
+
+int PerMessageDeflate::inflate(const char* data, int length, bool final, char* payload, int maxLength)
+{
+	int n = inflateData(data, length, payload, maxLength);
+	if (final)
+	{
+		n += inflateData(DEFLATE_TAIL, sizeof(DEFLATE_TAIL), payload + n, maxLength - n);
+		endInflate();
+	}
+	return n;
+}
+
+
+void PerMessageDeflate::inflateData(const char* data, int length, Poco::Buffer<char>& payload, std::size_t maxSize)
+{
+	_inflateStream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+	_inflateStream.avail_in = static_cast<uInt>(length);
+	std::size_t size = payload.size();
+	do
+	{
+		if (payload.capacity() - size < MIN_INFLATE_SPACE && payload.capacity() <= maxSize)
+		{
+			// Never grow the buffer beyond one byte more than allowed,
+			// which is enough to detect a payload that is too big.
+			std::size_t capacity = 2*payload.capacity() + MIN_INFLATE_SPACE;
+			if (capacity > maxSize + 1) capacity = maxSize + 1;
+			payload.setCapacity(capacity);
+		}
+		payload.resize(payload.capacity());
+		_inflateStream.next_out  = reinterpret_cast<Bytef*>(payload.begin() + size);
+		_inflateStream.avail_out = static_cast<uInt>(payload.size() - size);
+		int rc = ::inflate(&_inflateStream, Z_SYNC_FLUSH);
+		size = payload.size() - _inflateStream.avail_out;
+		if (size > maxSize) 
+		{
+			payload.resize(maxSize);
+			throw WebSocketException("Decompressed payload exceeds maximum payload size", WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		}
+		if (inflateResult(_inflateStream, rc) || rc == Z_BUF_ERROR) break;
+	}
+	while (_inflateStream.avail_in > 0 || _inflateStream.avail_out == 0);
+	payload.resize(size);
+}
+
+
+int PerMessageDeflate::inflateData(const char* data, int length, char* payload, int maxLength)
+{
+	_inflateStream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+	_inflateStream.avail_in  = static_cast<uInt>(length);
+	_inflateStream.next_out  = reinterpret_cast<Bytef*>(payload);
+	_inflateStream.avail_out = static_cast<uInt>(maxLength);
+	if (maxLength > 0 && inflateResult(_inflateStream, ::inflate(&_inflateStream, Z_SYNC_FLUSH)))
+		return maxLength - static_cast<int>(_inflateStream.avail_out);
+
+	const int n = maxLength - static_cast<int>(_inflateStream.avail_out);
+	if (_inflateStream.avail_out == 0)
+	{
+		// The payload buffer is full; make sure there is no more output.
+		char c;
+		_inflateStream.next_out  = reinterpret_cast<Bytef*>(&c);
+		_inflateStream.avail_out = 1;
+		inflateResult(_inflateStream, ::inflate(&_inflateStream, Z_SYNC_FLUSH));
+		if (_inflateStream.avail_out == 0)
+			throw WebSocketException("Insufficient buffer for decompressed payload", WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	}
+	return n;
+}
+
+
+void PerMessageDeflate::endInflate()
+{
+	if (_inflateReset) inflateReset(&_inflateStream);
+}
+
+
+std::string PerMessageDeflate::offer(const Params& params)
+{
+	std::string result(EXTENSION_NAME);
+	if (params.serverNoContextTakeover)
+		result += "; server_no_context_takeover";
+	if (params.clientNoContextTakeover)
+		result += "; client_no_context_takeover";
+	if (clampWindowBits(params.serverMaxWindowBits) < MAX_WINDOW_BITS)
+	{
+		result += "; server_max_window_bits=";
+		Poco::NumberFormatter::append(result, clampWindowBits(params.serverMaxWindowBits));
+	}
+	// Always offered, to tell the server that the client's
+	// window size can be limited.
+	result += "; client_max_window_bits";
+	if (clampWindowBits(params.clientMaxWindowBits) < MAX_WINDOW_BITS)
+	{
+		result += "=";
+		Poco::NumberFormatter::append(result, clampWindowBits(params.clientMaxWindowBits));
+	}
+	return result;
+}
+
+
+bool PerMessageDeflate::accept(const std::string& offers, const Params& params, Params& negotiated, std::string& response)
+{
+	std::vector<std::string> elements;
+	MessageHeader::splitElements(offers, elements);
+	for (std::vector<std::string>::const_iterator it = elements.begin(); it != elements.end(); ++it)
+	{
+		std::string name;
+		NameValueCollection offerParams;
+		MessageHeader::splitParameters(*it, name, offerParams);
+		if (Poco::icompare(name, EXTENSION_NAME) != 0) continue;
+
+		Params offered;
+		bool clientMaxWindowBits;
+		if (!parseParams(offerParams, false, offered, clientMaxWindowBits)) continue;
+		if (offered.serverMaxWindowBits < MIN_WINDOW_BITS) continue;
+
+		negotiated = params;
+		negotiated.serverNoContextTakeover = params.serverNoContextTakeover || offered.serverNoContextTakeover;
+		negotiated.clientNoContextTakeover = params.clientNoContextTakeover || offered.clientNoContextTakeover;
+		negotiated.serverMaxWindowBits = std::min(clampWindowBits(params.serverMaxWindowBits), offered.serverMaxWindowBits);
+		// The client's window size can only be limited if the client has offered it.
+		negotiated.clientMaxWindowBits = clientMaxWindowBits ? std::min(clampWindowBits(params.clientMaxWindowBits), offered.clientMaxWindowBits) : static_cast<int>(MAX_WINDOW_BITS);
+
+		response = EXTENSION_NAME;
+		if (negotiated.serverNoContextTakeover)
+			response += "; server_no_context_takeover";
+		if (negotiated.clientNoContextTakeover)
+			response += "; client_no_context_takeover";
+		if (negotiated.serverMaxWindowBits < MAX_WINDOW_BITS)
+		{
+			response += "; server_max_window_bits=";
+			Poco::NumberFormatter::append(response, negotiated.serverMaxWindowBits);
+		}
+		if (negotiated.clientMaxWindowBits < MAX_WINDOW_BITS)
+		{
+			response += "; client_max_window_bits=";
+			Poco::NumberFormatter::append(response, negotiated.clientMaxWindowBits);
+		}
+		return true;
+	}
+	return false;
+}
+
+
+bool PerMessageDeflate::confirm(const std::string& response, const Params& params, Params& negotiated)
+{
+	std::vector<std::string> elements;
+	MessageHeader::splitElements(response, elements);
+	if (elements.empty()) return false;
+	if (elements.size() > 1)
+		throw WebSocketException("Unexpected extensions in handshake response", response, WebSocket::WS_ERR_NO_HANDSHAKE);
+
+	std::string name;
+	NameValueCollection responseParams;
+	MessageHeader::splitParameters(elements[0], name, responseParams);
+	if (Poco::icompare(name, EXTENSION_NAME) != 0)
+		throw WebSocketException("Unexpected extension in handshake response", response, WebSocket::WS_ERR_NO_HANDSHAKE);
+
+	Params accepted;
+	bool clientMaxWindowBits;
+	if (!parseParams(responseParams, true, accepted, clientMaxWindowBits)
+		|| (params.serverNoContextTakeover && !accepted.serverNoContextTakeover)
+		|| accepted.serverMaxWindowBits > clampWindowBits(params.serverMaxWindowBits)
+		|| accepted.clientMaxWindowBits < MIN_WINDOW_BITS)
+		throw WebSocketException("Unacceptable permessage-deflate parameters in handshake response", response, WebSocket::WS_ERR_NO_HANDSHAKE);
+
+	negotiated = params;
+	negotiated.serverNoContextTakeover = accepted.serverNoContextTakeover;
+	negotiated.clientNoContextTakeover = params.clientNoContextTakeover || accepted.clientNoContextTakeover;
+	negotiated.serverMaxWindowBits = accepted.serverMaxWindowBits;
+	negotiated.clientMaxWindowBits = std::min(clampWindowBits(params.clientMaxWindowBits), accepted.clientMaxWindowBits);
+	return true;
+}
+
+
+bool PerMessageDeflate::parseParams(const NameValueCollection& params, bool response, Params& result, bool& clientMaxWindowBits)
+{
+	result = Params();
+	clientMaxWindowBits = false;
+	bool serverMaxWindowBits = false;
+	for (NameValueCollection::ConstIterator it = params.begin(); it != params.end(); ++it)
+	{
+		if (Poco::icompare(it->first, "server_no_context_takeover") == 0)
+		{
+			if (result.serverNoContextTakeover || !it->second.empty()) return false;
+			result.serverNoContextTakeover = true;
+		}
+		else if (Poco::icompare(it->first, "client_no_context_takeover") == 0)
+		{
+			if (result.clientNoContextTakeover || !it->second.empty()) return false;
+			result.clientNoContextTakeover = true;
+		}
+		else if (Poco::icompare(it->first, "server_max_window_bits") == 0)
+		{
+			if (serverMaxWindowBits || !parseWindowBits(it->second, result.serverMaxWindowBits)) return false;
+			serverMaxWindowBits = true;
+		}
+		else if (Poco::icompare(it->first, "client_max_window_bits") == 0)
+		{
+			if (clientMaxWindowBits) return false;
+			// In an offer, the parameter may be given without a value.
+			if ((response || !it->second.empty()) && !parseWindowBits(it->second, result.clientMaxWindowBits)) return false;
+			clientMaxWindowBits = true;
+		}
+		else return false;
+	}
+	return true;
+}
+
+
+} } // namespace Poco::Net
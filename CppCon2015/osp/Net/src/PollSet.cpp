@@ -0,0 +1,499 @@
+//
+// PollSet.cpp
+//
+// $Id: //poco/1.6/Net/src/PollSet.cpp#1 $
+//
+// Library: Net
+// Package: Sockets
+// Module:  PollSet
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/PollSet.h"
+#include "Poco/Net/SocketImpl.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Error.h"
+#include <vector>
+#if defined(POCO_HAVE_FD_EPOLL)
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <errno.h>
+#elif defined(POCO_HAVE_FD_POLL)
+#include <poll.h>
+#include <errno.h>
+#endif
+
+
+namespace Poco {
+namespace Net {
+
+
+#if defined(POCO_HAVE_FD_EPOLL)
+
+
+//
+// Linux implementation using epoll
+//
+class PollSetImpl
+{
+public:
+	PollSetImpl():
+		_epollfd(epoll_create(1)),
+		_events(MAX_EVENTS)
+	{
+		if (_epollfd < 0) throw NetException("Cannot create epoll queue", Poco::Error::getMessage(errno));
+	}
+
+	~PollSetImpl()
+	{
+		::close(_epollfd);
+	}
+
+	void add(const Socket& socket, int mode)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		SocketImpl* pImpl = socket.impl();
+		SocketMap::iterator it = _socketMap.find(pImpl);
+		ctl(it == _socketMap.end() ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, socket, mode);
+		if (it == _socketMap.end()) _socketMap[pImpl] = socket;
+	}
+
+	void remove(const Socket& socket)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		SocketMap::iterator it = _socketMap.find(socket.impl());
+		if (it != _socketMap.end())
+		{
+			poco_socket_t fd = socket.impl()->sockfd();
+			if (fd != POCO_INVALID_SOCKET)
+			{
+				struct epoll_event ev;
+				ev.events = 0;
+				ev.data.ptr = 0;
+				epoll_ctl(_epollfd, EPOLL_CTL_DEL, fd, &ev);
+			}
+			_socketMap.erase(it);
+		}
+	}
+
+	void update(const Socket& socket, int mode)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (_socketMap.find(socket.impl()) == _socketMap.end())
+			throw Poco::NotFoundException("Socket not in PollSet");
+		ctl(EPOLL_CTL_MOD, socket, mode);
+	}
+
+	bool has(const Socket& socket) const
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _socketMap.find(socket.impl()) != _socketMap.end();
+	}
+
+	std::size_t count() const
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _socketMap.size();
+	}
+
+	void clear()
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		for (SocketMap::iterator it = _socketMap.begin(); it != _socketMap.end(); ++it)
+		{
+			poco_socket_t fd = it->second.impl()->sockfd();
+			if (fd != POCO_INVALID_SOCKET)
+			{
+				struct epoll_event ev;
+				ev.events = 0;
+				ev.data.ptr = 0;
+				epoll_ctl(_epollfd, EPOLL_CTL_DEL, fd, &ev);
+			}
+		}
+		_socketMap.clear();
+	}
+
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	{
+		PollSet::SocketModeMap result;
+
+		if (count() == 0) return result;
+
+		Poco::Timespan remainingTime(timeout);
+		int rc;
+		do
+		{
+			Poco::Timestamp start;
+			rc = epoll_wait(_epollfd, &_events[0], static_cast<int>(_events.size()), static_cast<int>(remainingTime.totalMilliseconds()));
+			if (rc < 0 && errno == EINTR)
+			{
+				Poco::Timestamp end;
+				Poco::Timespan waited = end - start;
+				if (waited < remainingTime)
+					remainingTime -= waited;
+				else
+					remainingTime = 0;
+			}
+		}
+		while (rc < 0 && errno == EINTR);
+		if (rc < 0) throw NetException("epoll_wait failed", Poco::Error::getMessage(errno));
+
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		for (int i = 0; i < rc; i++)
+		{
+			SocketMap::iterator it = _socketMap.find(_events[i].data.ptr);
+			if (it != _socketMap.end())
+			{
+				int mode = 0;
+				if (_events[i].events & (EPOLLIN | EPOLLHUP)) mode |= PollSet::POLL_READ;
+				if (_events[i].events & EPOLLOUT) mode |= PollSet::POLL_WRITE;
+				if (_events[i].events & EPOLLERR) mode |= PollSet::POLL_ERROR;
+				result[it->second] |= mode;
+			}
+		}
+		return result;
+	}
+
+private:
+	enum
+	{
+		MAX_EVENTS = 1024
+	};
+
+	void ctl(int op, const Socket& socket, int mode)
+	{
+		poco_socket_t fd = socket.impl()->sockfd();
+		if (fd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+
+		struct epoll_event ev;
+		ev.events = 0;
+		if (mode & PollSet::POLL_READ) ev.events |= EPOLLIN;
+		if (mode & PollSet::POLL_WRITE) ev.events |= EPOLLOUT;
+		if (mode & PollSet::POLL_ERROR) ev.events |= EPOLLERR;
+		if (mode & PollSet::POLL_EDGE) ev.events |= EPOLLET;
+		ev.data.ptr = socket.impl();
+		if (epoll_ctl(_epollfd, op, fd, &ev) < 0)
+			throw NetException("Cannot update epoll queue", Poco::Error::getMessage(errno));
+	}
+
+	typedef std::map<void*, Socket> SocketMap;
+
+	mutable Poco::FastMutex _mutex;
+	int _epollfd;
+	SocketMap _socketMap;
+	std::vector<struct epoll_event> _events;
+};
+
+
+#elif defined(POCO_HAVE_FD_POLL)
+
+
+//
+// BSD/Unix implementation using poll
+//
+class PollSetImpl
+{
+public:
+	PollSetImpl():
+		_dirty(false)
+	{
+	}
+
+	void add(const Socket& socket, int mode)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_socketMap[socket] = mode;
+		_dirty = true;
+	}
+
+	void remove(const Socket& socket)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (_socketMap.erase(socket)) _dirty = true;
+	}
+
+	void update(const Socket& socket, int mode)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		PollSet::SocketModeMap::iterator it = _socketMap.find(socket);
+		if (it == _socketMap.end()) throw Poco::NotFoundException("Socket not in PollSet");
+		it->second = mode;
+		_dirty = true;
+	}
+
+	bool has(const Socket& socket) const
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _socketMap.find(socket) != _socketMap.end();
+	}
+
+	std::size_t count() const
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _socketMap.size();
+	}
+
+	void clear()
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_socketMap.clear();
+		_dirty = true;
+	}
+
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	{
+		PollSet::SocketModeMap result;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			if (_dirty)
+			{
+				_pollfds.clear();
+				_sockets.clear();
+				_pollfds.reserve(_socketMap.size());
+				_sockets.reserve(_socketMap.size());
+				for (PollSet::SocketModeMap::const_iterator it = _socketMap.begin(); it != _socketMap.end(); ++it)
+				{
+					pollfd pfd;
+					pfd.fd = it->first.impl()->sockfd();
+					pfd.events = 0;
+					pfd.revents = 0;
+					if (it->second & PollSet::POLL_READ) pfd.events |= POLLIN;
+					if (it->second & PollSet::POLL_WRITE) pfd.events |= POLLOUT;
+					_pollfds.push_back(pfd);
+					_sockets.push_back(it->first);
+				}
+				_dirty = false;
+			}
+		}
+		if (_pollfds.empty()) return result;
+
+		Poco::Timespan remainingTime(timeout);
+		int rc;
+		do
+		{
+			Poco::Timestamp start;
+			rc = ::poll(&_pollfds[0], _pollfds.size(), remainingTime.totalMilliseconds());
+			if (rc < 0 && errno == EINTR)
+			{
+				Poco::Timestamp end;
+				Poco::Timespan waited = end - start;
+				if (waited < remainingTime)
+					remainingTime -= waited;
+				else
+					remainingTime = 0;
+			}
+		}
+		while (rc < 0 && errno == EINTR);
+		if (rc < 0) throw NetException("poll failed", Poco::Error::getMessage(errno));
+
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		for (std::size_t i = 0; i < _pollfds.size() && rc > 0; i++)
+		{
+			if (_pollfds[i].revents)
+			{
+				rc--;
+				PollSet::SocketModeMap::const_iterator it = _socketMap.find(_sockets[i]);
+				if (it != _socketMap.end())
+				{
+					int mode = 0;
+					if (_pollfds[i].revents & (POLLIN | POLLHUP)) mode |= PollSet::POLL_READ;
+					if (_pollfds[i].revents & POLLOUT) mode |= PollSet::POLL_WRITE;
+					if (_pollfds[i].revents & POLLERR) mode |= PollSet::POLL_ERROR;
+					if (mode) result[_sockets[i]] = mode;
+				}
+				_pollfds[i].revents = 0;
+			}
+		}
+		return result;
+	}
+
+private:
+	mutable Poco::FastMutex _mutex;
+	PollSet::SocketModeMap _socketMap;
+	std::vector<pollfd> _pollfds;
+	std::vector<Socket> _sockets;
+	bool _dirty;
+};
+
+
+#else
+
+
+//
+// Fallback implementation using select()
+//
+class PollSetImpl
+{
+public:
+	void add(const Socket& socket, int mode)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_socketMap[socket] = mode;
+	}
+
+	void remove(const Socket& socket)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_socketMap.erase(socket);
+	}
+
+	void update(const Socket& socket, int mode)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		PollSet::SocketModeMap::iterator it = _socketMap.find(socket);
+		if (it == _socketMap.end()) throw Poco::NotFoundException("Socket not in PollSet");
+		it->second = mode;
+	}
+
+	bool has(const Socket& socket) const
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _socketMap.find(socket) != _socketMap.end();
+	}
+
+	std::size_t count() const
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		return _socketMap.size();
+	}
+
+	void clear()
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_socketMap.clear();
+	}
+
+	PollSet::SocketModeMap poll(const Poco::Timespan& timeout)
+	{
+		Socket::SocketList readList;
+		Socket::SocketList writeList;
+		Socket::SocketList exceptList;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			for (PollSet::SocketModeMap::const_iterator it = _socketMap.begin(); it != _socketMap.end(); ++it)
+			{
+				if (it->second & PollSet::POLL_READ) readList.push_back(it->first);
+				if (it->second & PollSet::POLL_WRITE) writeList.push_back(it->first);
+				if (it->second & PollSet::POLL_ERROR) exceptList.push_back(it->first);
+			}
+		}
+
+		PollSet::SocketModeMap result;
+		if (readList.empty() && writeList.empty() && exceptList.empty()) return result;
+
+		if (Socket::select(readList, writeList, exceptList, timeout) > 0)
+		{
+			for (Socket::SocketList::iterator it = readList.begin(); it != readList.end(); ++it)
+				result[*it] |= PollSet::POLL_READ;
+			for (Socket::SocketList::iterator it = writeList.begin(); it != writeList.end(); ++it)
+				result[*it] |= PollSet::POLL_WRITE;
+			for (Socket::SocketList::iterator it = exceptList.begin(); it != exceptList.end(); ++it)
+				result[*it] |= PollSet::POLL_ERROR;
+		}
+		return result;
+	}
+
+private:
+	mutable Poco::FastMutex _mutex;
+	PollSet::SocketModeMap _socketMap;
+};
+
+
+#endif
+
+
+//
+// PollSet
+//
+
+
+PollSet::PollSet():
+	_pImpl(new PollSetImpl)
+{
+}
+
+
+PollSet::~PollSet()
+{
+	delete _pImpl;
+}
+
+
+void PollSet::add(const Socket& socket, int mode)
+{
+	_pImpl->add(socket, mode);
+}
+
+
+void PollSet::remove(const Socket& socket)
+{
+	_pImpl->remove(socket);
+}
+
+
+void PollSet::update(const Socket& socket, int mode)
+{
+	_pImpl->update(socket, mode);
+}
+
+
+bool PollSet::has(const Socket& socket) const
+{
+	return _pImpl->has(socket);
+}
+
+
+bool PollSet::empty() const
+{
+	return _pImpl->count() == 0;
+}
+
+
+std::size_t PollSet::count() const
+{
+	return _pImpl->count();
+}
+
+
+void PollSet::clear()
+{
+	_pImpl->clear();
+}
+
+
+PollSet::SocketModeMap PollSet::poll(const Poco::Timespan& timeout)
+{
+	return _pImpl->poll(timeout);
+}
+
+
+} } // namespace Poco::Net
@@ -282,6 +282,68 @@ int SocketImpl::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int SocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+#if defined(POCO_BROKEN_TIMEOUTS)
+	if (_sndTimeout.totalMicroseconds() != 0)
+	{
+		if (!poll(_sndTimeout, SELECT_WRITE))
+			throw TimeoutException();
+	}
+#endif
+
+	if (buffers.empty()) return 0;
+
+	int rc;
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	DWORD sent = 0;
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+	rc = WSASend(_sockfd, const_cast<LPWSABUF>(&buffers[0]), static_cast<DWORD>(buffers.size()), &sent, static_cast<DWORD>(flags), 0, 0);
+	if (rc == SOCKET_ERROR) error();
+	rc = static_cast<int>(sent);
+#else
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = const_cast<struct iovec*>(&buffers[0]);
+	msg.msg_iovlen = buffers.size();
+	do
+	{
+		if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+		rc = ::sendmsg(_sockfd, &msg, flags);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0) error();
+#endif
+	return rc;
+}
+
+
+void SocketImpl::gatherBuffers(const SocketBufVec& buffers, Poco::Buffer<char>& buffer)
+{
+	std::size_t length = 0;
+	for (SocketBufVec::const_iterator it = buffers.begin(); it != buffers.end(); ++it)
+	{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		length += it->len;
+#else
+		length += it->iov_len;
+#endif
+	}
+	buffer.resize(length, false);
+	char* p = buffer.begin();
+	for (SocketBufVec::const_iterator it = buffers.begin(); it != buffers.end(); ++it)
+	{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		memcpy(p, it->buf, it->len);
+		p += it->len;
+#else
+		memcpy(p, it->iov_base, it->iov_len);
+		p += it->iov_len;
+#endif
+	}
+}
+
+
 int SocketImpl::receiveBytes(void* buffer, int length, int flags)
 {
 #if defined(POCO_BROKEN_TIMEOUTS)
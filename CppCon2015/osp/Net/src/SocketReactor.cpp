@@ -17,6 +17,7 @@
 #include "Poco/Net/SocketReactor.h"
 #include "Poco/Net/SocketNotification.h"
 #include "Poco/Net/SocketNotifier.h"
+#include "Poco/Net/SocketImpl.h"
 #include "Poco/ErrorHandler.h"
 #include "Poco/Thread.h"
 #include "Poco/Exception.h"
@@ -34,6 +35,7 @@ namespace Net {
 SocketReactor::SocketReactor():
 	_stop(false),
 	_timeout(DEFAULT_TIMEOUT),
+	_edgeTriggered(false),
 	_pReadableNotification(new ReadableNotification(this)),
 	_pWritableNotification(new WritableNotification(this)),
 	_pErrorNotification(new ErrorNotification(this)),
@@ -48,6 +50,7 @@ SocketReactor::SocketReactor():
 SocketReactor::SocketReactor(const Poco::Timespan& timeout):
 	_stop(false),
 	_timeout(timeout),
+	_edgeTriggered(false),
 	_pReadableNotification(new ReadableNotification(this)),
 	_pWritableNotification(new WritableNotification(this)),
 	_pErrorNotification(new ErrorNotification(this)),
@@ -68,56 +71,34 @@ void SocketReactor::run()
 {
 	_pThread = Thread::current();
 
-	Socket::SocketList readable;
-	Socket::SocketList writable;
-	Socket::SocketList except;
-	
 	while (!_stop)
 	{
 		try
 		{
-			readable.clear();
-			writable.clear();
-			except.clear();
-			int nSockets = 0;
-			{
-				FastMutex::ScopedLock lock(_mutex);
-				for (EventHandlerMap::iterator it = _handlers.begin(); it != _handlers.end(); ++it)
-				{
-					if (it->second->accepts(_pReadableNotification))
-					{
-						readable.push_back(it->first);
-						nSockets++;
-					}
-					if (it->second->accepts(_pWritableNotification))
-					{
-						writable.push_back(it->first);
-						nSockets++;
-					}
-					if (it->second->accepts(_pErrorNotification))
-					{
-						except.push_back(it->first);
-						nSockets++;
-					}
-				}
-			}
-			if (nSockets == 0)
+			if (_pollSet.empty())
 			{
 				onIdle();
 				Thread::trySleep(_timeout.milliseconds());
 			}
-			else if (Socket::select(readable, writable, except, _timeout))
+			else
 			{
-				onBusy();
-
-				for (Socket::SocketList::iterator it = readable.begin(); it != readable.end(); ++it)
-					dispatch(*it, _pReadableNotification);
-				for (Socket::SocketList::iterator it = writable.begin(); it != writable.end(); ++it)
-					dispatch(*it, _pWritableNotification);
-				for (Socket::SocketList::iterator it = except.begin(); it != except.end(); ++it)
-					dispatch(*it, _pErrorNotification);
+				PollSet::SocketModeMap ready = _pollSet.poll(_timeout);
+				if (!ready.empty())
+				{
+					onBusy();
+
+					for (PollSet::SocketModeMap::iterator it = ready.begin(); it != ready.end(); ++it)
+					{
+						if (it->second & PollSet::POLL_READ)
+							dispatch(it->first, _pReadableNotification);
+						if (it->second & PollSet::POLL_WRITE)
+							dispatch(it->first, _pWritableNotification);
+						if (it->second & PollSet::POLL_ERROR)
+							dispatch(it->first, _pErrorNotification);
+					}
+				}
+				else onTimeout();
 			}
-			else onTimeout();
 		}
 		catch (Exception& exc)
 		{
@@ -160,6 +141,27 @@ const Poco::Timespan& SocketReactor::getTimeout() const
 }
 
 
+void SocketReactor::setEdgeTriggered(bool flag)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (flag != _edgeTriggered)
+	{
+		_edgeTriggered = flag;
+		for (EventHandlerMap::iterator it = _handlers.begin(); it != _handlers.end(); ++it)
+		{
+			updateInterest(it->first, it->second);
+		}
+	}
+}
+
+
+bool SocketReactor::getEdgeTriggered() const
+{
+	return _edgeTriggered;
+}
+
+
 void SocketReactor::addEventHandler(const Socket& socket, const Poco::AbstractObserver& observer)
 {
 	NotifierPtr pNotifier;
@@ -175,7 +177,13 @@ void SocketReactor::addEventHandler(const Socket& socket, const Poco::AbstractOb
 		else pNotifier = it->second;
 	}
 	if (!pNotifier->hasObserver(observer))
+	{
 		pNotifier->addObserver(this, observer);
+
+		FastMutex::ScopedLock lock(_mutex);
+		if (_handlers.find(socket) != _handlers.end())
+			updateInterest(socket, pNotifier);
+	}
 }
 
 
@@ -210,14 +218,37 @@ void SocketReactor::removeEventHandler(const Socket& socket, const Poco::Abstrac
 			if (pNotifier->hasObserver(observer) && pNotifier->countObservers() == 1)
 			{
 				_handlers.erase(it);
+				_pollSet.remove(socket);
 			}
 		}
 	}
 	if (pNotifier && pNotifier->hasObserver(observer))
 	{
 		pNotifier->removeObserver(this, observer);
+
+		FastMutex::ScopedLock lock(_mutex);
+		if (_handlers.find(socket) != _handlers.end())
+			updateInterest(socket, pNotifier);
 	}
+}
+
 
+void SocketReactor::updateInterest(const Socket& socket, NotifierPtr& pNotifier)
+{
+	int mode = 0;
+	if (pNotifier->accepts(_pReadableNotification)) mode |= PollSet::POLL_READ;
+	if (pNotifier->accepts(_pWritableNotification)) mode |= PollSet::POLL_WRITE;
+	if (pNotifier->accepts(_pErrorNotification)) mode |= PollSet::POLL_ERROR;
+
+	if (mode == 0 || !socket.impl()->initialized())
+	{
+		_pollSet.remove(socket);
+	}
+	else
+	{
+		if (_edgeTriggered) mode |= PollSet::POLL_EDGE;
+		_pollSet.add(socket, mode);
+	}
 }
 
 
@@ -72,4 +72,36 @@ int StreamSocketImpl::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int StreamSocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	int sent = SocketImpl::sendBytes(buffers, flags);
+	if (sent < 0 || !getBlocking()) return sent;
+
+	// Send what is left of the buffers after a partial send.
+	std::size_t offset = sent;
+	for (SocketBufVec::const_iterator it = buffers.begin(); it != buffers.end(); ++it)
+	{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		const char* p = it->buf;
+		std::size_t length = it->len;
+#else
+		const char* p = reinterpret_cast<const char*>(it->iov_base);
+		std::size_t length = it->iov_len;
+#endif
+		if (offset >= length)
+		{
+			offset -= length;
+		}
+		else
+		{
+			int n = StreamSocketImpl::sendBytes(p + offset, static_cast<int>(length - offset), flags);
+			if (n < 0) break;
+			sent += n;
+			offset = 0;
+		}
+	}
+	return sent;
+}
+
+
 } } // namespace Poco::Net
@@ -182,6 +182,12 @@ int TCPServer::refusedConnections() const
 }
 
 
+int TCPServer::parkedConnections() const
+{
+	return _pDispatcher->parkedConnections();
+}
+
+
 std::string TCPServer::threadName(const ServerSocket& socket)
 {
 #if _WIN32_WCE == 0x0800
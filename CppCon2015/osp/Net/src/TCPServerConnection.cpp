@@ -28,7 +28,8 @@ namespace Net {
 
 
 TCPServerConnection::TCPServerConnection(const StreamSocket& socket):
-	_socket(socket)
+	_socket(socket),
+	_parked(false)
 {
 }
 
@@ -40,23 +41,34 @@ TCPServerConnection::~TCPServerConnection()
 
 void TCPServerConnection::start()
 {
+	_parked = false;
 	try
 	{
 		run();
 	}
 	catch (Exception& exc)
 	{
+		_parked = false;
 		ErrorHandler::handle(exc);
 	}
 	catch (std::exception& exc)
 	{
+		_parked = false;
 		ErrorHandler::handle(exc);
 	}
 	catch (...)
 	{
+		_parked = false;
 		ErrorHandler::handle();
 	}
 }
 
 
+void TCPServerConnection::park(const Poco::Timespan& idleTimeout)
+{
+	_parkTimeout = idleTimeout;
+	_parked = true;
+}
+
+
 } } // namespace Poco::Net
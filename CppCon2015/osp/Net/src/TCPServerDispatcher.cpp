@@ -18,6 +18,7 @@
 #include "Poco/Net/TCPServerConnectionFactory.h"
 #include "Poco/Notification.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/ErrorHandler.h"
 #include <memory>
 
 
@@ -52,6 +53,31 @@ private:
 };
 
 
+class TCPResumeNotification: public Notification
+{
+public:
+	TCPResumeNotification(TCPServerConnection* pConnection):
+		_pConnection(pConnection)
+	{
+	}
+	
+	~TCPResumeNotification()
+	{
+		delete _pConnection;
+	}
+	
+	TCPServerConnection* release()
+	{
+		TCPServerConnection* pConnection = _pConnection;
+		_pConnection = 0;
+		return pConnection;
+	}
+
+private:
+	TCPServerConnection* _pConnection;
+};
+
+
 TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::ThreadPool& threadPool, TCPServerParams::Ptr pParams):
 	_rc(1),
 	_pParams(pParams),
@@ -62,7 +88,10 @@ TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactor
 	_refusedConnections(0),
 	_stopped(false),
 	_pConnectionFactory(pFactory),
-	_threadPool(threadPool)
+	_threadPool(threadPool),
+	_reactorThread("TCPServerReactor"),
+	_reactorRunnable(*this, &TCPServerDispatcher::runReactor),
+	_reactorStarted(false)
 {
 	poco_check_ptr (pFactory);
 
@@ -76,6 +105,14 @@ TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactor
 
 TCPServerDispatcher::~TCPServerDispatcher()
 {
+	try
+	{
+		stopReactor();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
 }
 
 
@@ -107,14 +144,31 @@ void TCPServerDispatcher::run()
 		AutoPtr<Notification> pNf = _queue.waitDequeueNotification(idleTime);
 		if (pNf)
 		{
+			std::auto_ptr<TCPServerConnection> pConnection;
 			TCPConnectionNotification* pCNf = dynamic_cast<TCPConnectionNotification*>(pNf.get());
 			if (pCNf)
 			{
-				std::auto_ptr<TCPServerConnection> pConnection(_pConnectionFactory->createConnection(pCNf->socket()));
+				pConnection.reset(_pConnectionFactory->createConnection(pCNf->socket()));
 				poco_check_ptr(pConnection.get());
 				beginConnection();
+			}
+			else
+			{
+				TCPResumeNotification* pRNf = dynamic_cast<TCPResumeNotification*>(pNf.get());
+				if (pRNf)
+				{
+					pConnection.reset(pRNf->release());
+					resumeConnection();
+				}
+			}
+			if (pConnection.get())
+			{
 				pConnection->start();
 				endConnection();
+				if (pConnection->parked())
+				{
+					park(pConnection.release());
+				}
 			}
 		}
 	
@@ -141,19 +195,7 @@ void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 	if (_queue.size() < _pParams->getMaxQueued())
 	{
 		_queue.enqueueNotification(new TCPConnectionNotification(socket));
-		if (!_queue.hasIdleThreads() && _currentThreads < _pParams->getMaxThreads())
-		{
-			try
-			{
-				_threadPool.startWithPriority(_pParams->getThreadPriority(), *this, threadName);
-				++_currentThreads;
-			}
-			catch (Poco::Exception&)
-			{
-				// no problem here, connection is already queued
-				// and a new thread might be available later.
-			}
-		}
+		startThread();
 	}
 	else
 	{
@@ -162,11 +204,150 @@ void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 }
 
 
+void TCPServerDispatcher::startThread()
+{
+	if (!_queue.hasIdleThreads() && _currentThreads < _pParams->getMaxThreads())
+	{
+		try
+		{
+			_threadPool.startWithPriority(_pParams->getThreadPriority(), *this, threadName);
+			++_currentThreads;
+		}
+		catch (Poco::Exception&)
+		{
+			// no problem here, connection is already queued
+			// and a new thread might be available later.
+		}
+	}
+}
+
+
 void TCPServerDispatcher::stop()
 {
 	_stopped = true;
 	_queue.clear();
 	_queue.wakeUpAll();
+	stopReactor();
+}
+
+
+void TCPServerDispatcher::park(TCPServerConnection* pConnection)
+{
+	std::auto_ptr<TCPServerConnection> pGuard(pConnection);
+
+	FastMutex::ScopedLock lock(_parkMutex);
+
+	if (_stopped) return;
+
+	const StreamSocket& socket = pConnection->socket();
+	if (!socket.impl()->initialized()) return;
+
+	// If the socket has already been closed, this throws and 
+	// the connection is destroyed.
+	_parkedSet.add(socket, PollSet::POLL_READ | PollSet::POLL_ERROR);
+	ParkedConnection& parked = _parked[socket];
+	parked.pConnection = pGuard.release();
+	parked.timeout = pConnection->parkTimeout();
+	parked.parkedAt.update();
+
+	if (!_reactorStarted)
+	{
+		_reactorThread.start(_reactorRunnable);
+		_reactorStarted = true;
+	}
+	_parkedEvent.set();
+}
+
+
+void TCPServerDispatcher::resume(TCPServerConnection* pConnection)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_queue.enqueueNotification(new TCPResumeNotification(pConnection));
+	startThread();
+}
+
+
+void TCPServerDispatcher::runReactor()
+{
+	Poco::Timespan pollInterval(0, REACTOR_POLL_INTERVAL*1000);
+	while (!_stopped)
+	{
+		try
+		{
+			if (_parkedSet.empty())
+			{
+				_parkedEvent.tryWait(REACTOR_POLL_INTERVAL);
+				continue;
+			}
+			
+			PollSet::SocketModeMap ready = _parkedSet.poll(pollInterval);
+			
+			FastMutex::ScopedLock lock(_parkMutex);
+			
+			if (_stopped) break;
+			for (PollSet::SocketModeMap::const_iterator it = ready.begin(); it != ready.end(); ++it)
+			{
+				_parkedSet.remove(it->first);
+				ParkedMap::iterator itp = _parked.find(it->first);
+				if (itp != _parked.end())
+				{
+					TCPServerConnection* pConnection = itp->second.pConnection;
+					_parked.erase(itp);
+					resume(pConnection);
+				}
+			}
+			
+			Poco::Timestamp now;
+			ParkedMap::iterator itp = _parked.begin();
+			while (itp != _parked.end())
+			{
+				if (now - itp->second.parkedAt >= itp->second.timeout.totalMicroseconds())
+				{
+					_parkedSet.remove(itp->first);
+					delete itp->second.pConnection;
+					_parked.erase(itp++);
+				}
+				else ++itp;
+			}
+		}
+		catch (Poco::Exception& exc)
+		{
+			Poco::ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			Poco::ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			Poco::ErrorHandler::handle();
+		}
+	}
+}
+
+
+void TCPServerDispatcher::stopReactor()
+{
+	bool started;
+	{
+		FastMutex::ScopedLock lock(_parkMutex);
+		started = _reactorStarted;
+	}
+	if (started)
+	{
+		_parkedEvent.set();
+		_reactorThread.join();
+	}
+
+	FastMutex::ScopedLock lock(_parkMutex);
+
+	for (ParkedMap::iterator it = _parked.begin(); it != _parked.end(); ++it)
+	{
+		delete it->second.pConnection;
+	}
+	_parked.clear();
+	_parkedSet.clear();
 }
 
 
@@ -223,6 +404,14 @@ int TCPServerDispatcher::refusedConnections() const
 }
 
 
+int TCPServerDispatcher::parkedConnections() const
+{
+	FastMutex::ScopedLock lock(_parkMutex);
+	
+	return static_cast<int>(_parked.size());
+}
+
+
 void TCPServerDispatcher::beginConnection()
 {
 	FastMutex::ScopedLock lock(_mutex);
@@ -242,4 +431,14 @@ void TCPServerDispatcher::endConnection()
 }
 
 
+void TCPServerDispatcher::resumeConnection()
+{
+	FastMutex::ScopedLock lock(_mutex);
+	
+	++_currentConnections;
+	if (_currentConnections > _maxConcurrentConnections)
+		_maxConcurrentConnections = _currentConnections;
+}
+
+
 } } // namespace Poco::Net
@@ -30,6 +30,7 @@
 #include "Poco/Random.h"
 #include "Poco/StreamCopier.h"
 #include <sstream>
+#include <memory>
 
 
 namespace Poco {
@@ -46,6 +47,12 @@ WebSocket::WebSocket(HTTPServerRequest& request, HTTPServerResponse& response):
 {
 }
 
+
+WebSocket::WebSocket(HTTPServerRequest& request, HTTPServerResponse& response, const PerMessageDeflate::Params& deflateParams):
+	StreamSocket(accept(request, response, &deflateParams))
+{
+}
+
 	
 WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response):
 	StreamSocket(connect(cs, request, response, _defaultCreds))
@@ -59,6 +66,18 @@ WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse&
 }
 
 
+WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, const PerMessageDeflate::Params& deflateParams):
+	StreamSocket(connect(cs, request, response, _defaultCreds, &deflateParams))
+{
+}
+
+
+WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials, const PerMessageDeflate::Params& deflateParams):
+	StreamSocket(connect(cs, request, response, credentials, &deflateParams))
+{
+}
+
+
 WebSocket::WebSocket(const Socket& socket): 
 	StreamSocket(socket)
 {
@@ -113,6 +132,14 @@ int WebSocket::receiveFrame(void* buffer, int length, int& flags)
 	return n;
 }
 
+
+int WebSocket::receiveFrame(Poco::Buffer<char>& buffer, int maxPayloadSize, int& flags)
+{
+	int n = static_cast<WebSocketImpl*>(impl())->receiveBytes(buffer, maxPayloadSize, 0);
+	flags = static_cast<WebSocketImpl*>(impl())->frameFlags();
+	return n;
+}
+
 	
 WebSocket::Mode WebSocket::mode() const
 {
@@ -120,7 +147,7 @@ WebSocket::Mode WebSocket::mode() const
 }
 
 
-WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse& response)
+WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse& response, const PerMessageDeflate::Params* pDeflateParams)
 {
 	if (request.hasToken("Connection", "upgrade") && icompare(request.get("Upgrade", ""), "websocket") == 0)
 	{
@@ -135,15 +162,26 @@ WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse&
 		response.set("Upgrade", "websocket");
 		response.set("Connection", "Upgrade");
 		response.set("Sec-WebSocket-Accept", computeAccept(key));
+		std::auto_ptr<PerMessageDeflate> pDeflate;
+		if (pDeflateParams)
+		{
+			PerMessageDeflate::Params negotiated;
+			std::string extensions;
+			if (PerMessageDeflate::accept(request.get("Sec-WebSocket-Extensions", ""), *pDeflateParams, negotiated, extensions))
+			{
+				pDeflate.reset(new PerMessageDeflate(negotiated, true));
+				response.set("Sec-WebSocket-Extensions", extensions);
+			}
+		}
 		response.setContentLength(0);
 		response.send().flush();
-		return new WebSocketImpl(static_cast<StreamSocketImpl*>(static_cast<HTTPServerRequestImpl&>(request).detachSocket().impl()), false);
+		return new WebSocketImpl(static_cast<StreamSocketImpl*>(static_cast<HTTPServerRequestImpl&>(request).detachSocket().impl()), false, pDeflate.release());
 	}
 	else throw WebSocketException("No WebSocket handshake", WS_ERR_NO_HANDSHAKE);
 }
 
 
-WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials)
+WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials, const PerMessageDeflate::Params* pDeflateParams)
 {
 	if (!cs.getProxyHost().empty() && !cs.secure())
 	{
@@ -154,13 +192,15 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 	request.set("Upgrade", "websocket");
 	request.set("Sec-WebSocket-Version", WEBSOCKET_VERSION);
 	request.set("Sec-WebSocket-Key", key);
+	if (pDeflateParams)
+		request.set("Sec-WebSocket-Extensions", PerMessageDeflate::offer(*pDeflateParams));
 	request.setChunkedTransferEncoding(false);
 	cs.setKeepAlive(true);
 	cs.sendRequest(request);
 	std::istream& istr = cs.receiveResponse(response);
 	if (response.getStatus() == HTTPResponse::HTTP_SWITCHING_PROTOCOLS)
 	{
-		return completeHandshake(cs, response, key);
+		return completeHandshake(cs, response, key, pDeflateParams);
 	}
 	else if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
 	{
@@ -176,7 +216,7 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 		cs.receiveResponse(response);
 		if (response.getStatus() == HTTPResponse::HTTP_SWITCHING_PROTOCOLS)
 		{
-			return completeHandshake(cs, response, key);
+			return completeHandshake(cs, response, key, pDeflateParams);
 		}
 		else if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
 		{
@@ -194,7 +234,7 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 }
 
 
-WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key)
+WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key, const PerMessageDeflate::Params* pDeflateParams)
 {
 	std::string connection = response.get("Connection", "");
 	if (Poco::icompare(connection, "Upgrade") != 0) 
@@ -205,7 +245,14 @@ WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse&
 	std::string accept = response.get("Sec-WebSocket-Accept", "");
 	if (accept != computeAccept(key))
 		throw WebSocketException("Invalid or missing Sec-WebSocket-Accept header in handshake response", WS_ERR_NO_HANDSHAKE);
-	return new WebSocketImpl(static_cast<StreamSocketImpl*>(cs.detachSocket().impl()), true);
+	std::auto_ptr<PerMessageDeflate> pDeflate;
+	if (pDeflateParams)
+	{
+		PerMessageDeflate::Params negotiated;
+		if (PerMessageDeflate::confirm(response.get("Sec-WebSocket-Extensions", ""), *pDeflateParams, negotiated))
+			pDeflate.reset(new PerMessageDeflate(negotiated, false));
+	}
+	return new WebSocketImpl(static_cast<StreamSocketImpl*>(cs.detachSocket().impl()), true, pDeflate.release());
 }
 
 
@@ -23,17 +23,30 @@
 #include "Poco/MemoryStream.h"
 #include "Poco/Format.h"
 #include <cstring>
+#include <limits>
+#if defined(__AVX2__)
+#define POCO_WEBSOCKET_HAVE_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define POCO_WEBSOCKET_HAVE_SSE2
+#include <emmintrin.h>
+#endif
 
 
 namespace Poco {
 namespace Net {
 
 
-WebSocketImpl::WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, bool mustMaskPayload):
+WebSocketImpl::WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, bool mustMaskPayload, PerMessageDeflate* pDeflate):
 	StreamSocketImpl(pStreamSocketImpl->sockfd()),
 	_pStreamSocketImpl(pStreamSocketImpl),
 	_frameFlags(0),
-	_mustMaskPayload(mustMaskPayload)
+	_mustMaskPayload(mustMaskPayload),
+	_pDeflate(pDeflate),
+	_deflateBuffer(0),
+	_inflateBuffer(0),
+	_inflating(false)
 {
 	poco_check_ptr(pStreamSocketImpl);
 	_pStreamSocketImpl->duplicate();
@@ -51,17 +64,33 @@ WebSocketImpl::~WebSocketImpl()
 	{
 		poco_unexpected();
 	}
+	delete _pDeflate;
 }
 
 	
 int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
 {
-	Poco::Buffer<char> frame(length + MAX_HEADER_LENGTH);
-	Poco::MemoryOutputStream ostr(frame.begin(), frame.size());
-	Poco::BinaryWriter writer(ostr, Poco::BinaryWriter::NETWORK_BYTE_ORDER);
-	
 	if (flags == 0) flags = WebSocket::FRAME_BINARY;
 	flags &= 0xff;
+	if (mustCompress(flags, length))
+	{
+		_pDeflate->deflate(reinterpret_cast<const char*>(buffer), length, _deflateBuffer);
+		sendFrame(_deflateBuffer.begin(), static_cast<int>(_deflateBuffer.size()), flags | WebSocket::FRAME_FLAG_RSV1);
+	}
+	else
+	{
+		sendFrame(buffer, length, flags);
+	}
+	return length;
+}
+
+
+void WebSocketImpl::sendFrame(const void* buffer, int length, int flags)
+{
+	char header[MAX_HEADER_LENGTH];
+	Poco::MemoryOutputStream ostr(header, sizeof(header));
+	Poco::BinaryWriter writer(ostr, Poco::BinaryWriter::NETWORK_BYTE_ORDER);
+	
 	writer << static_cast<Poco::UInt8>(flags);
 	Poco::UInt8 lengthByte(0);
 	if (_mustMaskPayload)
@@ -87,26 +116,100 @@ int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
 	{
 		const Poco::UInt32 mask = _rnd.next();
 		const char* m = reinterpret_cast<const char*>(&mask);
-		const char* b = reinterpret_cast<const char*>(buffer);
 		writer.writeRaw(m, 4);
-		char* p = frame.begin() + ostr.charsWritten();
-		for (int i = 0; i < length; i++)
-		{
-			p[i] = b[i] ^ m[i % 4];
-		}
+		const int headerLength = static_cast<int>(ostr.charsWritten());
+		Poco::Buffer<char> frame(headerLength + length);
+		std::memcpy(frame.begin(), header, headerLength);
+		applyMask(reinterpret_cast<const char*>(buffer), frame.begin() + headerLength, length, m);
+		_pStreamSocketImpl->sendBytes(frame.begin(), headerLength + length);
 	}
 	else
 	{
-		std::memcpy(frame.begin() + ostr.charsWritten(), buffer, length);
+		// Unmasked payload can be sent directly from the caller's buffer.
+		// Socket implementations that cannot send both buffers with a
+		// single write (SecureStreamSocketImpl, TunnelSocketImpl) 
+		// combine them into one buffer first.
+		SocketBufVec buffers(2);
+		buffers[0] = Socket::makeBuffer(header, ostr.charsWritten());
+		buffers[1] = Socket::makeBuffer(const_cast<void*>(buffer), length);
+		_pStreamSocketImpl->sendBytes(buffers);
 	}
-	_pStreamSocketImpl->sendBytes(frame.begin(), length + static_cast<int>(ostr.charsWritten()));
-	return length;
+}
+
+
+bool WebSocketImpl::mustCompress(int flags, int length) const
+{
+	if (!_pDeflate || !_pDeflate->mustCompress(length)) return false;
+	
+	// Only single-frame data messages are compressed.
+	const int opcode = flags & WebSocket::FRAME_OP_BITMASK;
+	return (flags & WebSocket::FRAME_FLAG_FIN) 
+		&& (flags & (WebSocket::FRAME_FLAG_RSV1 | WebSocket::FRAME_FLAG_RSV2 | WebSocket::FRAME_FLAG_RSV3)) == 0
+		&& (opcode == WebSocket::FRAME_OP_TEXT || opcode == WebSocket::FRAME_OP_BINARY);
+}
+
+
+int WebSocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	throw Poco::InvalidAccessException("Cannot sendBytes() a SocketBufVec on a WebSocketImpl");
 }
 
 	
 int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 {
 	char header[MAX_HEADER_LENGTH];
+	int payloadOffset;
+	Poco::UInt64 payloadLength;
+	char mask[4];
+	bool useMask;
+	int n = receiveHeader(header, payloadOffset, payloadLength, mask, useMask);
+	if (n <= 0) return n;
+	if (mustInflate())
+	{
+		// Allow for the overhead of incompressible data.
+		if (payloadLength > static_cast<Poco::UInt64>(length) + (length >> 10) + 64) 
+			throw WebSocketException(Poco::format("Insufficient buffer for compressed payload size %Lu", payloadLength), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		_inflateBuffer.resize(static_cast<std::size_t>(payloadLength), false);
+		receivePayload(_inflateBuffer.begin(), static_cast<int>(payloadLength), header + payloadOffset, n - payloadOffset, useMask ? mask : 0);
+		return _pDeflate->inflate(_inflateBuffer.begin(), static_cast<int>(payloadLength), (_frameFlags & WebSocket::FRAME_FLAG_FIN) != 0, reinterpret_cast<char*>(buffer), length);
+	}
+	if (payloadLength > static_cast<Poco::UInt64>(length)) 
+		throw WebSocketException(Poco::format("Insufficient buffer for payload size %Lu", payloadLength), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	return receivePayload(reinterpret_cast<char*>(buffer), static_cast<int>(payloadLength), header + payloadOffset, n - payloadOffset, useMask ? mask : 0);
+}
+
+
+int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int maxPayloadSize, int)
+{
+	char header[MAX_HEADER_LENGTH];
+	int payloadOffset;
+	Poco::UInt64 payloadLength;
+	char mask[4];
+	bool useMask;
+	int n = receiveHeader(header, payloadOffset, payloadLength, mask, useMask);
+	if (n <= 0) return n;
+	const std::size_t offset = buffer.size();
+	if (mustInflate())
+	{
+		// Allow for the overhead of incompressible data.
+		if (payloadLength > static_cast<Poco::UInt64>(maxPayloadSize) + (maxPayloadSize >> 10) + 64) 
+			throw WebSocketException(Poco::format("Compressed payload size %Lu exceeds maximum payload size %d", payloadLength, maxPayloadSize), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		_inflateBuffer.resize(static_cast<std::size_t>(payloadLength), false);
+		receivePayload(_inflateBuffer.begin(), static_cast<int>(payloadLength), header + payloadOffset, n - payloadOffset, useMask ? mask : 0);
+		_pDeflate->inflate(_inflateBuffer.begin(), static_cast<int>(payloadLength), (_frameFlags & WebSocket::FRAME_FLAG_FIN) != 0, buffer, maxPayloadSize);
+		return static_cast<int>(buffer.size() - offset);
+	}
+	if (payloadLength > static_cast<Poco::UInt64>(maxPayloadSize)) 
+		throw WebSocketException(Poco::format("Payload size %Lu exceeds maximum payload size %d", payloadLength, maxPayloadSize), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	if (payloadLength > static_cast<Poco::UInt64>(std::numeric_limits<int>::max()) - offset) 
+		throw WebSocketException(Poco::format("Payload size %Lu too big", payloadLength), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	buffer.resize(offset + static_cast<std::size_t>(payloadLength));
+	return receivePayload(buffer.begin() + offset, static_cast<int>(payloadLength), header + payloadOffset, n - payloadOffset, useMask ? mask : 0);
+}
+
+
+int WebSocketImpl::receiveHeader(char* header, int& payloadOffset, Poco::UInt64& payloadLength, char* mask, bool& useMask)
+{
 	int n = receiveNBytes(header, 2);
 	if (n <= 0)
 	{
@@ -120,6 +223,7 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 	lengthByte &= 0x7f;
 	if (lengthByte > 0 || maskOffset > 0)
 	{
+		// For small frames, this also receives (part of) the payload.
 		if (lengthByte + 2 + maskOffset < MAX_HEADER_LENGTH)
 		{
 			n = receiveNBytes(header + 2, lengthByte + maskOffset);
@@ -134,62 +238,114 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 	Poco::MemoryInputStream istr(header, n);
 	Poco::BinaryReader reader(istr, Poco::BinaryReader::NETWORK_BYTE_ORDER);
 	Poco::UInt8 flags;
-	char mask[4];
 	reader >> flags >> lengthByte;
 	_frameFlags = flags;
-	int payloadLength = 0;
-	int payloadOffset = 2;
+	payloadOffset = 2;
 	if ((lengthByte & 0x7f) == 127)
 	{
-		Poco::UInt64 l;
-		reader >> l;
-		if (l > length) throw WebSocketException(Poco::format("Insufficient buffer for payload size %Lu", l), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
-		payloadLength = static_cast<int>(l);
+		reader >> payloadLength;
 		payloadOffset += 8;
 	}
 	else if ((lengthByte & 0x7f) == 126)
 	{
 		Poco::UInt16 l;
 		reader >> l;
-		if (l > length) throw WebSocketException(Poco::format("Insufficient buffer for payload size %hu", l), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
-		payloadLength = static_cast<int>(l);
+		payloadLength = l;
 		payloadOffset += 2;
 	}
 	else
 	{
-		Poco::UInt8 l = lengthByte & 0x7f;
-		if (l > length) throw WebSocketException(Poco::format("Insufficient buffer for payload size %u", unsigned(l)), WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
-		payloadLength = static_cast<int>(l);
+		payloadLength = lengthByte & 0x7f;
 	}
-	if (lengthByte & FRAME_FLAG_MASK)
+	useMask = (lengthByte & FRAME_FLAG_MASK) != 0;
+	if (useMask)
 	{
 		reader.readRaw(mask, 4);
 		payloadOffset += 4;
 	}
+	return n;
+}
+
+
+bool WebSocketImpl::mustInflate()
+{
+	if (!_pDeflate) return false;
+
+	bool inflate;
+	const int opcode = _frameFlags & WebSocket::FRAME_OP_BITMASK;
+	if (opcode == WebSocket::FRAME_OP_TEXT || opcode == WebSocket::FRAME_OP_BINARY)
+		inflate = (_frameFlags & WebSocket::FRAME_FLAG_RSV1) != 0;
+	else if (opcode == WebSocket::FRAME_OP_CONT)
+		inflate = _inflating;
+	else
+		return false; // control frames are never compressed
+
+	_inflating = inflate && (_frameFlags & WebSocket::FRAME_FLAG_FIN) == 0;
+	if (inflate) _frameFlags &= ~WebSocket::FRAME_FLAG_RSV1;
+	return inflate;
+}
+
+
+int WebSocketImpl::receivePayload(char* buffer, int payloadLength, const char* prefix, int prefixLength, const char* mask)
+{
 	int received = 0;
-	if (payloadOffset < n)
+	if (prefixLength > 0)
 	{
-		std::memcpy(buffer, header + payloadOffset, n - payloadOffset);
-		received = n - payloadOffset;
+		std::memcpy(buffer, prefix, prefixLength);
+		received = prefixLength;
 	}
 	if (received < payloadLength)
 	{
-		n = receiveNBytes(reinterpret_cast<char*>(buffer) + received, payloadLength - received);
+		int n = receiveNBytes(buffer + received, payloadLength - received);
 		if (n <= 0) throw WebSocketException("Incomplete frame received", WebSocket::WS_ERR_INCOMPLETE_FRAME);
 		received += n;
 	}
-	if (lengthByte & FRAME_FLAG_MASK)
+	if (mask)
 	{
-		char* p = reinterpret_cast<char*>(buffer);
-		for (int i = 0; i < received; i++)
-		{
-			p[i] ^= mask[i % 4];
-		}
+		applyMask(buffer, buffer, received, mask);
 	}
 	return received;
 }
 
 
+void WebSocketImpl::applyMask(const char* src, char* dst, int length, const char* mask)
+{
+	Poco::UInt32 mask32;
+	std::memcpy(&mask32, mask, 4);
+	int i = 0;
+#if defined(POCO_WEBSOCKET_HAVE_AVX2)
+	const __m256i mask256 = _mm256_set1_epi32(static_cast<int>(mask32));
+	for (; i + 32 <= length; i += 32)
+	{
+		__m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(data, mask256));
+	}
+#endif
+#if defined(POCO_WEBSOCKET_HAVE_SSE2)
+	const __m128i mask128 = _mm_set1_epi32(static_cast<int>(mask32));
+	for (; i + 16 <= length; i += 16)
+	{
+		__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(data, mask128));
+	}
+#endif
+	// Since i is a multiple of 4 here, the mask is still aligned
+	// with the data in the following loops.
+	const Poco::UInt64 mask64 = (static_cast<Poco::UInt64>(mask32) << 32) | mask32;
+	for (; i + 8 <= length; i += 8)
+	{
+		Poco::UInt64 data;
+		std::memcpy(&data, src + i, 8);
+		data ^= mask64;
+		std::memcpy(dst + i, &data, 8);
+	}
+	for (; i < length; i++)
+	{
+		dst[i] = src[i] ^ mask[i & 3];
+	}
+}
+
+
 int WebSocketImpl::receiveNBytes(void* buffer, int bytes)
 {
 	int received = _pStreamSocketImpl->receiveBytes(reinterpret_cast<char*>(buffer), bytes);
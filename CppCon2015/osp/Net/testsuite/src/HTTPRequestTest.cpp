@@ -154,6 +154,42 @@ void HTTPRequestTest::testRead4()
 }
 
 
+void HTTPRequestTest::testParse()
+{
+	std::string s("\r\nPOST /test.cgi HTTP/1.1\r\nConnection: Close\r\nContent-Length:   100  \r\nContent-Type: text/plain\r\n\r\nbody");
+	HTTPRequest request;
+	const char* end = request.parse(s.data(), s.data() + s.size());
+	assert (std::string(end) == "body");
+	assert (request.getMethod() == HTTPRequest::HTTP_POST);
+	assert (request.getURI() == "/test.cgi");
+	assert (request.getVersion() == HTTPMessage::HTTP_1_1);
+	assert (request.size() == 3);
+	assert (request["Connection"] == "Close");
+	assert (request.getContentType() == "text/plain");
+	assert (request.getContentLength() == 100);
+	
+	s.assign(256, 'x');
+	try
+	{
+		request.parse(s.data(), s.data() + s.size());
+		fail("invalid request - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+	
+	s = "GET /test.cgi";
+	try
+	{
+		request.parse(s.data(), s.data() + s.size());
+		fail("incomplete request - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+}
+
+
 void HTTPRequestTest::testInvalid1()
 {
 	std::string s(256, 'x');
@@ -260,6 +296,7 @@ CppUnit::Test* HTTPRequestTest::suite()
 	CppUnit_addTest(pSuite, HTTPRequestTest, testRead2);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testRead3);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testRead4);
+	CppUnit_addTest(pSuite, HTTPRequestTest, testParse);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testInvalid1);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testInvalid2);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testInvalid3);
@@ -34,6 +34,7 @@ public:
 	void testRead2();
 	void testRead3();
 	void testRead4();
+	void testParse();
 	void testInvalid1();
 	void testInvalid2();
 	void testInvalid3();
@@ -24,6 +24,8 @@
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/TemporaryFile.h"
+#include "Poco/FileStream.h"
 #include <sstream>
 
 
@@ -40,6 +42,7 @@ using Poco::Net::HTTPServerResponse;
 using Poco::Net::HTTPMessage;
 using Poco::Net::ServerSocket;
 using Poco::StreamCopier;
+using Poco::TemporaryFile;
 
 
 namespace
@@ -106,6 +109,17 @@ namespace
 		}
 	};
 	
+	std::string filePath;
+	
+	class FileRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.sendFile(filePath, "text/plain");
+		}
+	};
+	
 	class RequestHandlerFactory: public HTTPRequestHandlerFactory
 	{
 	public:
@@ -121,6 +135,8 @@ namespace
 				return new AuthRequestHandler();
 			else if (request.getURI() == "/buffer")
 				return new BufferRequestHandler();
+			else if (request.getURI() == "/file")
+				return new FileRequestHandler();
 			else
 				return 0;
 		}
@@ -416,6 +432,60 @@ void HTTPServerTest::testKeepAliveTimeout()
 }
 
 
+void HTTPServerTest::testParkIdleConnections()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setKeepAliveTimeout(Poco::Timespan(10, 0));
+	pParams->setParkIdleConnections(true);
+	pParams->setMaxThreads(1);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+	
+	// With a single server thread, the second session would have to wait 
+	// for the keep-alive timeout of the first one, if the first 
+	// connection were not parked.
+	HTTPClientSession cs1("localhost", svs.address().port());
+	cs1.setKeepAlive(true);
+	HTTPClientSession cs2("localhost", svs.address().port());
+	cs2.setKeepAlive(true);
+	cs2.setTimeout(Poco::Timespan(5, 0));
+	HTTPRequest request("POST", "/echoBody", HTTPMessage::HTTP_1_1);
+	request.setContentType("text/plain");
+	request.setChunkedTransferEncoding(true);
+	std::string body(5000, 'x');
+	for (int i = 0; i < 3; ++i)
+	{
+		HTTPClientSession& cs = (i % 2) ? cs2 : cs1;
+		cs.sendRequest(request) << body;
+		HTTPResponse response;
+		std::string rbody;
+		cs.receiveResponse(response) >> rbody;
+		assert (response.getChunkedTransferEncoding());
+		assert (response.getKeepAlive());
+		assert (rbody == body);
+	}
+	
+	Poco::Thread::sleep(200);
+	assert (srv.parkedConnections() == 2);
+	assert (srv.totalConnections() == 2);
+	
+	{
+		request.setKeepAlive(false);
+		cs2.sendRequest(request) << body;
+		HTTPResponse response;
+		std::string rbody;
+		cs2.receiveResponse(response) >> rbody;
+		assert (!response.getKeepAlive());
+		assert (rbody == body);
+	}
+
+	Poco::Thread::sleep(200);
+	assert (srv.parkedConnections() == 1);
+}
+
+
 void HTTPServerTest::test100Continue()
 {
 	ServerSocket svs(0);
@@ -518,6 +588,135 @@ void HTTPServerTest::testBuffer()
 }
 
 
+void HTTPServerTest::testFile()
+{
+	TemporaryFile tf;
+	std::string data;
+	for (int i = 0; i < 20000; i++) data += static_cast<char>('a' + i % 26);
+	Poco::FileOutputStream ostr(tf.path());
+	ostr << data;
+	ostr.close();
+	filePath = tf.path();
+
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+	
+	HTTPClientSession cs("localhost", svs.address().port());
+	HTTPRequest request("GET", "/file");
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::string rbody;
+	StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+	assert (response.getStatus() == HTTPResponse::HTTP_OK);
+	assert (response.getContentLength() == static_cast<int>(data.size()));
+	assert (response.get("Accept-Ranges") == "bytes");
+	assert (response.has("Last-Modified"));
+	assert (rbody == data);
+}
+
+
+void HTTPServerTest::testFileRange()
+{
+	TemporaryFile tf;
+	std::string data;
+	for (int i = 0; i < 20000; i++) data += static_cast<char>('a' + i % 26);
+	Poco::FileOutputStream ostr(tf.path());
+	ostr << data;
+	ostr.close();
+	filePath = tf.path();
+
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+	
+	{
+		HTTPClientSession cs("localhost", svs.address().port());
+		HTTPRequest request("GET", "/file");
+		request.set("Range", "bytes=100-199");
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_PARTIAL_CONTENT);
+		assert (response.get("Content-Range") == "bytes 100-199/20000");
+		assert (response.getContentLength() == 100);
+		assert (rbody == data.substr(100, 100));
+	}
+	{
+		HTTPClientSession cs("localhost", svs.address().port());
+		HTTPRequest request("GET", "/file");
+		request.set("Range", "bytes=19000-");
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_PARTIAL_CONTENT);
+		assert (response.get("Content-Range") == "bytes 19000-19999/20000");
+		assert (rbody == data.substr(19000));
+	}
+	{
+		HTTPClientSession cs("localhost", svs.address().port());
+		HTTPRequest request("GET", "/file");
+		request.set("Range", "bytes=-500");
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_PARTIAL_CONTENT);
+		assert (response.get("Content-Range") == "bytes 19500-19999/20000");
+		assert (rbody == data.substr(19500));
+	}
+	{
+		HTTPClientSession cs("localhost", svs.address().port());
+		HTTPRequest request("GET", "/file");
+		request.set("Range", "bytes=30000-");
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_REQUESTED_RANGE_NOT_SATISFIABLE);
+		assert (response.get("Content-Range") == "bytes */20000");
+		assert (rbody.empty());
+	}
+	{
+		HTTPClientSession cs("localhost", svs.address().port());
+		HTTPRequest request("GET", "/file");
+		request.set("Range", "bytes=0-9,20-29");
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_OK);
+		assert (rbody == data);
+	}
+	{
+		HTTPClientSession cs("localhost", svs.address().port());
+		HTTPRequest request("GET", "/file");
+		request.set("Range", "bytes=0-9");
+		request.set("If-Range", "Thu, 01 Jan 1970 00:00:00 GMT");
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_OK);
+		assert (rbody == data);
+
+		HTTPClientSession cs2("localhost", svs.address().port());
+		request.set("If-Range", response.get("Last-Modified"));
+		cs2.sendRequest(request);
+		rbody.clear();
+		StreamCopier::copyToString(cs2.receiveResponse(response), rbody);
+		assert (response.getStatus() == HTTPResponse::HTTP_PARTIAL_CONTENT);
+		assert (rbody == data.substr(0, 10));
+	}
+}
+
+
 void HTTPServerTest::setUp()
 {
 }
@@ -541,11 +740,14 @@ CppUnit::Test* HTTPServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPServerTest, testClosedRequestKeepAlive);
 	CppUnit_addTest(pSuite, HTTPServerTest, testMaxKeepAlive);
 	CppUnit_addTest(pSuite, HTTPServerTest, testKeepAliveTimeout);
+	CppUnit_addTest(pSuite, HTTPServerTest, testParkIdleConnections);
 	CppUnit_addTest(pSuite, HTTPServerTest, test100Continue);
 	CppUnit_addTest(pSuite, HTTPServerTest, testRedirect);
 	CppUnit_addTest(pSuite, HTTPServerTest, testAuth);
 	CppUnit_addTest(pSuite, HTTPServerTest, testNotImpl);
 	CppUnit_addTest(pSuite, HTTPServerTest, testBuffer);
+	CppUnit_addTest(pSuite, HTTPServerTest, testFile);
+	CppUnit_addTest(pSuite, HTTPServerTest, testFileRange);
 
 	return pSuite;
 }
@@ -35,11 +35,14 @@ public:
 	void testClosedRequestKeepAlive();
 	void testMaxKeepAlive();
 	void testKeepAliveTimeout();
+	void testParkIdleConnections();
 	void test100Continue();
 	void testRedirect();
 	void testAuth();
 	void testNotImpl();
 	void testBuffer();
+	void testFile();
+	void testFileRange();
 
 	void setUp();
 	void tearDown();
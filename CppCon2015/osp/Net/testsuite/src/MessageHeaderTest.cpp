@@ -362,6 +362,65 @@ void MessageHeaderTest::testFieldLimit()
 }
 
 
+void MessageHeaderTest::testParse()
+{
+	std::string s("name1: value1\r\nname2: value21\r\n value22\r\ninvalid\r\nname3:value3  \n\r\nbody");
+	MessageHeader mh;
+	const char* end = mh.parse(s.data(), s.data() + s.size());
+	assert (end == s.data() + s.find("\r\nbody"));
+	assert (mh.size() == 3);
+	assert (mh["name1"] == "value1");
+	assert (mh["name2"] == "value21 value22");
+	assert (mh["name3"] == "value3");
+	
+	s = "name1: value1\r\nname2: value2";
+	mh.clear();
+	end = mh.parse(s.data(), s.data() + s.size());
+	assert (end == s.data() + s.size());
+	assert (mh.size() == 2);
+	assert (mh["name2"] == "value2");
+}
+
+
+void MessageHeaderTest::testParseInvalid()
+{
+	std::string s("name1: value1\r\nname2: value21\r\n value22\r\n value23\r\n");
+	s.append(300, 'x');
+	MessageHeader mh;
+	try
+	{
+		mh.parse(s.data(), s.data() + s.size());
+		fail("malformed message - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	s = "name1: value1\r\nname2: ";
+	s.append(9000, 'x');
+	try
+	{
+		mh.parse(s.data(), s.data() + s.size());
+		fail("malformed message - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	s = "name1: value1\r\nname2: value2\r\nname3: value3\r\n";
+	mh.clear();
+	mh.setFieldLimit(2);
+	try
+	{
+		mh.parse(s.data(), s.data() + s.size());
+		fail("Field limit exceeded - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+}
+
+
 void MessageHeaderTest::setUp()
 {
 }
@@ -392,6 +451,8 @@ CppUnit::Test* MessageHeaderTest::suite()
 	CppUnit_addTest(pSuite, MessageHeaderTest, testSplitElements);
 	CppUnit_addTest(pSuite, MessageHeaderTest, testSplitParameters);
 	CppUnit_addTest(pSuite, MessageHeaderTest, testFieldLimit);
+	CppUnit_addTest(pSuite, MessageHeaderTest, testParse);
+	CppUnit_addTest(pSuite, MessageHeaderTest, testParseInvalid);
 
 	return pSuite;
 }
@@ -42,6 +42,8 @@ public:
 	void testSplitElements();
 	void testSplitParameters();
 	void testFieldLimit();
+	void testParse();
+	void testParseInvalid();
 
 	void setUp();
 	void tearDown();
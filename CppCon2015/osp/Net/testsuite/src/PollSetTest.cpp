@@ -0,0 +1,213 @@
+//
+// PollSetTest.cpp
+//
+// $Id: //poco/1.6/Net/testsuite/src/PollSetTest.cpp#1 $
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "PollSetTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/PollSet.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Exception.h"
+#include "Poco/Stopwatch.h"
+#include "Poco/Thread.h"
+
+
+using Poco::Net::PollSet;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::Timespan;
+using Poco::Stopwatch;
+
+
+PollSetTest::PollSetTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+PollSetTest::~PollSetTest()
+{
+}
+
+
+void PollSetTest::testAddRemove()
+{
+	ServerSocket srv(SocketAddress("127.0.0.1", 0));
+	StreamSocket ss1(SocketAddress("127.0.0.1", srv.address().port()));
+	StreamSocket ss2(SocketAddress("127.0.0.1", srv.address().port()));
+
+	PollSet ps;
+	assert (ps.empty());
+	assert (ps.count() == 0);
+
+	ps.add(ss1, PollSet::POLL_READ);
+	ps.add(ss2, PollSet::POLL_READ);
+	assert (!ps.empty());
+	assert (ps.count() == 2);
+	assert (ps.has(ss1));
+	assert (ps.has(ss2));
+
+	ps.add(ss1, PollSet::POLL_READ | PollSet::POLL_WRITE);
+	assert (ps.count() == 2);
+
+	ps.remove(ss1);
+	assert (!ps.has(ss1));
+	assert (ps.count() == 1);
+
+	ps.remove(ss1);
+	assert (ps.count() == 1);
+
+	try
+	{
+		ps.update(ss1, PollSet::POLL_READ);
+		fail("socket not in set - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+
+	ps.clear();
+	assert (ps.empty());
+}
+
+
+void PollSetTest::testPollRead()
+{
+	ServerSocket srv(SocketAddress("127.0.0.1", 0));
+	StreamSocket ss1(SocketAddress("127.0.0.1", srv.address().port()));
+	StreamSocket ss2(SocketAddress("127.0.0.1", srv.address().port()));
+	StreamSocket peer1 = srv.acceptConnection();
+	StreamSocket peer2 = srv.acceptConnection();
+
+	PollSet ps;
+	ps.add(ss1, PollSet::POLL_READ);
+	ps.add(ss2, PollSet::POLL_READ);
+
+	PollSet::SocketModeMap sm = ps.poll(Timespan(100000));
+	assert (sm.empty());
+
+	peer2.sendBytes("hello", 5);
+	sm = ps.poll(Timespan(2, 0));
+	assert (sm.size() == 1);
+	assert (sm.begin()->first == ss2);
+	assert (sm.begin()->second & PollSet::POLL_READ);
+
+	// level-triggered: socket stays ready until data has been read
+	sm = ps.poll(Timespan(2, 0));
+	assert (sm.size() == 1);
+
+	char buffer[16];
+	int n = ss2.receiveBytes(buffer, sizeof(buffer));
+	assert (n == 5);
+	sm = ps.poll(Timespan(100000));
+	assert (sm.empty());
+
+	peer1.sendBytes("hello", 5);
+	peer2.sendBytes("hello", 5);
+	sm = ps.poll(Timespan(2, 0));
+	if (sm.size() < 2)
+	{
+		Poco::Thread::sleep(100);
+		sm = ps.poll(Timespan(2, 0));
+	}
+	assert (sm.size() == 2);
+	assert (sm.find(ss1) != sm.end());
+	assert (sm.find(ss2) != sm.end());
+
+	ps.remove(ss1);
+	sm = ps.poll(Timespan(2, 0));
+	assert (sm.size() == 1);
+	assert (sm.begin()->first == ss2);
+}
+
+
+void PollSetTest::testPollWrite()
+{
+	ServerSocket srv(SocketAddress("127.0.0.1", 0));
+	StreamSocket ss(SocketAddress("127.0.0.1", srv.address().port()));
+	StreamSocket peer = srv.acceptConnection();
+
+	PollSet ps;
+	ps.add(ss, PollSet::POLL_READ);
+	PollSet::SocketModeMap sm = ps.poll(Timespan(100000));
+	assert (sm.empty());
+
+	ps.update(ss, PollSet::POLL_READ | PollSet::POLL_WRITE);
+	sm = ps.poll(Timespan(2, 0));
+	assert (sm.size() == 1);
+	assert (sm.begin()->second & PollSet::POLL_WRITE);
+	assert (!(sm.begin()->second & PollSet::POLL_READ));
+}
+
+
+void PollSetTest::testPollClosed()
+{
+	ServerSocket srv(SocketAddress("127.0.0.1", 0));
+	StreamSocket ss(SocketAddress("127.0.0.1", srv.address().port()));
+	StreamSocket peer = srv.acceptConnection();
+
+	PollSet ps;
+	ps.add(ss, PollSet::POLL_READ | PollSet::POLL_ERROR);
+	peer.close();
+
+	PollSet::SocketModeMap sm = ps.poll(Timespan(2, 0));
+	assert (sm.size() == 1);
+	assert (sm.begin()->second & PollSet::POLL_READ);
+
+	char buffer[16];
+	int n = ss.receiveBytes(buffer, sizeof(buffer));
+	assert (n == 0);
+}
+
+
+void PollSetTest::testPollTimeout()
+{
+	PollSet ps;
+	Stopwatch sw;
+	sw.start();
+	PollSet::SocketModeMap sm = ps.poll(Timespan(100000));
+	assert (sm.empty());
+
+	ServerSocket srv(SocketAddress("127.0.0.1", 0));
+	StreamSocket ss(SocketAddress("127.0.0.1", srv.address().port()));
+	ps.add(ss, PollSet::POLL_READ);
+	sw.restart();
+	sm = ps.poll(Timespan(200000));
+	sw.stop();
+	assert (sm.empty());
+	assert (sw.elapsed() >= 150000);
+}
+
+
+void PollSetTest::setUp()
+{
+}
+
+
+void PollSetTest::tearDown()
+{
+}
+
+
+CppUnit::Test* PollSetTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("PollSetTest");
+
+	CppUnit_addTest(pSuite, PollSetTest, testAddRemove);
+	CppUnit_addTest(pSuite, PollSetTest, testPollRead);
+	CppUnit_addTest(pSuite, PollSetTest, testPollWrite);
+	CppUnit_addTest(pSuite, PollSetTest, testPollClosed);
+	CppUnit_addTest(pSuite, PollSetTest, testPollTimeout);
+
+	return pSuite;
+}
@@ -0,0 +1,44 @@
+//
+// PollSetTest.h
+//
+// $Id: //poco/1.6/Net/testsuite/src/PollSetTest.h#1 $
+//
+// Definition of the PollSetTest class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef PollSetTest_INCLUDED
+#define PollSetTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class PollSetTest: public CppUnit::TestCase
+{
+public:
+	PollSetTest(const std::string& name);
+	~PollSetTest();
+
+	void testAddRemove();
+	void testPollRead();
+	void testPollWrite();
+	void testPollClosed();
+	void testPollTimeout();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // PollSetTest_INCLUDED
@@ -14,6 +14,8 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/Net/WebSocket.h"
+#include "Poco/Net/WebSocketImpl.h"
+#include "Poco/Net/PerMessageDeflate.h"
 #include "Poco/Net/SocketStream.h"
 #include "Poco/Net/HTTPClientSession.h"
 #include "Poco/Net/HTTPServer.h"
@@ -34,7 +36,9 @@ using Poco::Net::HTTPServerRequest;
 using Poco::Net::HTTPServerResponse;
 using Poco::Net::SocketStream;
 using Poco::Net::WebSocket;
+using Poco::Net::WebSocketImpl;
 using Poco::Net::WebSocketException;
+using Poco::Net::PerMessageDeflate;
 
 
 namespace
@@ -42,7 +46,9 @@ namespace
 	class WebSocketRequestHandler: public Poco::Net::HTTPRequestHandler
 	{
 	public:
-		WebSocketRequestHandler(std::size_t bufSize = 1024): _bufSize(bufSize)
+		WebSocketRequestHandler(std::size_t bufSize = 1024, bool deflate = false): 
+			_bufSize(bufSize),
+			_deflate(deflate)
 		{
 		}
 
@@ -50,7 +56,7 @@ namespace
 		{
 			try
 			{
-				WebSocket ws(request, response);
+				WebSocket ws = _deflate ? WebSocket(request, response, PerMessageDeflate::Params()) : WebSocket(request, response);
 				std::auto_ptr<char> pBuffer(new char[_bufSize]);
 				int flags;
 				int n;
@@ -81,6 +87,7 @@ namespace
 
 	private:
 		std::size_t _bufSize;
+		bool _deflate;
 	};
 	
 	class WebSocketRequestHandlerFactory: public Poco::Net::HTTPRequestHandlerFactory
@@ -92,7 +99,7 @@ namespace
 
 		Poco::Net::HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
 		{
-			return new WebSocketRequestHandler(_bufSize);
+			return new WebSocketRequestHandler(_bufSize, request.getURI() == "/deflate");
 		}
 
 	private:
@@ -210,6 +217,266 @@ void WebSocketTest::testWebSocketLarge()
 }
 
 
+void WebSocketTest::testWebSocketBuffer()
+{
+	const int maxSize = 70000;
+
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new WebSocketRequestHandlerFactory(maxSize), ss, new Poco::Net::HTTPServerParams);
+	server.start();
+	
+	Poco::Thread::sleep(200);
+	
+	HTTPClientSession cs("localhost", ss.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/ws");
+	HTTPResponse response;
+	WebSocket ws(cs, request, response);
+
+	// sizes chosen to exercise all frame header sizes
+	// and all masking code paths
+	const int sizes[] = {1, 3, 17, 125, 126, 1000, 65535, 65536, maxSize};
+	Poco::Buffer<char> buffer(0);
+	for (std::size_t i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++)
+	{
+		std::string payload;
+		for (int k = 0; k < sizes[i]; k++) payload += static_cast<char>('a' + k % 26);
+		ws.sendFrame(payload.data(), static_cast<int>(payload.size()), WebSocket::FRAME_BINARY);
+		
+		buffer.resize(0);
+		int flags;
+		int n = ws.receiveFrame(buffer, maxSize, flags);
+		assert (n == payload.size());
+		assert (buffer.size() == payload.size());
+		assert (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+		assert (flags == WebSocket::FRAME_BINARY);
+	}
+
+	std::string payload("appended");
+	ws.sendFrame(payload.data(), static_cast<int>(payload.size()));
+	int flags;
+	int n = ws.receiveFrame(buffer, maxSize, flags);
+	assert (n == payload.size());
+	assert (buffer.size() == maxSize + payload.size());
+	assert (payload.compare(0, payload.size(), buffer.begin() + maxSize, n) == 0);
+
+	ws.shutdown();
+	buffer.resize(0);
+	n = ws.receiveFrame(buffer, maxSize, flags);
+	assert (n == 2);
+	assert ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE);
+
+	HTTPClientSession cs2("localhost", ss.address().port());
+	WebSocket ws2(cs2, request, response);
+	buffer.resize(0);
+	ws2.sendFrame(payload.data(), static_cast<int>(payload.size()));
+	try
+	{
+		ws2.receiveFrame(buffer, static_cast<int>(payload.size()) - 1, flags);
+		fail("payload too big - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		assert (buffer.size() == 0);
+	}
+}
+
+
+void WebSocketTest::testWebSocketDeflate()
+{
+	const int maxSize = 70000;
+
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new WebSocketRequestHandlerFactory(maxSize), ss, new Poco::Net::HTTPServerParams);
+	server.start();
+	
+	Poco::Thread::sleep(200);
+	
+	HTTPClientSession cs("localhost", ss.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/deflate");
+	HTTPResponse response;
+	PerMessageDeflate::Params params;
+	params.clientMaxWindowBits = 10;
+	WebSocket ws(cs, request, response, params);
+	assert (response.get("Sec-WebSocket-Extensions") == "permessage-deflate; client_max_window_bits=10");
+	assert (static_cast<WebSocketImpl*>(ws.impl())->compressed());
+
+	std::string event("{\"subject\":\"io.macchina.sensor\",\"data\":{\"value\":");
+	Poco::Buffer<char> buffer(maxSize);
+	int flags;
+	for (int i = 0; i < 10; i++)
+	{
+		std::string payload(event);
+		payload += static_cast<char>('0' + i);
+		payload += "}}";
+		for (int k = 0; k < i*i*100; k++) payload += static_cast<char>('a' + k % 26);
+		ws.sendFrame(payload.data(), static_cast<int>(payload.size()));
+		int n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+		assert (n == payload.size());
+		assert (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+		assert (flags == WebSocket::FRAME_TEXT);
+	}
+
+	std::string payload(maxSize, 'x');
+	ws.sendFrame(payload.data(), static_cast<int>(payload.size()), WebSocket::FRAME_BINARY);
+	buffer.resize(0);
+	int n = ws.receiveFrame(buffer, maxSize, flags);
+	assert (n == payload.size());
+	assert (buffer.size() == payload.size());
+	assert (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+	assert (flags == WebSocket::FRAME_BINARY);
+
+	ws.shutdown();
+	buffer.resize(0);
+	n = ws.receiveFrame(buffer, maxSize, flags);
+	assert (n == 2);
+	assert ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE);
+}
+
+
+void WebSocketTest::testPerMessageDeflate()
+{
+	PerMessageDeflate::Params params;
+	PerMessageDeflate server(params, true);
+	PerMessageDeflate client(params, false);
+	
+	std::string message;
+	for (int i = 0; i < 20; i++) message += "{\"subject\":\"io.macchina.sensor\",\"value\":42}";
+	Poco::Buffer<char> compressed(0);
+	Poco::Buffer<char> payload(0);
+	std::size_t firstSize = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		server.deflate(message.data(), static_cast<int>(message.size()), compressed);
+		assert (compressed.size() < message.size()/5);
+		if (i == 0) 
+			firstSize = compressed.size();
+		else 
+			assert (compressed.size() < firstSize); // context takeover
+
+		payload.resize(0);
+		client.inflate(compressed.begin(), static_cast<int>(compressed.size()), true, payload, static_cast<int>(message.size()));
+		assert (payload.size() == message.size());
+		assert (message.compare(0, message.size(), payload.begin(), payload.size()) == 0);
+	}
+
+	server.deflate(message.data(), static_cast<int>(message.size()), compressed);
+	char small[16];
+	try
+	{
+		client.inflate(compressed.begin(), static_cast<int>(compressed.size()), true, small, sizeof(small));
+		fail("insufficient buffer - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	}
+
+	// A small compressed message must not make the payload 
+	// buffer grow beyond the given maximum.
+	PerMessageDeflate bombServer(params, true);
+	PerMessageDeflate bombClient(params, false);
+	std::string zeros(1024*1024, '\0');
+	bombServer.deflate(zeros.data(), static_cast<int>(zeros.size()), compressed);
+	assert (compressed.size() < 2048);
+	payload.resize(0);
+	try
+	{
+		bombClient.inflate(compressed.begin(), static_cast<int>(compressed.size()), true, payload, 65536);
+		fail("payload too big - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		assert (payload.capacity() <= 65536 + 1);
+	}
+
+	const char garbage[] = {'\xff', '\xff', '\xff', '\xff'};
+	PerMessageDeflate other(params, false);
+	try
+	{
+		other.inflate(garbage, sizeof(garbage), true, payload, 65536);
+		fail("invalid data - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_COMPRESSION);
+	}
+}
+
+
+void WebSocketTest::testPerMessageDeflateNegotiation()
+{
+	PerMessageDeflate::Params params;
+	assert (PerMessageDeflate::offer(params) == "permessage-deflate; client_max_window_bits");
+	params.serverNoContextTakeover = true;
+	params.serverMaxWindowBits = 12;
+	params.clientMaxWindowBits = 8;
+	assert (PerMessageDeflate::offer(params) == "permessage-deflate; server_no_context_takeover; server_max_window_bits=12; client_max_window_bits=9");
+
+	PerMessageDeflate::Params serverParams;
+	PerMessageDeflate::Params negotiated;
+	std::string response;
+	assert (PerMessageDeflate::accept(PerMessageDeflate::offer(params), serverParams, negotiated, response));
+	assert (response == "permessage-deflate; server_no_context_takeover; server_max_window_bits=12; client_max_window_bits=9");
+	assert (negotiated.serverNoContextTakeover);
+	assert (!negotiated.clientNoContextTakeover);
+	assert (negotiated.serverMaxWindowBits == 12);
+	assert (negotiated.clientMaxWindowBits == 9);
+
+	PerMessageDeflate::Params confirmed;
+	assert (PerMessageDeflate::confirm(response, params, confirmed));
+	assert (confirmed.serverNoContextTakeover);
+	assert (!confirmed.clientNoContextTakeover);
+	assert (confirmed.serverMaxWindowBits == 12);
+	assert (confirmed.clientMaxWindowBits == 9);
+
+	// the first acceptable offer wins
+	serverParams.clientNoContextTakeover = true;
+	assert (PerMessageDeflate::accept("x-webkit-deflate-frame, permessage-deflate; server_max_window_bits=8, permessage-deflate; foo, permessage-deflate; client_max_window_bits", serverParams, negotiated, response));
+	assert (response == "permessage-deflate; client_no_context_takeover");
+	assert (!negotiated.serverNoContextTakeover);
+	assert (negotiated.clientNoContextTakeover);
+	assert (negotiated.serverMaxWindowBits == 15);
+	assert (negotiated.clientMaxWindowBits == 15);
+
+	assert (!PerMessageDeflate::accept("", serverParams, negotiated, response));
+	assert (!PerMessageDeflate::accept("permessage-deflate; server_max_window_bits", serverParams, negotiated, response));
+	assert (!PerMessageDeflate::accept("permessage-deflate; server_max_window_bits=016", serverParams, negotiated, response));
+	assert (!PerMessageDeflate::accept("permessage-deflate; client_no_context_takeover; client_no_context_takeover", serverParams, negotiated, response));
+	assert (!PerMessageDeflate::accept("permessage-deflate; server_no_context_takeover=1", serverParams, negotiated, response));
+
+	assert (!PerMessageDeflate::confirm("", params, confirmed));
+	try
+	{
+		PerMessageDeflate::confirm("permessage-deflate; server_no_context_takeover; server_max_window_bits=12; client_max_window_bits=8", params, confirmed);
+		fail("unsupported window size - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_NO_HANDSHAKE);
+	}
+	try
+	{
+		PerMessageDeflate::confirm("permessage-deflate; server_max_window_bits=12", params, confirmed);
+		fail("server_no_context_takeover missing - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_NO_HANDSHAKE);
+	}
+	try
+	{
+		PerMessageDeflate::confirm("permessage-deflate, x-foo", params, confirmed);
+		fail("unknown extension - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assert (exc.code() == WebSocket::WS_ERR_NO_HANDSHAKE);
+	}
+}
+
+
 void WebSocketTest::setUp()
 {
 }
@@ -226,6 +493,10 @@ CppUnit::Test* WebSocketTest::suite()
 
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocket);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLarge);
+	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketBuffer);
+	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketDeflate);
+	CppUnit_addTest(pSuite, WebSocketTest, testPerMessageDeflate);
+	CppUnit_addTest(pSuite, WebSocketTest, testPerMessageDeflateNegotiation);
 
 	return pSuite;
 }
@@ -28,6 +28,10 @@ public:
 
 	void testWebSocket();
 	void testWebSocketLarge();
+	void testWebSocketBuffer();
+	void testWebSocketDeflate();
+	void testPerMessageDeflate();
+	void testPerMessageDeflateNegotiation();
 
 	void setUp();
 	void tearDown();
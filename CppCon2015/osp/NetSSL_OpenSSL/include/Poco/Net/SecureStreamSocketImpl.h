@@ -82,6 +82,16 @@ public:
 		///
 		/// Returns the number of bytes sent, which may be
 		/// less than the number of bytes specified.
+
+	int sendBytes(const SocketBufVec& buffers, int flags = 0);
+		/// Sends the contents of the given buffers through
+		/// the socket. If there is more than one buffer, the 
+		/// buffers are copied into a single buffer first, so
+		/// that the data is sent with a single SSL_write().
+		/// Any specified flags are ignored.
+		///
+		/// Returns the number of bytes sent, which may be
+		/// less than the number of bytes specified.
 	
 	int receiveBytes(void* buffer, int length, int flags = 0);
 		/// Receives data from the socket and stores it
@@ -123,6 +123,16 @@ int SecureStreamSocketImpl::sendBytes(const void* buffer, int length, int flags)
 }
 
 
+int SecureStreamSocketImpl::sendBytes(const SocketBufVec& buffers, int flags)
+{
+	// Each SSL_write() produces at least one TLS record, so the buffers
+	// are combined and sent with a single write.
+	Poco::Buffer<char> buffer(0);
+	gatherBuffers(buffers, buffer);
+	return sendBytes(buffer.begin(), static_cast<int>(buffer.size()), flags);
+}
+
+
 int SecureStreamSocketImpl::receiveBytes(void* buffer, int length, int flags)
 {
 	return _impl.receiveBytes(buffer, length, flags);
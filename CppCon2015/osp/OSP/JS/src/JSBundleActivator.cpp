@@ -19,11 +19,30 @@
 #include "Poco/RemotingNG/RemoteObject.h"
 #include "Poco/JS/Bridge/Listener.h"
 #include "Poco/JS/Bridge/BridgeWrapper.h"
+#include "Poco/JS/Core/ScriptCache.h"
+#include "Poco/JS/Core/IsolatePool.h"
+#include "Poco/JS/Core/JSExecutor.h"
+#include "Poco/JS/Core/SystemWrapper.h"
+#include "Poco/JS/Core/LoggerWrapper.h"
+#include "Poco/JS/Core/ApplicationWrapper.h"
+#include "Poco/JS/Core/ConfigurationWrapper.h"
+#include "Poco/JS/Core/URIWrapper.h"
+#include "Poco/JS/Core/DateTimeWrapper.h"
+#include "Poco/JS/Core/LocalDateTimeWrapper.h"
+#include "Poco/JS/Core/TimerWrapper.h"
+#include "Poco/JS/Net/HTTPRequestWrapper.h"
+#include "Poco/JS/Net/HTTPResponseWrapper.h"
+#include "Poco/JS/Net/HTMLFormWrapper.h"
+#include "Poco/JS/Data/SessionWrapper.h"
+#include "Poco/JS/Data/RecordSetWrapper.h"
+#include "Poco/Util/Application.h"
+#include "Poco/Path.h"
 #include "Poco/Delegate.h"
 #include "Poco/ClassLibrary.h"
 #include "JSExtensionPoint.h"
 #include "JSServletFilter.h"
 #include "JSServerPageFilter.h"
+#include "ServiceRefWrapper.h"
 
 
 namespace Poco {
@@ -73,6 +92,9 @@ public:
 		pContext->registry().serviceUnregistered += Poco::delegate(this, &JSBundleActivator::handleServiceUnregistered);
 		
 		Poco::JS::Bridge::BridgeWrapper::registerTransportFactory();
+		
+		setupScriptCache();
+		setupIsolatePool();
 	}
 		
 	void stop(BundleContext::Ptr pContext)
@@ -89,9 +111,70 @@ public:
 		pContext->registry().serviceRegistered   -= Poco::delegate(this, &JSBundleActivator::handleServiceRegistered);
 		pContext->registry().serviceUnregistered -= Poco::delegate(this, &JSBundleActivator::handleServiceUnregistered);
 
+		Poco::JS::Core::ScriptCache::instance().setPersistencyDirectory("");
+		Poco::JS::Core::IsolatePool::setDefaultPool(0);
+
 		_pContext = 0;
 	}
 
+	void setupScriptCache()
+	{
+		// Compiled script data is persisted in a directory next to the
+		// bundle code cache, unless disabled by setting osp.js.codeCache
+		// to an empty string.
+		Poco::Util::AbstractConfiguration& config = Poco::Util::Application::instance().config();
+		Poco::Path defaultPath(config.getString("osp.codeCache", config.expand("${application.dir}codeCache")));
+		defaultPath.makeDirectory();
+		defaultPath.popDirectory();
+		defaultPath.pushDirectory("jsCodeCache");
+		std::string scriptCachePath = config.getString("osp.js.codeCache", defaultPath.toString());
+		try
+		{
+			Poco::JS::Core::ScriptCache::instance().setPersistencyDirectory(scriptCachePath);
+		}
+		catch (Poco::Exception& exc)
+		{
+			_pContext->logger().warning("Cannot set up JavaScript code cache directory: " + exc.displayText());
+		}
+	}
+
+	void setupIsolatePool()
+	{
+		// Pre-warmed isolates are used by all executors with the default
+		// memory limit. Setting osp.js.isolatePool.size to 0 disables pooling.
+		Poco::Util::AbstractConfiguration& config = Poco::Util::Application::instance().config();
+		int size = config.getInt("osp.js.isolatePool.size", 4);
+		int peakSize = config.getInt("osp.js.isolatePool.peakSize", 32);
+		if (size <= 0) return;
+		if (peakSize < size) peakSize = size;
+
+		Poco::JS::Core::IsolatePool::Ptr pPool = new Poco::JS::Core::IsolatePool(Poco::JS::Core::JSExecutor::DEFAULT_MEMORY_LIMIT, size, peakSize);
+		pPool->registerWrapper(new Poco::JS::Core::SystemWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::LoggerWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::ApplicationWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::ConfigurationWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::URIWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::DateTimeWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::LocalDateTimeWrapper);
+		pPool->registerWrapper(new Poco::JS::Core::TimerWrapper);
+		pPool->registerWrapper(new Poco::JS::Net::HTTPRequestWrapper);
+		pPool->registerWrapper(new Poco::JS::Net::HTTPResponseWrapper);
+		pPool->registerWrapper(new Poco::JS::Net::HTMLFormWrapper);
+		pPool->registerWrapper(new Poco::JS::Data::SessionWrapper);
+		pPool->registerWrapper(new Poco::JS::Data::RecordSetWrapper);
+		pPool->registerWrapper(new Poco::JS::Bridge::BridgeWrapper);
+		pPool->registerWrapper(new ServiceRefWrapper);
+		try
+		{
+			pPool->prestart(size);
+			Poco::JS::Core::IsolatePool::setDefaultPool(pPool);
+		}
+		catch (Poco::Exception& exc)
+		{
+			_pContext->logger().warning("Cannot create JavaScript isolate pool: " + exc.displayText());
+		}
+	}
+
 	void handleServiceRegistered(const void* sender, ServiceEvent& event)
 	{
 		_pContext->logger().information("Service registered: " + event.service()->name());
@@ -160,6 +160,7 @@ public:
 			bool defaultKeepAlive     = pContext->thisBundle()->properties().getBool("keepAlive", true);
 			int defaultKeepAliveTime  = pContext->thisBundle()->properties().getInt("keepAliveTime", 10);
 			int defaultMaxKeepAlive   = pContext->thisBundle()->properties().getInt("maxKeepAlive", 10);
+			bool defaultParkIdle      = pContext->thisBundle()->properties().getBool("parkIdleConnections", true);
 			
 			// get parameters from global configuration file
 			std::string host  = pPrefs->configuration()->getString("osp.web.server.secureHost", defaultHost);
@@ -169,6 +170,7 @@ public:
 			bool keepAlive    = pPrefs->configuration()->getBool("osp.web.server.keepAlive", defaultKeepAlive);
 			int keepAliveTime = pPrefs->configuration()->getInt("osp.web.server.keepAliveTime", defaultKeepAliveTime);
 			int maxKeepAlive  = pPrefs->configuration()->getInt("osp.web.server.maxKeepAlive", defaultMaxKeepAlive);
+			bool parkIdle     = pPrefs->configuration()->getBool("osp.web.server.parkIdleConnections", defaultParkIdle);
 			
 			if (port != 0)
 			{
@@ -180,6 +182,7 @@ public:
 				pParams->setKeepAlive(keepAlive);
 				pParams->setKeepAliveTimeout(Poco::Timespan(keepAliveTime, 0));
 				pParams->setMaxKeepAliveRequests(maxKeepAlive);
+				pParams->setParkIdleConnections(parkIdle);
 				pParams->setMaxQueued(maxQueued);
 				pParams->setMaxThreads(maxThreads);
 				
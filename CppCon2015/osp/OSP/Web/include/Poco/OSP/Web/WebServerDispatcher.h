@@ -34,7 +34,10 @@
 #include "Poco/RegularExpression.h"
 #include "Poco/Logger.h"
 #include "Poco/SharedPtr.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/RefCountedObject.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/Timestamp.h"
 #include "Poco/Mutex.h"
 #include <vector>
 #include <map>
@@ -142,6 +145,17 @@ public:
 	typedef Poco::SharedPtr<WebFilter> WebFilterPtr;
 	typedef Poco::SharedPtr<WebFilterFactory> WebFilterFactoryPtr;
 
+	struct CachedResource
+		/// A resource held in the resource cache.
+	{
+		std::string data;     /// resource content
+		std::string etag;     /// strong entity tag for content
+		std::string gzipData; /// gzip-compressed content (empty if content is not compressed)
+		std::string gzipETag; /// strong entity tag for gzip-compressed content
+	};
+	
+	typedef Poco::SharedPtr<CachedResource> CachedResourcePtr;
+
 	WebServerDispatcher(BundleContext::Ptr pContext, MediaTypeMapper::Ptr pMediaTypeMapper, const std::string& authServiceName, bool compressResponses, const std::set<std::string>& compressedMediaTypes, bool cacheResources = false);
 		/// Creates the WebServerDispatcher.
 
@@ -198,22 +212,58 @@ protected:
 		/// Creates normalized path for internal storage.
 		/// The normalized path always starts and ends with a slash.
 		
-	const VirtualPath& mapPath(const std::string& path, const std::string& method) const;
-		/// Maps a URI to a VirtualPath.
+	class RouteTable;
+	typedef Poco::AutoPtr<RouteTable> RouteTablePtr;
+	
+	RouteTablePtr routeTable() const;
+		/// Returns the current snapshot of the routing table.
+		///
+		/// The routing table is an immutable copy of the path mappings,
+		/// organized as a trie for fast lookup. It is rebuilt and replaced
+		/// whenever a path mapping is added or removed. Request handling 
+		/// only holds a lock for obtaining the snapshot pointer.
+
+	void updateRouteTable();
+		/// Rebuilds the routing table from the path mapping table.
+		/// Must be called with _mutex locked.
+
+	static const VirtualPath& mapPath(const RouteTable& routeTable, const std::string& path, const std::string& method);
+		/// Maps a URI to a VirtualPath, using the given routing table.
+		/// The returned reference is valid as long as the routing table exists.
 		///
 		/// Throws a NotFoundException if no suitable mapping can be found.
 
 	void sendResource(Poco::Net::HTTPServerRequest& request, const std::string& path, const std::string& vpath, const std::string& resPath, const std::string& resBase, const std::string& index, Bundle::ConstPtr pBundle, bool canCache);
 		/// Sends a bundle resource as response.
+		///
+		/// Cached resources are sent directly from memory, using the 
+		/// precompressed variant if the client accepts gzip content encoding,
+		/// and with an ETag header. A request with a matching If-None-Match
+		/// header gets a 304 Not Modified response.
 		
-	std::istream* findResource(Bundle::ConstPtr pBundle, const std::string& base, const std::string& res, const std::string& index, std::string& mediaType, std::string& resolvedPath, bool canCache) const;
+	void sendCachedResource(Poco::Net::HTTPServerRequest& request, const CachedResource& resource, const Poco::Timestamp& lastModified);
+		/// Sends the body of a cached resource as response to a GET or HEAD request.
+
+	std::istream* findResource(Bundle::ConstPtr pBundle, const std::string& base, const std::string& res, const std::string& index, std::string& mediaType, std::string& resolvedPath, bool canCache, CachedResourcePtr& pCachedResource) const;
 		/// Returns a resource stream for the given path, or a null pointer
-		/// if no matching resource exists.
+		/// if no matching resource exists. If the resource comes from the
+		/// resource cache, pCachedResource is set to the cache entry.
 
-	std::istream* getCachedResource(Bundle::ConstPtr pBundle, const std::string& path, bool canCache) const;
+	std::istream* getCachedResource(Bundle::ConstPtr pBundle, const std::string& path, const std::string& mediaType, bool canCache, CachedResourcePtr& pCachedResource) const;
 		/// Returns a resource stream for the given path, or a null pointer
 		/// if no matching resource exists. If caching is enabled both globally
-		/// and for the specific resource, attempts to cache the resource.
+		/// and for the specific resource, attempts to cache the resource
+		/// and sets pCachedResource to the cache entry.
+
+	CachedResourcePtr createCachedResource(std::istream& istr, const std::string& mediaType) const;
+		/// Creates a resource cache entry from the given stream.
+		/// Computes the ETag and, if responses with the given mediaType
+		/// are compressed, the gzip-compressed variant.
+
+	static bool matchETag(const std::string& ifNoneMatch, const std::string& etag);
+		/// Returns true iff the given If-None-Match header value
+		/// matches the given entity tag, using the weak comparison
+		/// function (RFC 7232, 2.3.2).
 
 	static bool cleanPath(std::string& path);
 		/// Removes unnecessary characters (such as trailing dots)
@@ -278,12 +328,14 @@ private:
 		WebFilter::Args args;
 	};
 	typedef std::map<std::string, WebFilterFactoryInfo> FilterFactoryMap;
-	typedef std::map<std::string, std::string> ResourceCache;
+	typedef std::map<std::string, CachedResourcePtr> ResourceCache;
 	
 	BundleContext::Ptr _pContext;
 	MediaTypeMapper::Ptr _pMediaTypeMapper;
 	PathMap _pathMap;
 	PatternVec _patternVec;
+	RouteTablePtr _pRouteTable;
+	mutable Poco::FastMutex _routeTableMutex;
 	std::string _authServiceName;
 	bool _compressResponses;
 	std::set<std::string> _compressedMediaTypes;
@@ -299,6 +351,64 @@ private:
 };
 
 
+class OSPWeb_API WebServerDispatcher::RouteTable: public Poco::RefCountedObject
+	/// An immutable snapshot of the path mapping table, used for
+	/// mapping request paths to VirtualPath objects.
+	///
+	/// Virtual paths are stored in a trie with one node per path
+	/// segment, so a lookup takes time proportional to the length
+	/// of the request path. Patterns are stored in a character trie, 
+	/// keyed by the literal prefix of the regular expression, 
+	/// so that only patterns that can possibly match a path must be tried.
+{
+public:
+	RouteTable(const PathMap& pathMap, const PatternVec& patternVec);
+		/// Creates the RouteTable from copies of the given path mappings.
+
+	~RouteTable();
+		/// Destroys the RouteTable.
+	
+	const VirtualPath* find(const std::string& path, const std::string& method) const;
+		/// Returns the VirtualPath the given path maps to, or null
+		/// if no mapping exists. Patterns take precedence over paths.
+	
+	static std::string literalPrefix(const std::string& pattern);
+		/// Returns the literal prefix that all strings matched by the 
+		/// given (anchored) pattern must start with.
+
+protected:
+	struct PathNode
+	{
+		PathNode(): pVirtualPath(0)
+		{
+		}
+		
+		std::map<std::string, std::size_t> children;
+		const VirtualPath* pVirtualPath;
+	};
+	
+	struct PatternNode
+	{
+		std::map<char, std::size_t> children;
+		std::vector<std::size_t> patterns;
+	};
+
+	std::size_t pathChild(std::size_t node, const std::string& segment);
+	std::size_t patternChild(std::size_t node, char c);
+	const VirtualPath* findPattern(const std::string& path, const std::string& method) const;
+	const VirtualPath* findPath(const std::string& path) const;
+
+private:
+	RouteTable(const RouteTable&);
+	RouteTable& operator = (const RouteTable&);
+
+	PathMap _pathMap;
+	PatternVec _patternVec;
+	std::vector<PathNode> _pathNodes;
+	std::vector<PatternNode> _patternNodes;
+};
+
+
 //
 // inlines
 //
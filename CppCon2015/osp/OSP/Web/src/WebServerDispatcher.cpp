@@ -39,8 +39,15 @@
 #include "Poco/DeflatingStream.h"
 #include "Poco/MemoryStream.h"
 #include "Poco/Message.h"
+#include "Poco/SHA1Engine.h"
+#include "Poco/DigestStream.h"
+#include "Poco/StringTokenizer.h"
 #include <memory>
+#include <sstream>
 #include <limits>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
 
 
 using Poco::OSP::Auth::AuthService;
@@ -66,6 +73,7 @@ const std::string WebServerDispatcher::SERVICE_NAME("osp.web.dispatcher");
 WebServerDispatcher::WebServerDispatcher(BundleContext::Ptr pContext, MediaTypeMapper::Ptr pMediaTypeMapper, const std::string& authServiceName, bool compressResponses, const std::set<std::string>& compressedMediaTypes, bool cacheResources):
 	_pContext(pContext),
 	_pMediaTypeMapper(pMediaTypeMapper),
+	_pRouteTable(new RouteTable(_pathMap, _patternVec)),
 	_authServiceName(authServiceName),
 	_compressResponses(compressResponses),
 	_compressedMediaTypes(compressedMediaTypes),
@@ -110,6 +118,7 @@ void WebServerDispatcher::addVirtualPath(const VirtualPath& virtualPath)
 	if (virtualPath.pPattern)
 	{
 		_patternVec.push_back(virtualPath);
+		updateRouteTable();
 
 		std::string msg("Pattern '");
 		msg += virtualPath.path;
@@ -166,6 +175,7 @@ void WebServerDispatcher::addVirtualPath(const VirtualPath& virtualPath)
 			}
 			++it;
 		}
+		updateRouteTable();
 	
 		std::string msg("Virtual path '");
 		msg += vPath.path;
@@ -205,6 +215,7 @@ void WebServerDispatcher::removeVirtualPath(const std::string& virtualPath)
 			}
 		}
 	}
+	updateRouteTable();
 	std::string msg("Virtual path '");
 	msg += vPath;
 	msg += "' unmapped.";
@@ -270,12 +281,11 @@ void WebServerDispatcher::handleRequest(Poco::Net::HTTPServerRequest& request, P
 		std::string path(uri.getPath());
 		if (cleanPath(path))
 		{
-			Poco::ScopedLockWithUnlock<Poco::FastMutex> lock(_mutex);
-			const VirtualPath& vPath = mapPath(path, request.getMethod());
+			RouteTablePtr pRouteTable = routeTable();
+			const VirtualPath& vPath = mapPath(*pRouteTable, path, request.getMethod());
 			if (vPath.security.secure && !secure)
 			{
 				std::string vpath(vPath.path);
-				lock.unlock();
 				sendResponse(request, HTTPResponse::HTTP_FORBIDDEN, formatMessage("secure", vpath));
 			}
 			else if (authorize(request, vPath, username))
@@ -285,7 +295,6 @@ void WebServerDispatcher::handleRequest(Poco::Net::HTTPServerRequest& request, P
 					if (vPath.methods.empty() || vPath.methods.count(request.getMethod()) == 1)
 					{
 						RequestHandlerFactoryPtr pFactory(vPath.pFactory);
-						lock.unlock();
 						std::auto_ptr<HTTPRequestHandler> pHandler(pFactory->createRequestHandler(request));
 						try
 						{
@@ -315,13 +324,11 @@ void WebServerDispatcher::handleRequest(Poco::Net::HTTPServerRequest& request, P
 						if (index.empty()) index = "index.html";
 						Bundle::ConstPtr pBundle(vPath.pOwnerBundle);
 						bool canCache = vPath.cache;
-						lock.unlock();
 						sendResource(request, path, vpath, resPath, resBase, index, pBundle, canCache);
 					}
 					else
 					{
 						std::string newPath(vPath.path);
-						lock.unlock();
 						sendFound(request, newPath);
 					}
 				}
@@ -333,7 +340,6 @@ void WebServerDispatcher::handleRequest(Poco::Net::HTTPServerRequest& request, P
 				else
 					response.requireAuthentication(vPath.security.realm);
 				std::string vpath(vPath.path);
-				lock.unlock();
 				sendNotAuthorized(request, vpath);
 			}
 		}
@@ -421,7 +427,8 @@ void WebServerDispatcher::sendResource(Poco::Net::HTTPServerRequest& request, co
 	Poco::Net::HTTPServerResponse& response(request.response());
 	std::string mediaType;
 	std::string resolvedPath;
-	std::auto_ptr<std::istream> pResourceStream(findResource(pBundle, resBase, resPath, index, mediaType, resolvedPath, canCache));
+	CachedResourcePtr pCachedResource;
+	std::auto_ptr<std::istream> pResourceStream(findResource(pBundle, resBase, resPath, index, mediaType, resolvedPath, canCache, pCachedResource));
 	if (pResourceStream.get())
 	{
 		response.setContentType(mediaType);
@@ -437,6 +444,11 @@ void WebServerDispatcher::sendResource(Poco::Net::HTTPServerRequest& request, co
 			Poco::File bundleFile(pBundle->path());
 			Poco::Timestamp lastModified = bundleFile.getLastModified();
 			response.set("Last-Modified", DateTimeFormatter::format(lastModified, DateTimeFormat::HTTP_FORMAT));
+			if (pCachedResource)
+			{
+				sendCachedResource(request, *pCachedResource, lastModified);
+				return;
+			}
 			if (request.has("If-Modified-Since"))
 			{
 				Poco::DateTime modifiedSince;
@@ -485,6 +497,42 @@ void WebServerDispatcher::sendResource(Poco::Net::HTTPServerRequest& request, co
 }
 
 
+void WebServerDispatcher::sendCachedResource(Poco::Net::HTTPServerRequest& request, const CachedResource& resource, const Poco::Timestamp& lastModified)
+{
+	Poco::Net::HTTPServerResponse& response(request.response());
+
+	bool compressResponse = !resource.gzipData.empty() && request.hasToken("Accept-Encoding", "gzip");
+	const std::string& etag = compressResponse ? resource.gzipETag : resource.etag;
+	const std::string& data = compressResponse ? resource.gzipData : resource.data;
+	
+	response.set("ETag", etag);
+	if (!resource.gzipData.empty()) response.set("Vary", "Accept-Encoding");
+
+	bool notModified = false;
+	if (request.has("If-None-Match"))
+	{
+		notModified = matchETag(request.get("If-None-Match"), etag);
+	}
+	else if (request.has("If-Modified-Since"))
+	{
+		Poco::DateTime modifiedSince;
+		int tzd;
+		Poco::DateTimeParser::parse(request.get("If-Modified-Since"), modifiedSince, tzd);
+		notModified = lastModified <= modifiedSince.timestamp();
+	}
+	if (notModified)
+	{
+		response.setContentLength(0);
+		response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_NOT_MODIFIED);
+		response.send();
+		return;
+	}
+
+	if (compressResponse) response.set("Content-Encoding", "gzip");
+	response.sendBuffer(data.data(), data.size());
+}
+
+
 WebServerDispatcher::WebFilterPtr WebServerDispatcher::findFilter(const std::string& mediaType)
 {
 	WebFilterPtr pFilter;
@@ -542,6 +590,7 @@ void WebServerDispatcher::removeBundle(Bundle::ConstPtr pBundle)
 			++itv;
 		}
 	}
+	updateRouteTable();
 }
 
 
@@ -572,55 +621,210 @@ std::string WebServerDispatcher::normalizePath(const std::string& path)
 }
 
 
-const WebServerDispatcher::VirtualPath& WebServerDispatcher::mapPath(const std::string& path, const std::string& method) const
+WebServerDispatcher::RouteTablePtr WebServerDispatcher::routeTable() const
+{
+	FastMutex::ScopedLock lock(_routeTableMutex);
+
+	return _pRouteTable;
+}
+
+
+void WebServerDispatcher::updateRouteTable()
+{
+	RouteTablePtr pRouteTable = new RouteTable(_pathMap, _patternVec);
+
+	FastMutex::ScopedLock lock(_routeTableMutex);
+	_pRouteTable = pRouteTable;
+}
+
+
+const WebServerDispatcher::VirtualPath& WebServerDispatcher::mapPath(const RouteTable& routeTable, const std::string& path, const std::string& method)
+{
+	const VirtualPath* pVirtualPath = routeTable.find(path, method);
+	if (pVirtualPath)
+		return *pVirtualPath;
+	else
+		throw Poco::NotFoundException(path);
+}
+
+
+WebServerDispatcher::RouteTable::RouteTable(const PathMap& pathMap, const PatternVec& patternVec):
+	_pathMap(pathMap),
+	_patternVec(patternVec),
+	_pathNodes(1),
+	_patternNodes(1)
+{
+	for (PathMap::const_iterator it = _pathMap.begin(); it != _pathMap.end(); ++it)
+	{
+		std::size_t node = 0;
+		std::string::size_type pos = 1;
+		while (pos < it->first.size())
+		{
+			std::string::size_type end = it->first.find('/', pos);
+			if (end == std::string::npos) end = it->first.size();
+			node = pathChild(node, it->first.substr(pos, end - pos));
+			pos = end + 1;
+		}
+		_pathNodes[node].pVirtualPath = &it->second;
+	}
+	for (std::size_t i = 0; i < _patternVec.size(); i++)
+	{
+		std::string prefix = literalPrefix(_patternVec[i].path);
+		std::size_t node = 0;
+		for (std::string::const_iterator it = prefix.begin(); it != prefix.end(); ++it)
+		{
+			node = patternChild(node, *it);
+		}
+		_patternNodes[node].patterns.push_back(i);
+	}
+}
+
+
+WebServerDispatcher::RouteTable::~RouteTable()
+{
+}
+
+
+const WebServerDispatcher::VirtualPath* WebServerDispatcher::RouteTable::find(const std::string& path, const std::string& method) const
+{
+	const VirtualPath* pFound = findPattern(path, method);
+	if (!pFound) pFound = findPath(path);
+	return pFound;
+}
+
+
+std::string WebServerDispatcher::RouteTable::literalPrefix(const std::string& pattern)
+{
+	std::string prefix;
+	if (pattern.find('|') != std::string::npos) return prefix;
+	std::string::size_type i = 0;
+	if (!pattern.empty() && pattern[0] == '^') i++;
+	for (; i < pattern.size(); i++)
+	{
+		char c = pattern[i];
+		if (c == '\\')
+		{
+			if (i + 1 < pattern.size() && std::ispunct(static_cast<unsigned char>(pattern[i + 1])))
+				c = pattern[++i];
+			else 
+				break;
+		}
+		else if (std::strchr("$.[]()*+?{}", c))
+		{
+			// a quantifier makes the preceding character optional
+			if ((c == '*' || c == '?' || c == '{') && !prefix.empty())
+				prefix.resize(prefix.size() - 1);
+			break;
+		}
+		prefix += c;
+	}
+	return prefix;
+}
+
+
+std::size_t WebServerDispatcher::RouteTable::pathChild(std::size_t node, const std::string& segment)
 {
-	PatternVec::const_iterator foundItv = _patternVec.end();
-	for (PatternVec::const_iterator itv = _patternVec.begin(); itv != _patternVec.end(); ++itv)
+	std::map<std::string, std::size_t>::const_iterator it = _pathNodes[node].children.find(segment);
+	if (it != _pathNodes[node].children.end()) return it->second;
+	std::size_t child = _pathNodes.size();
+	_pathNodes.push_back(PathNode());
+	_pathNodes[node].children[segment] = child;
+	return child;
+}
+
+
+std::size_t WebServerDispatcher::RouteTable::patternChild(std::size_t node, char c)
+{
+	std::map<char, std::size_t>::const_iterator it = _patternNodes[node].children.find(c);
+	if (it != _patternNodes[node].children.end()) return it->second;
+	std::size_t child = _patternNodes.size();
+	_patternNodes.push_back(PatternNode());
+	_patternNodes[node].children[c] = child;
+	return child;
+}
+
+
+const WebServerDispatcher::VirtualPath* WebServerDispatcher::RouteTable::findPattern(const std::string& path, const std::string& method) const
+{
+	if (_patternVec.empty()) return 0;
+
+	std::vector<std::size_t> candidates;
+	std::size_t node = 0;
+	std::string::const_iterator it = path.begin();
+	while (true)
+	{
+		candidates.insert(candidates.end(), _patternNodes[node].patterns.begin(), _patternNodes[node].patterns.end());
+		if (it == path.end()) break;
+		std::map<char, std::size_t>::const_iterator itc = _patternNodes[node].children.find(*it++);
+		if (itc == _patternNodes[node].children.end()) break;
+		node = itc->second;
+	}
+	if (candidates.empty()) return 0;
+	
+	// Preserve registration order when selecting a pattern.
+	std::sort(candidates.begin(), candidates.end());
+	const VirtualPath* pFound = 0;
+	for (std::vector<std::size_t>::const_iterator itc = candidates.begin(); itc != candidates.end(); ++itc)
 	{
-		if (itv->pPattern->match(path))
+		const VirtualPath& vPath = _patternVec[*itc];
+		if (vPath.pPattern->match(path))
 		{
-			if (foundItv == _patternVec.end())
+			if (!pFound)
 			{
 				// Return something matching the pattern even if methods don't match.
 				// Methods will be checked by caller, so a proper 405 can be returned.
-				foundItv = itv;
+				pFound = &vPath;
 			}
 			else
 			{
 				// Already have something, but this also matches method.
-				if (itv->methods.empty() || itv->methods.count(method) == 1)
-					foundItv = itv;
+				if (vPath.methods.empty() || vPath.methods.count(method) == 1)
+					pFound = &vPath;
 			}
 		}
 	}
-	if (foundItv != _patternVec.end())
-	{
-		return *foundItv;
-	}
-	else
+	return pFound;
+}
+
+
+const WebServerDispatcher::VirtualPath* WebServerDispatcher::RouteTable::findPath(const std::string& path) const
+{
+	// Split path into segments, resolving "." and "..", 
+	// the same way normalizePath() does.
+	std::vector<std::pair<std::string::size_type, std::string::size_type> > segments;
+	std::string::size_type pos = 0;
+	while (pos < path.size())
 	{
-		std::string normPath(normalizePath(path));
-		Path p(normPath, Path::PATH_UNIX);
-		std::string parent("/");
-		PathMap::const_iterator foundIt = _pathMap.find(parent);
-		for (int i = 0; i < p.depth(); ++i)
+		std::string::size_type end = path.find('/', pos);
+		if (end == std::string::npos) end = path.size();
+		std::string::size_type len = end - pos;
+		if (len == 2 && path[pos] == '.' && path[pos + 1] == '.')
 		{
-			parent += p[i];
-			parent += '/';
-			PathMap::const_iterator it = _pathMap.find(parent);
-			if (it != _pathMap.end() && !it->second.pPattern)
-				foundIt = it;
+			if (!segments.empty()) segments.pop_back();
 		}
-		if (foundIt != _pathMap.end())
+		else if (len > 0 && !(len == 1 && path[pos] == '.'))
 		{
-			return foundIt->second;
+			segments.push_back(std::make_pair(pos, len));
 		}
-		else throw Poco::NotFoundException(path);
+		pos = end + 1;
 	}
+	
+	std::size_t node = 0;
+	const VirtualPath* pFound = _pathNodes[0].pVirtualPath;
+	std::string segment;
+	for (std::size_t i = 0; i < segments.size(); i++)
+	{
+		segment.assign(path, segments[i].first, segments[i].second);
+		std::map<std::string, std::size_t>::const_iterator it = _pathNodes[node].children.find(segment);
+		if (it == _pathNodes[node].children.end()) break;
+		node = it->second;
+		if (_pathNodes[node].pVirtualPath) pFound = _pathNodes[node].pVirtualPath;
+	}
+	return pFound;
 }
 
 
-std::istream* WebServerDispatcher::findResource(Bundle::ConstPtr pBundle, const std::string& base, const std::string& res, const std::string& index, std::string& mediaType, std::string& resolvedPath, bool canCache) const
+std::istream* WebServerDispatcher::findResource(Bundle::ConstPtr pBundle, const std::string& base, const std::string& res, const std::string& index, std::string& mediaType, std::string& resolvedPath, bool canCache, CachedResourcePtr& pCachedResource) const
 {
 	Path basePath(base, Path::PATH_UNIX);
 	basePath.makeDirectory();
@@ -628,20 +832,20 @@ std::istream* WebServerDispatcher::findResource(Bundle::ConstPtr pBundle, const
 	basePath.append(resPath);
 	resolvedPath = basePath.toString(Path::PATH_UNIX);
 	mediaType = _pMediaTypeMapper->map(basePath.getExtension());
-	std::istream* pStream = getCachedResource(pBundle, resolvedPath, canCache);
+	std::istream* pStream = getCachedResource(pBundle, resolvedPath, mediaType, canCache, pCachedResource);
 	if (!pStream)
 	{
 		basePath.makeDirectory();
 		basePath.setFileName(index);
 		resolvedPath = basePath.toString(Path::PATH_UNIX);
 		mediaType = _pMediaTypeMapper->map(basePath.getExtension());
-		pStream = getCachedResource(pBundle, resolvedPath, canCache);
+		pStream = getCachedResource(pBundle, resolvedPath, mediaType, canCache, pCachedResource);
 	}
 	return pStream;
 }
 
 
-std::istream* WebServerDispatcher::getCachedResource(Bundle::ConstPtr pBundle, const std::string& path, bool canCache) const
+std::istream* WebServerDispatcher::getCachedResource(Bundle::ConstPtr pBundle, const std::string& path, const std::string& mediaType, bool canCache, CachedResourcePtr& pCachedResource) const
 {
 	if (_cacheResources && canCache)
 	{
@@ -653,7 +857,7 @@ std::istream* WebServerDispatcher::getCachedResource(Bundle::ConstPtr pBundle, c
 		ResourceCache::iterator it = _resourceCache.find(cachePath);
 		if (it != _resourceCache.end())
 		{
-			return new Poco::MemoryInputStream(it->second.data(), it->second.size());
+			pCachedResource = it->second;
 		}
 		else
 		{
@@ -661,25 +865,24 @@ std::istream* WebServerDispatcher::getCachedResource(Bundle::ConstPtr pBundle, c
 			std::auto_ptr<std::istream> pResourceStream(pBundle->getResource(path));
 			if (pResourceStream.get())
 			{
-				std::string cachedData;
-				Poco::StreamCopier::copyToString(*pResourceStream, cachedData);
+				CachedResourcePtr pNewResource = createCachedResource(*pResourceStream, mediaType);
 
 				Poco::FastMutex::ScopedLock lock(_resourceCacheMutex);
 				// Make sure another thread has not cached the resource in the meantime.
 				it = _resourceCache.find(cachePath);
 				if (it == _resourceCache.end())
 				{
-					std::string& cacheEntry = _resourceCache[cachePath];
-					std::swap(cachedData, cacheEntry);
-					return new Poco::MemoryInputStream(cacheEntry.data(), cacheEntry.size());
+					_resourceCache[cachePath] = pNewResource;
+					pCachedResource = pNewResource;
 				}
 				else
 				{
-					return new Poco::MemoryInputStream(it->second.data(), it->second.size());
+					pCachedResource = it->second;
 				}
 			}
 			else return 0;
 		}
+		return new Poco::MemoryInputStream(pCachedResource->data.data(), pCachedResource->data.size());
 	}
 	else
 	{
@@ -689,6 +892,47 @@ std::istream* WebServerDispatcher::getCachedResource(Bundle::ConstPtr pBundle, c
 }
 
 
+WebServerDispatcher::CachedResourcePtr WebServerDispatcher::createCachedResource(std::istream& istr, const std::string& mediaType) const
+{
+	CachedResourcePtr pResource = new CachedResource;
+	Poco::StreamCopier::copyToString(istr, pResource->data);
+
+	Poco::SHA1Engine sha1;
+	sha1.update(pResource->data);
+	std::string digest = Poco::DigestEngine::digestToHex(sha1.digest());
+	pResource->etag = "\"";
+	pResource->etag += digest;
+	pResource->etag += "\"";
+
+	if (_compressResponses && shouldCompressMediaType(mediaType))
+	{
+		std::ostringstream ostr;
+		Poco::DeflatingOutputStream gzipStream(ostr, Poco::DeflatingStreamBuf::STREAM_GZIP, 9);
+		gzipStream.write(pResource->data.data(), static_cast<std::streamsize>(pResource->data.size()));
+		gzipStream.close();
+		pResource->gzipData = ostr.str();
+		pResource->gzipETag = "\"";
+		pResource->gzipETag += digest;
+		pResource->gzipETag += "-gzip\"";
+	}
+	return pResource;
+}
+
+
+bool WebServerDispatcher::matchETag(const std::string& ifNoneMatch, const std::string& etag)
+{
+	std::string opaqueTag(etag, etag.compare(0, 2, "W/") == 0 ? 2 : 0);
+	Poco::StringTokenizer tok(ifNoneMatch, ",", Poco::StringTokenizer::TOK_TRIM | Poco::StringTokenizer::TOK_IGNORE_EMPTY);
+	for (Poco::StringTokenizer::Iterator it = tok.begin(); it != tok.end(); ++it)
+	{
+		if (*it == "*") return true;
+		std::string::size_type pos = it->compare(0, 2, "W/") == 0 ? 2 : 0;
+		if (it->compare(pos, std::string::npos, opaqueTag) == 0) return true;
+	}
+	return false;
+}
+
+
 bool WebServerDispatcher::cleanPath(std::string& path)
 {
 	std::string::iterator it(path.begin());
@@ -36,6 +36,27 @@ using Poco::Path;
 using Poco::File;
 
 
+namespace
+{
+	class TestWebServerDispatcher: public WebServerDispatcher
+	{
+	public:
+		TestWebServerDispatcher(BundleContext::Ptr pContext, MediaTypeMapper::Ptr pMediaTypeMapper, const std::set<std::string>& compressedMediaTypes):
+			WebServerDispatcher(pContext, pMediaTypeMapper, "", false, compressedMediaTypes)
+		{
+		}
+		
+		const std::string& map(const std::string& path, const std::string& method = "GET")
+		{
+			RouteTablePtr pRouteTable = routeTable();
+			return mapPath(*pRouteTable, path, method).path;
+		}
+	
+		using WebServerDispatcher::matchETag;
+	};
+}
+
+
 WebServerDispatcherTest::WebServerDispatcherTest(const std::string& name): CppUnit::TestCase(name)
 {
 }
@@ -213,6 +234,110 @@ void WebServerDispatcherTest::testRemoveDir()
 }
 
 
+void WebServerDispatcherTest::testMapPath()
+{
+	CodeCache cc("codeCache");
+	ServiceRegistry reg;
+	LanguageTag lang("en", "US");
+	
+	BundleFactory::Ptr pBundleFactory(new BundleFactory(lang));
+	Poco::OSP::SystemEvents systemEvents;
+	BundleContextFactory::Ptr pBundleContextFactory(new BundleContextFactory(reg, systemEvents));
+	BundleLoader loader(cc, pBundleFactory, pBundleContextFactory);
+	BundleEvents events;
+
+	Bundle::Ptr pBundle = loader.createBundle("testBundle.zip");
+	BundleContext::Ptr pContext = pBundleContextFactory->createBundleContext(loader, pBundle, events);
+	MediaTypeMapper::Ptr pMapper;
+	std::set<std::string> compressedMediaTypes;
+	TestWebServerDispatcher disp(pContext, pMapper, compressedMediaTypes);
+
+	try
+	{
+		disp.map("/index.html");
+		fail("no mapping - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+
+	WebServerDispatcher::VirtualPath vPath;
+	vPath.path = "/";
+	vPath.resource = "res";
+	vPath.security.mode = WebServerDispatcher::SM_ALL;
+	vPath.pOwnerBundle = pBundle;
+	disp.addVirtualPath(vPath);
+
+	vPath.path = "/sub";
+	vPath.resource = "res2";
+	disp.addVirtualPath(vPath);
+	
+	vPath.path = "/sub/subsub";
+	vPath.resource = "res3";
+	disp.addVirtualPath(vPath);
+
+	assert (disp.map("/") == "/");
+	assert (disp.map("/index.html") == "/");
+	assert (disp.map("/sub") == "/sub/");
+	assert (disp.map("/sub/") == "/sub/");
+	assert (disp.map("/sub/index.html") == "/sub/");
+	assert (disp.map("/sub/subsub/images/logo.png") == "/sub/subsub/");
+	assert (disp.map("/sub/subsubsub") == "/sub/");
+	assert (disp.map("/sub//subsub/") == "/sub/subsub/");
+	assert (disp.map("/sub/./subsub/") == "/sub/subsub/");
+	assert (disp.map("/sub/subsub/../index.html") == "/sub/");
+	assert (disp.map("/other/sub/subsub") == "/");
+
+	WebServerDispatcher::VirtualPath pPath;
+	pPath.path = "/sub/[a-z]+\\.json";
+	pPath.pPattern = new Poco::RegularExpression(pPath.path, Poco::RegularExpression::RE_ANCHORED);
+	pPath.pOwnerBundle = pBundle;
+	disp.addVirtualPath(pPath);
+
+	pPath.path = "/sub/data\\.json";
+	pPath.pPattern = new Poco::RegularExpression(pPath.path, Poco::RegularExpression::RE_ANCHORED);
+	pPath.methods.insert("POST");
+	disp.addVirtualPath(pPath);
+
+	pPath.path = "/s?ub/x";
+	pPath.pPattern = new Poco::RegularExpression(pPath.path, Poco::RegularExpression::RE_ANCHORED);
+	pPath.methods.clear();
+	disp.addVirtualPath(pPath);
+
+	pPath.path = "/(a|b)\\.txt";
+	pPath.pPattern = new Poco::RegularExpression(pPath.path, Poco::RegularExpression::RE_ANCHORED);
+	disp.addVirtualPath(pPath);
+
+	assert (disp.map("/sub/test.json") == "/sub/[a-z]+\\.json");
+	assert (disp.map("/sub/data.json") == "/sub/[a-z]+\\.json");
+	assert (disp.map("/sub/data.json", "POST") == "/sub/data\\.json");
+	assert (disp.map("/sub/Test.json") == "/sub/");
+	assert (disp.map("/sub/x") == "/s?ub/x");
+	assert (disp.map("/ub/x") == "/s?ub/x");
+	assert (disp.map("/b.txt") == "/(a|b)\\.txt");
+	assert (disp.map("/c.txt") == "/");
+
+	disp.removeVirtualPath("/sub/[a-z]+\\.json");
+	assert (disp.map("/sub/test.json") == "/sub/");
+	assert (disp.map("/sub/data.json") == "/sub/data\\.json");
+	
+	disp.removeVirtualPath("/sub/subsub");
+	assert (disp.map("/sub/subsub/images/logo.png") == "/sub/");
+}
+
+
+void WebServerDispatcherTest::testMatchETag()
+{
+	assert (TestWebServerDispatcher::matchETag("\"abc\"", "\"abc\""));
+	assert (TestWebServerDispatcher::matchETag("W/\"abc\"", "\"abc\""));
+	assert (TestWebServerDispatcher::matchETag("\"xyz\", \"abc\"", "\"abc\""));
+	assert (TestWebServerDispatcher::matchETag("*", "\"abc\""));
+	assert (!TestWebServerDispatcher::matchETag("\"xyz\"", "\"abc\""));
+	assert (!TestWebServerDispatcher::matchETag("\"abc-gzip\"", "\"abc\""));
+	assert (!TestWebServerDispatcher::matchETag("", "\"abc\""));
+}
+
+
 void WebServerDispatcherTest::setUp()
 {
 	// The following is a ZIP file containing the same
@@ -264,6 +389,8 @@ CppUnit::Test* WebServerDispatcherTest::suite()
 	CppUnit_addTest(pSuite, WebServerDispatcherTest, testVirtualDirectoryAllow);
 	CppUnit_addTest(pSuite, WebServerDispatcherTest, testVirtualDirectoryFail);
 	CppUnit_addTest(pSuite, WebServerDispatcherTest, testRemoveDir);
+	CppUnit_addTest(pSuite, WebServerDispatcherTest, testMapPath);
+	CppUnit_addTest(pSuite, WebServerDispatcherTest, testMatchETag);
 
 	return pSuite;
 }
@@ -30,6 +30,8 @@ public:
 	void testVirtualDirectoryAllow();
 	void testVirtualDirectoryFail();
 	void testRemoveDir();
+	void testMapPath();
+	void testMatchETag();
 
 	void setUp();
 	void tearDown();
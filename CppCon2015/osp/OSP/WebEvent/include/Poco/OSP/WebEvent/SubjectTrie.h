@@ -0,0 +1,339 @@
+//
+// SubjectTrie.h
+//
+// $Id: //poco/1.6/OSP/WebEvent/include/Poco/OSP/WebEvent/SubjectTrie.h#1 $
+//
+// Library: OSP/WebEvent
+// Package: WebEvent
+// Module:  SubjectTrie
+//
+// Definition of the SubjectTrie class template.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef OSP_WebEvent_SubjectTrie_INCLUDED
+#define OSP_WebEvent_SubjectTrie_INCLUDED
+
+
+#include "Poco/OSP/WebEvent/WebEvent.h"
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+
+namespace Poco {
+namespace OSP {
+namespace WebEvent {
+
+
+template <class TValue>
+class SubjectTrie
+	/// SubjectTrie maps subject names, or subject name patterns, to
+	/// values, and efficiently finds all values registered for
+	/// subjects matching a given subject name.
+	///
+	/// Subject names consist of parts (segments) delimited by periods,
+	/// and the trie has one level for every segment.
+	/// Matching is hierarchical: a value registered for a subject
+	/// (e.g., "com.appinf.events") matches that subject, as well as
+	/// all of its "child" subjects (e.g., "com.appinf.events.someEvent").
+	///
+	/// Furthermore, a subject registered with insert() can contain
+	/// the following wildcard segments:
+	///
+	///   - "*" matches exactly one segment. For example, "com.*.events"
+	///     matches "com.appinf.events" and "com.appinf.events.someEvent",
+	///     but not "com.events".
+	///   - "#", if used as the last segment, matches any number of segments,
+	///     including none. For example, "com.appinf.#" matches "com.appinf"
+	///     and all of its children. Therefore, "#" alone matches all subjects.
+	///     In any other position, "#" has no special meaning.
+	///
+	/// Finding the matches for a subject takes time proportional to the
+	/// number of segments in the subject (multiplied by the number
+	/// of "*" wildcard branches taken), independent of the number of
+	/// registered subjects, and does not allocate memory, except for
+	/// adding the matching values to the result vector.
+	///
+	/// SubjectTrie is not thread-safe.
+{
+public:
+	typedef TValue Value;
+	typedef std::vector<TValue> ValueVec;
+
+	SubjectTrie():
+		_pRoot(new Node)
+		/// Creates an empty SubjectTrie.
+	{
+	}
+
+	~SubjectTrie()
+		/// Destroys the SubjectTrie.
+	{
+		delete _pRoot;
+	}
+
+	void insert(const std::string& subject, const TValue& value)
+		/// Registers the given value for the given subject,
+		/// which may contain wildcard segments.
+		///
+		/// The same value can be registered more than once
+		/// for a subject.
+	{
+		Node* pNode = _pRoot;
+		const char* it  = subject.data();
+		const char* end = it + subject.size();
+		while (true)
+		{
+			const char* segEnd = segmentEnd(it, end);
+			pNode = pNode->child(it, segEnd, segEnd == end, true);
+			if (segEnd == end) break;
+			it = segEnd + 1;
+		}
+		pNode->values.push_back(value);
+	}
+
+	bool remove(const std::string& subject, const TValue& value)
+		/// Removes one registration of the given value for the
+		/// given subject, which must be specified exactly as
+		/// given to insert().
+		///
+		/// Returns true if the value was found and has been removed,
+		/// otherwise false.
+	{
+		return removeImpl(*_pRoot, subject.data(), subject.data() + subject.size(), value);
+	}
+
+	const ValueVec* find(const std::string& subject) const
+		/// Returns a pointer to the values registered for exactly
+		/// the given subject (wildcards are not expanded), or
+		/// a null pointer if no value is registered.
+	{
+		const Node* pNode = _pRoot;
+		const char* it  = subject.data();
+		const char* end = it + subject.size();
+		while (pNode)
+		{
+			const char* segEnd = segmentEnd(it, end);
+			pNode = const_cast<Node*>(pNode)->child(it, segEnd, segEnd == end, false);
+			if (segEnd == end) break;
+			it = segEnd + 1;
+		}
+		return pNode && !pNode->values.empty() ? &pNode->values : 0;
+	}
+
+	std::size_t match(const std::string& subject, ValueVec& matches) const
+		/// Appends all values registered for subjects matching the
+		/// given subject to matches. The given subject is taken
+		/// literally, i.e., it must not contain wildcards.
+		///
+		/// Returns the number of values appended.
+	{
+		std::size_t n = matches.size();
+		matchImpl(*_pRoot, subject.data(), subject.data() + subject.size(), true, matches);
+		return matches.size() - n;
+	}
+
+	bool empty() const
+		/// Returns true if no value is registered.
+	{
+		return _pRoot->empty();
+	}
+
+	void clear()
+		/// Removes all values.
+	{
+		Node* pRoot = new Node;
+		delete _pRoot;
+		_pRoot = pRoot;
+	}
+
+private:
+	SubjectTrie(const SubjectTrie&);
+	SubjectTrie& operator = (const SubjectTrie&);
+
+	struct Node
+	{
+		typedef std::pair<std::string, Node*> Child;
+		typedef std::vector<Child> ChildVec;
+
+		Node():
+			pAnySegment(0),
+			pAnyChildren(0)
+		{
+		}
+
+		~Node()
+		{
+			for (typename ChildVec::iterator it = children.begin(); it != children.end(); ++it)
+			{
+				delete it->second;
+			}
+			delete pAnySegment;
+			delete pAnyChildren;
+		}
+
+		bool empty() const
+		{
+			return values.empty() && children.empty() && !pAnySegment && !pAnyChildren;
+		}
+
+		typename ChildVec::iterator lowerBound(const char* begin, const char* end)
+			/// Returns the position of the first child whose name
+			/// is not less than the given segment.
+		{
+			std::size_t length = end - begin;
+			typename ChildVec::iterator lo = children.begin();
+			std::size_t count = children.size();
+			while (count > 0)
+			{
+				std::size_t step = count/2;
+				typename ChildVec::iterator mid = lo + step;
+				if (mid->first.compare(0, mid->first.size(), begin, length) < 0)
+				{
+					lo = ++mid;
+					count -= step + 1;
+				}
+				else count = step;
+			}
+			return lo;
+		}
+
+		Node* literalChild(const char* begin, const char* end) const
+		{
+			typename ChildVec::iterator it = const_cast<Node*>(this)->lowerBound(begin, end);
+			if (it != children.end() && it->first.compare(0, it->first.size(), begin, end - begin) == 0)
+				return it->second;
+			else
+				return 0;
+		}
+
+		Node* child(const char* begin, const char* end, bool last, bool create)
+			/// Returns the child for the given segment of a registered subject,
+			/// which may be a wildcard. If create is true, the child is created
+			/// if it does not exist yet.
+		{
+			if (end - begin == 1 && *begin == '*')
+			{
+				if (!pAnySegment && create) pAnySegment = new Node;
+				return pAnySegment;
+			}
+			else if (last && end - begin == 1 && *begin == '#')
+			{
+				if (!pAnyChildren && create) pAnyChildren = new Node;
+				return pAnyChildren;
+			}
+			typename ChildVec::iterator it = lowerBound(begin, end);
+			if (it != children.end() && it->first.compare(0, it->first.size(), begin, end - begin) == 0)
+			{
+				return it->second;
+			}
+			else if (create)
+			{
+				Node* pChild = new Node;
+				children.insert(it, Child(std::string(begin, end), pChild));
+				return pChild;
+			}
+			else return 0;
+		}
+
+		void removeChild(const Node* pChild)
+		{
+			if (pChild == pAnySegment)
+			{
+				pAnySegment = 0;
+			}
+			else if (pChild == pAnyChildren)
+			{
+				pAnyChildren = 0;
+			}
+			else
+			{
+				for (typename ChildVec::iterator it = children.begin(); it != children.end(); ++it)
+				{
+					if (it->second == pChild)
+					{
+						children.erase(it);
+						break;
+					}
+				}
+			}
+			delete pChild;
+		}
+
+		ValueVec values;
+		ChildVec children;  /// literal children, sorted by name
+		Node* pAnySegment;  /// child for "*"
+		Node* pAnyChildren; /// child for a trailing "#"
+	};
+
+	static const char* segmentEnd(const char* it, const char* end)
+	{
+		while (it != end && *it != '.') ++it;
+		return it;
+	}
+
+	bool removeImpl(Node& node, const char* it, const char* end, const TValue& value)
+	{
+		const char* segEnd = segmentEnd(it, end);
+		Node* pChild = node.child(it, segEnd, segEnd == end, false);
+		if (!pChild) return false;
+
+		bool found = false;
+		if (segEnd == end)
+		{
+			typename ValueVec::iterator itVal = std::find(pChild->values.begin(), pChild->values.end(), value);
+			if (itVal != pChild->values.end())
+			{
+				pChild->values.erase(itVal);
+				found = true;
+			}
+		}
+		else
+		{
+			found = removeImpl(*pChild, segEnd + 1, end, value);
+		}
+		if (pChild->empty()) node.removeChild(pChild);
+		return found;
+	}
+
+	static void matchImpl(const Node& node, const char* it, const char* end, bool more, ValueVec& matches)
+		/// Matches the remaining segments of the subject, starting at it,
+		/// against the children of node. If more is false, there are no
+		/// remaining segments.
+	{
+		if (node.pAnyChildren)
+		{
+			matches.insert(matches.end(), node.pAnyChildren->values.begin(), node.pAnyChildren->values.end());
+		}
+		if (!more) return;
+
+		const char* segEnd = segmentEnd(it, end);
+		bool nextMore = segEnd != end;
+		const char* next = nextMore ? segEnd + 1 : segEnd;
+		const Node* pChild = node.literalChild(it, segEnd);
+		if (pChild)
+		{
+			matches.insert(matches.end(), pChild->values.begin(), pChild->values.end());
+			matchImpl(*pChild, next, end, nextMore, matches);
+		}
+		if (node.pAnySegment)
+		{
+			matches.insert(matches.end(), node.pAnySegment->values.begin(), node.pAnySegment->values.end());
+			matchImpl(*node.pAnySegment, next, end, nextMore, matches);
+		}
+	}
+
+	Node* _pRoot;
+};
+
+
+} } } // namespace Poco::OSP::WebEvent
+
+
+#endif // OSP_WebEvent_SubjectTrie_INCLUDED
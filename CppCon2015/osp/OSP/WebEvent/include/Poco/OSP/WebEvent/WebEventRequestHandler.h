@@ -39,8 +39,11 @@ class OSPWebEvent_API WebEventRequestHandler: public Poco::Net::HTTPRequestHandl
 	/// the WebSocket is transferred to the WebEventServiceImpl instance.
 {
 public:
-	WebEventRequestHandler(WebEventServiceImpl::Ptr pWebEventServiceImpl, Poco::OSP::BundleContext::Ptr pContext);
+	WebEventRequestHandler(WebEventServiceImpl::Ptr pWebEventServiceImpl, Poco::OSP::BundleContext::Ptr pContext, bool compression = false);
 		/// Creates the WebEventRequestHandler.
+		///
+		/// If compression is true, the permessage-deflate extension
+		/// is accepted if offered by the client.
 		
 	WebEventRequestHandler();
 		/// Destroys the WebEventRequestHandler.
@@ -52,6 +55,7 @@ public:
 private:
 	WebEventServiceImpl::Ptr _pWebEventServiceImpl;
 	Poco::OSP::BundleContext::Ptr _pContext;
+	bool _compression;
 };
 
 
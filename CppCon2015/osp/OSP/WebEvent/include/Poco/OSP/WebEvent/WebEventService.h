@@ -59,6 +59,15 @@ class OSPWebEvent_API WebEventService: public Poco::OSP::Service
 	/// all "child" subjects (e.g., "com.appinf.events.someEvent" and 
 	/// "com.appinf.events.someOtherEvent").
 	///
+	/// The subject names in a SUBSCRIBE message can also contain
+	/// wildcards. An asterisk ("*") matches exactly one part of a subject
+	/// name, so a subscriber to "com.*.events" will receive 
+	/// "com.appinf.events" and "com.other.events.someEvent". 
+	/// A hash sign ("#") as last part matches any number of parts, 
+	/// including none, so a subscriber to "#" will receive all subjects.
+	/// A subscriber receives a notification only once, even if more 
+	/// than one of its subscriptions match the notification's subject.
+	///
 	/// A client can unsubscribe from specific events by either sending an
 	/// unsubscribe request or by simply closing the WebSocket. The
 	/// format of the UNSUBSCRIBE message is similar to the SUBSCRIBE message:
@@ -21,8 +21,10 @@
 
 
 #include "Poco/OSP/WebEvent/WebEventService.h"
+#include "Poco/OSP/WebEvent/SubjectTrie.h"
 #include "Poco/OSP/BundleContext.h"
 #include "Poco/Net/WebSocket.h"
+#include "Poco/Net/PollSet.h"
 #include "Poco/NotificationQueue.h"
 #include "Poco/Thread.h"
 #include "Poco/RunnableAdapter.h"
@@ -30,6 +32,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/SharedPtr.h"
 #include <vector>
+#include <deque>
 #include <set>
 #include <map>
 
@@ -40,12 +43,53 @@ namespace WebEvent {
 
 
 class OSPWebEvent_API WebEventServiceImpl: public WebEventService
+	/// The implementation of the WebEventService.
+	///
+	/// All subscriptions and notifications are handled by a single
+	/// main thread running an event loop. A NOTIFY message is encoded 
+	/// into a WebSocket frame only once, and the reference-counted 
+	/// frame is shared by the outbound queues of all subscribers.
+	/// Frames are written to the subscriber's socket from the event loop, 
+	/// using non-blocking I/O, as soon as the socket is writable.
+	/// On platforms without support for non-blocking sends, and for
+	/// secure WebSockets, frames are sent by worker threads instead.
+	///
+	/// The number of frames queued for a subscriber is limited.
+	/// If a slow subscriber exceeds the limit, either the oldest
+	/// queued frames are discarded, or the subscriber is disconnected,
+	/// depending on the BacklogPolicy.
+	///
+	/// Subscriptions are kept in a SubjectTrie, so the cost of
+	/// finding the subscribers for a notification depends on the
+	/// depth of the subject, not on the number of subscriptions.
+	/// In addition to hierarchical subscriptions, subscriptions
+	/// can contain the "*" and "#" wildcards supported by SubjectTrie.
+	/// A subscriber receives a notification only once, even if
+	/// more than one of its subscriptions match the subject.
 {
 public:
 	typedef Poco::AutoPtr<WebEventServiceImpl> Ptr;
 	
-	WebEventServiceImpl(Poco::OSP::BundleContext::Ptr pContext, int maxSockets);
+	enum BacklogPolicy
+		/// Specifies what happens if the limit of queued frames
+		/// for a subscriber is exceeded.
+	{
+		BACKLOG_DROP_OLDEST, /// Discard the oldest queued frame that has not been partially sent.
+		BACKLOG_DISCONNECT   /// Close the subscriber's WebSocket.
+	};
+	
+	enum
+	{
+		DEFAULT_MAX_QUEUED_FRAMES = 1024
+	};
+	
+	WebEventServiceImpl(Poco::OSP::BundleContext::Ptr pContext, int maxSockets, int maxQueuedFrames = DEFAULT_MAX_QUEUED_FRAMES, BacklogPolicy backlogPolicy = BACKLOG_DISCONNECT);
 		/// Creates the WebEventServiceImpl.
+		///
+		/// The maximum number of WebSocket connections is given in maxSockets
+		/// (0 means unlimited). At most maxQueuedFrames frames will be
+		/// queued for sending to a single subscriber, before backlogPolicy
+		/// is applied.
 		
 	~WebEventServiceImpl();
 		/// Destroys the WebEventServiceImpl.
@@ -59,27 +103,84 @@ public:
 	bool isA(const std::type_info& otherType) const;
 
 protected:
+	class Frame: public Poco::RefCountedObject
+		/// An immutable, encoded WebSocket text frame.
+	{
+	public:
+		typedef Poco::AutoPtr<Frame> Ptr;
+		
+		explicit Frame(const std::string& payload);
+			/// Creates the Frame, containing the given payload.
+		
+		const char* data() const;
+			/// Returns a pointer to the encoded frame.
+			
+		std::size_t size() const;
+			/// Returns the size of the encoded frame.
+
+		const char* payload() const;
+			/// Returns a pointer to the frame payload.
+			
+		std::size_t payloadSize() const;
+			/// Returns the size of the frame payload.
+		
+	private:
+		std::string _data;
+		std::size_t _headerSize;
+	};
+
+	struct Subscriber: public Poco::RefCountedObject
+	{
+		typedef Poco::AutoPtr<Subscriber> Ptr;
+		
+		Subscriber():
+			lastNotification(0),
+			outOffset(0),
+			watchRead(false),
+			nonBlockingSend(false)
+		{
+		}
+
+		Poco::SharedPtr<Poco::Net::WebSocket> pWebSocket;
+		std::set<std::string> subjectNames;
+		Poco::UInt64 lastNotification;   /// sequence number of the last notification queued
+		std::deque<Frame::Ptr> outQueue; /// frames waiting to be sent
+		std::size_t outOffset;           /// number of bytes of the first frame in outQueue already sent
+		bool watchRead;                  /// socket is watched for incoming frames
+		bool nonBlockingSend;            /// frames are sent by the main thread, using non-blocking I/O
+	};
+
 	void preflightRequest(Poco::Net::HTTPServerRequest& request);
 	void runMain();
 	void runWorker();
 	void addSubscriber(Poco::SharedPtr<Poco::Net::WebSocket> pWS);
-	void removeSubscriber(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool clientShutdown);
+	void removeSubscriber(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool abort);
 	void subscribe(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::set<std::string>& subjectNames);
 	void unsubscribe(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::set<std::string>& subjectNames);
 	void send(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::string& message);
+	void writeFrame(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Frame::Ptr pFrame);
 	void receive(Poco::SharedPtr<Poco::Net::WebSocket> pWS);
-	void shutdown(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool passive);
+	void shutdown(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool abort);
 	
 	void notifyImpl(const std::string& subjectName, const std::string& data);
 	void addSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS);
-	void removeSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool clientShutdown);
+	void removeSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool abort);
+		/// Removes the subscriber and closes its WebSocket.
+		/// If abort is true, or a frame has been partially sent
+		/// to the subscriber, the socket is closed without
+		/// sending a Close frame.
+
 	void subscribeImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::set<std::string>& subjectNames);
 	void unsubscribeImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::set<std::string>& subjectNames);
-	void sendImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::string& message);
+	void sendImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Frame::Ptr pFrame);
+	void writeFrameImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Frame::Ptr pFrame);
 	void receiveImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS);
-	void shutdownImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool passive);
+	void shutdownImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool abort);
 	void watchSocketImpl(const Poco::Net::Socket& socket);
 	void unwatchSocketImpl(const Poco::Net::Socket& socket);
+	bool queueFrameImpl(Subscriber& subscriber, Frame::Ptr pFrame);
+	bool flushImpl(Subscriber& subscriber);
+	void updateWatchImpl(const Subscriber& subscriber);
 
 private:
 	static const std::string SUBSCRIBE;
@@ -92,31 +193,28 @@ private:
 	enum
 	{
 		WEBEVENT_RECEIVE_TIMEOUT = 5,
-		WEBEVENT_SEND_TIMEOUT = 10,
-		WEBEVENT_SHUTDOWN_TIMEOUT = 2 
+		WEBEVENT_SEND_TIMEOUT = 10
 	};
 	
-	struct Subscriber: public Poco::RefCountedObject
-	{
-		typedef Poco::AutoPtr<Subscriber> Ptr;
-
-		Poco::SharedPtr<Poco::Net::WebSocket> pWebSocket;
-		std::set<std::string> subjectNames;
-	};
-	typedef std::multimap<std::string, Subscriber::Ptr> SubjectMap;
+	typedef SubjectTrie<Subscriber::Ptr> SubscriberTrie;
 	typedef Poco::BasicEvent<const NotificationEvent> Event;
 	typedef Poco::SharedPtr<Event> EventPtr;
-	typedef std::multimap<std::string, EventPtr> EventMap;
+	typedef SubjectTrie<EventPtr> EventTrie;
 	typedef std::map<Poco::Net::Socket, Subscriber::Ptr> SocketMap;
 	typedef Poco::SharedPtr<Poco::Thread> ThreadPtr;
 	typedef std::vector<ThreadPtr> ThreadVec;
 	
 	Poco::OSP::BundleContext::Ptr _pContext;
 	int _maxSockets;
-	SubjectMap _subjectMap;
-	EventMap _eventMap;
+	std::size_t _maxQueuedFrames;
+	BacklogPolicy _backlogPolicy;
+	SubscriberTrie _subscriberTrie;
+	EventTrie _eventTrie;
+	SubscriberTrie::ValueVec _matchedSubscribers;
+	EventTrie::ValueVec _matchedEvents;
+	Poco::UInt64 _notificationCounter;
 	SocketMap  _socketMap;
-	Poco::Net::Socket::SocketList _socketList;
+	Poco::Net::PollSet _pollSet;
 	Poco::NotificationQueue _mainQueue;
 	Poco::NotificationQueue _workerQueue;
 	Poco::Thread _mainThread;
@@ -132,12 +230,40 @@ private:
 	friend class UnsubscribeNotification;
 	friend class NotifyNotification;
 	friend class SendNotification;
+	friend class WriteFrameNotification;
 	friend class ReceiveNotification;
 	friend class ShutdownNotification;
 	friend class WatchSocketNotification;
 };
 
 
+//
+// inlines
+//
+inline const char* WebEventServiceImpl::Frame::data() const
+{
+	return _data.data();
+}
+
+
+inline std::size_t WebEventServiceImpl::Frame::size() const
+{
+	return _data.size();
+}
+
+
+inline const char* WebEventServiceImpl::Frame::payload() const
+{
+	return _data.data() + _headerSize;
+}
+
+
+inline std::size_t WebEventServiceImpl::Frame::payloadSize() const
+{
+	return _data.size() - _headerSize;
+}
+
+
 } } } // namespace Poco::OSP::WebEvent
 
 
@@ -41,9 +41,14 @@ namespace WebEvent {
 class WebEventRequestHandlerFactory: public WebRequestHandlerFactory
 {
 public:
+	WebEventRequestHandlerFactory():
+		_compression(true)
+	{
+	}
+
 	Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest& request)
 	{
-		return new WebEventRequestHandler(_pWebEventServiceImpl, context());
+		return new WebEventRequestHandler(_pWebEventServiceImpl, context(), _compression);
 	}
 	
 protected:
@@ -54,10 +59,13 @@ protected:
 		{
 			 _pWebEventServiceImpl = pWebEventServiceRef->castedInstance<WebEventServiceImpl>();
 		}
+		Poco::OSP::PreferencesService::Ptr pPrefs = Poco::OSP::ServiceFinder::find<Poco::OSP::PreferencesService>(context());
+		_compression = pPrefs->configuration()->getBool("osp.web.event.compression", true);
 	}
 	
 private:
 	WebEventServiceImpl::Ptr _pWebEventServiceImpl;
+	bool _compression;
 };
 
 
@@ -79,7 +87,14 @@ public:
 	{
 		Poco::OSP::PreferencesService::Ptr pPrefs = Poco::OSP::ServiceFinder::find<Poco::OSP::PreferencesService>(pContext);
 		int maxWebSockets = pPrefs->configuration()->getInt("osp.web.event.maxWebSockets", 0);
-		WebEventServiceImpl::Ptr pService = new WebEventServiceImpl(pContext, maxWebSockets);
+		int maxQueuedFrames = pPrefs->configuration()->getInt("osp.web.event.maxQueuedFrames", WebEventServiceImpl::DEFAULT_MAX_QUEUED_FRAMES);
+		std::string backlogPolicy = pPrefs->configuration()->getString("osp.web.event.backlogPolicy", "disconnect");
+		WebEventServiceImpl::BacklogPolicy policy = WebEventServiceImpl::BACKLOG_DISCONNECT;
+		if (backlogPolicy == "dropOldest")
+			policy = WebEventServiceImpl::BACKLOG_DROP_OLDEST;
+		else if (backlogPolicy != "disconnect")
+			pContext->logger().warning("Invalid value for osp.web.event.backlogPolicy: " + backlogPolicy + "; using \"disconnect\".");
+		WebEventServiceImpl::Ptr pService = new WebEventServiceImpl(pContext, maxWebSockets, maxQueuedFrames, policy);
 		_pWebEventServiceRef = pContext->registry().registerService(WebEventService::SERVICE_NAME, pService, Properties());
 	}
 		
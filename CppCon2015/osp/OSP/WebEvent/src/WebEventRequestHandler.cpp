@@ -28,14 +28,16 @@ namespace OSP {
 namespace WebEvent {
 
 
-WebEventRequestHandler::WebEventRequestHandler(WebEventServiceImpl::Ptr pWebEventServiceImpl, Poco::OSP::BundleContext::Ptr pContext):
+WebEventRequestHandler::WebEventRequestHandler(WebEventServiceImpl::Ptr pWebEventServiceImpl, Poco::OSP::BundleContext::Ptr pContext, bool compression):
 	_pWebEventServiceImpl(pWebEventServiceImpl),
-	_pContext(pContext)
+	_pContext(pContext),
+	_compression(compression)
 {
 }
 
 	
-WebEventRequestHandler::WebEventRequestHandler()
+WebEventRequestHandler::WebEventRequestHandler():
+	_compression(false)
 {
 }
 
@@ -51,7 +53,11 @@ void WebEventRequestHandler::handleRequest(Poco::Net::HTTPServerRequest& request
 			_pWebEventServiceImpl->requestReceived(pRequest);
 			if (response.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
 			{
-				Poco::SharedPtr<Poco::Net::WebSocket> pWS = new Poco::Net::WebSocket(request, response);
+				Poco::SharedPtr<Poco::Net::WebSocket> pWS;
+				if (_compression)
+					pWS = new Poco::Net::WebSocket(request, response, Poco::Net::PerMessageDeflate::Params());
+				else
+					pWS = new Poco::Net::WebSocket(request, response);
 				_pContext->logger().information(Poco::format("WebSocket connection established with %s.", request.clientAddress().toString()));
 				_pWebEventServiceImpl->addSubscriber(pWS);
 			}
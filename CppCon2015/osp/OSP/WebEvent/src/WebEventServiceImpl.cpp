@@ -16,9 +16,14 @@
 
 #include "Poco/OSP/WebEvent/WebEventServiceImpl.h"
 #include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/WebSocketImpl.h"
 #include "Poco/Environment.h"
 #include "Poco/Buffer.h"
-#include <algorithm>
+#include "Poco/Error.h"
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/socket.h>
+#include <errno.h>
+#endif
 
 
 namespace Poco {
@@ -77,21 +82,21 @@ private:
 class RemoveSubscriberNotification: public TaskNotification
 {
 public:
-	RemoveSubscriberNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool clientShutdown):
+	RemoveSubscriberNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool abort):
 		TaskNotification(service),
 		_pWS(pWS),
-		_clientShutdown(clientShutdown)
+		_abort(abort)
 	{
 	}
 	
 	void execute()
 	{
-		_service.removeSubscriberImpl(_pWS, _clientShutdown);
+		_service.removeSubscriberImpl(_pWS, _abort);
 	}
 	
 private:
 	Poco::SharedPtr<Poco::Net::WebSocket> _pWS;
-	bool _clientShutdown;
+	bool _abort;
 };
 
 
@@ -161,21 +166,42 @@ private:
 class SendNotification: public TaskNotification
 {
 public:
-	SendNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::string& message):
+	SendNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, WebEventServiceImpl::Frame::Ptr pFrame):
 		TaskNotification(service),
 		_pWS(pWS),
-		_message(message)
+		_pFrame(pFrame)
 	{
 	}
 	
 	void execute()
 	{
-		_service.sendImpl(_pWS, _message);
+		_service.sendImpl(_pWS, _pFrame);
 	}
 	
 private:
 	Poco::SharedPtr<Poco::Net::WebSocket> _pWS;
-	std::string _message;
+	WebEventServiceImpl::Frame::Ptr _pFrame;
+};
+
+
+class WriteFrameNotification: public TaskNotification
+{
+public:
+	WriteFrameNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, WebEventServiceImpl::Frame::Ptr pFrame):
+		TaskNotification(service),
+		_pWS(pWS),
+		_pFrame(pFrame)
+	{
+	}
+	
+	void execute()
+	{
+		_service.writeFrameImpl(_pWS, _pFrame);
+	}
+	
+private:
+	Poco::SharedPtr<Poco::Net::WebSocket> _pWS;
+	WebEventServiceImpl::Frame::Ptr _pFrame;
 };
 
 
@@ -201,25 +227,25 @@ private:
 class ShutdownNotification: public TaskNotification
 {
 public:
-	ShutdownNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool passive):
+	ShutdownNotification(WebEventServiceImpl& service, Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool abort):
 		TaskNotification(service),
 		_pWS(pWS),
 		_statusCode(statusCode),
 		_statusMessage(statusMessage),
-		_passive(passive)
+		_abort(abort)
 	{
 	}
 	
 	void execute()
 	{
-		_service.shutdownImpl(_pWS, _statusCode, _statusMessage, _passive);
+		_service.shutdownImpl(_pWS, _statusCode, _statusMessage, _abort);
 	}
 	
 private:
 	Poco::SharedPtr<Poco::Net::WebSocket> _pWS;
 	Poco::UInt16 _statusCode;
 	std::string _statusMessage;
-	bool _passive;
+	bool _abort;
 };
 
 
@@ -242,9 +268,75 @@ private:
 };
 
 
-WebEventServiceImpl::WebEventServiceImpl(Poco::OSP::BundleContext::Ptr pContext, int maxSockets):
+namespace
+{
+	bool canSendNonBlocking(const Poco::Net::WebSocket& ws)
+	{
+#if defined(POCO_OS_FAMILY_UNIX) && defined(MSG_DONTWAIT)
+		return !ws.secure();
+#else
+		return false;
+#endif
+	}
+
+	int sendNonBlocking(const Poco::Net::WebSocket& ws, const char* buffer, std::size_t length)
+		/// Writes the given raw bytes to the socket, without blocking.
+		/// Returns the number of bytes written, which is 0 if the
+		/// socket's send buffer is full, or -1 if an error occured.
+	{
+#if defined(POCO_OS_FAMILY_UNIX) && defined(MSG_DONTWAIT)
+		int flags = MSG_DONTWAIT;
+#if defined(MSG_NOSIGNAL)
+		flags |= MSG_NOSIGNAL;
+#endif
+		while (true)
+		{
+			ssize_t rc = ::send(ws.impl()->sockfd(), buffer, length, flags);
+			if (rc >= 0) return static_cast<int>(rc);
+			if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+			if (errno != EINTR) return -1;
+		}
+#else
+		return -1;
+#endif
+	}
+}
+
+
+WebEventServiceImpl::Frame::Frame(const std::string& payload)
+{
+	Poco::UInt64 length = payload.size();
+	_data.reserve(payload.size() + 10);
+	_data += static_cast<char>(Poco::Net::WebSocket::FRAME_TEXT);
+	if (length < 126)
+	{
+		_data += static_cast<char>(length);
+	}
+	else if (length < 65536)
+	{
+		_data += static_cast<char>(126);
+		_data += static_cast<char>((length >> 8) & 0xFF);
+		_data += static_cast<char>(length & 0xFF);
+	}
+	else
+	{
+		_data += static_cast<char>(127);
+		for (int i = 7; i >= 0; i--)
+		{
+			_data += static_cast<char>((length >> 8*i) & 0xFF);
+		}
+	}
+	_headerSize = _data.size();
+	_data += payload;
+}
+
+
+WebEventServiceImpl::WebEventServiceImpl(Poco::OSP::BundleContext::Ptr pContext, int maxSockets, int maxQueuedFrames, BacklogPolicy backlogPolicy):
 	_pContext(pContext),
 	_maxSockets(maxSockets),
+	_maxQueuedFrames(maxQueuedFrames > 0 ? maxQueuedFrames : 1),
+	_backlogPolicy(backlogPolicy),
+	_notificationCounter(0),
 	_mainRunnable(*this, &WebEventServiceImpl::runMain),
 	_workerRunnable(*this, &WebEventServiceImpl::runWorker),
 	_stopped(false)
@@ -282,15 +374,16 @@ WebEventServiceImpl::~WebEventServiceImpl()
 
 Poco::BasicEvent<const WebEventService::NotificationEvent>& WebEventServiceImpl::subjectNotified(const std::string& subject)
 {
-	EventMap::iterator it = _eventMap.find(subject);
-	if (it != _eventMap.end())
+	const EventTrie::ValueVec* pEvents = _eventTrie.find(subject);
+	if (pEvents)
 	{
-		return *it->second;
+		EventPtr pEvent = pEvents->front();
+		return *pEvent;
 	}
 	else
 	{
 		EventPtr pEvent = new Event;
-		_eventMap.insert(EventMap::value_type(subject, pEvent));
+		_eventTrie.insert(subject, pEvent);
 		return *pEvent;
 	}
 }
@@ -321,34 +414,39 @@ void WebEventServiceImpl::runMain()
 	{
 		try
 		{
-			Poco::Net::Socket::SocketList readList(_socketList);
-			Poco::Net::Socket::SocketList writeList;
-			Poco::Net::Socket::SocketList exceptList(_socketList);
-		
 			Poco::Timespan timeout(5000);
-			int n = Poco::Net::Socket::select(readList, writeList, exceptList, timeout);
-			if (n > 0)
+			Poco::Net::PollSet::SocketModeMap ready = _pollSet.poll(timeout);
+			for (Poco::Net::PollSet::SocketModeMap::iterator it = ready.begin(); it != ready.end(); ++it)
 			{
-				for (Poco::Net::Socket::SocketList::iterator it = readList.begin(); it != readList.end(); ++it)
+				SocketMap::iterator its = _socketMap.find(it->first);
+				if (its == _socketMap.end()) 
 				{
-					SocketMap::iterator its = _socketMap.find(*it);
-					if (its != _socketMap.end())
-					{
-						receive(its->second->pWebSocket);
-						unwatchSocketImpl(*it);
-					}
+					_pollSet.remove(it->first);
+					continue;
+				}
+				Subscriber::Ptr pSubscriber = its->second;
+				if (it->second & Poco::Net::PollSet::POLL_ERROR)
+				{
+					removeSubscriberImpl(pSubscriber->pWebSocket, true);
+					continue;
+				}
+				if ((it->second & Poco::Net::PollSet::POLL_READ) && pSubscriber->watchRead)
+				{
+					receive(pSubscriber->pWebSocket);
+					pSubscriber->watchRead = false;
 				}
-				for (Poco::Net::Socket::SocketList::iterator it = exceptList.begin(); it != exceptList.end(); ++it)
+				if (it->second & Poco::Net::PollSet::POLL_WRITE)
 				{
-					SocketMap::iterator its = _socketMap.find(*it);
-					if (its != _socketMap.end())
+					if (!flushImpl(*pSubscriber))
 					{
-						removeSubscriberImpl(its->second->pWebSocket, false);
+						removeSubscriberImpl(pSubscriber->pWebSocket, true);
+						continue;
 					}
 				}
+				updateWatchImpl(*pSubscriber);
 			}
 		
-			Poco::Notification::Ptr pNf = _socketList.empty() ? _mainQueue.waitDequeueNotification() : _mainQueue.dequeueNotification();
+			Poco::Notification::Ptr pNf = _pollSet.empty() ? _mainQueue.waitDequeueNotification() : _mainQueue.dequeueNotification();
 			while (pNf)
 			{
 				TaskNotification::Ptr pTaskNf = pNf.cast<TaskNotification>();
@@ -356,7 +454,7 @@ void WebEventServiceImpl::runMain()
 				{
 					pTaskNf->execute();
 				}
-				pNf = _socketList.empty() ? _mainQueue.waitDequeueNotification() : _mainQueue.dequeueNotification();
+				pNf = _pollSet.empty() ? _mainQueue.waitDequeueNotification() : _mainQueue.dequeueNotification();
 			}
 		}
 		catch (Poco::Exception& exc)
@@ -397,9 +495,9 @@ void WebEventServiceImpl::addSubscriber(Poco::SharedPtr<Poco::Net::WebSocket> pW
 }
 
 
-void WebEventServiceImpl::removeSubscriber(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool clientShutdown)
+void WebEventServiceImpl::removeSubscriber(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool abort)
 {
-	_mainQueue.enqueueNotification(new RemoveSubscriberNotification(*this, pWS, clientShutdown));
+	_mainQueue.enqueueNotification(new RemoveSubscriberNotification(*this, pWS, abort));
 }
 
 
@@ -417,7 +515,13 @@ void WebEventServiceImpl::unsubscribe(Poco::SharedPtr<Poco::Net::WebSocket> pWS,
 
 void WebEventServiceImpl::send(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::string& message)
 {
-	_workerQueue.enqueueNotification(new SendNotification(*this, pWS, message));
+	_mainQueue.enqueueNotification(new SendNotification(*this, pWS, new Frame(message)));
+}
+
+
+void WebEventServiceImpl::writeFrame(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Frame::Ptr pFrame)
+{
+	_workerQueue.enqueueNotification(new WriteFrameNotification(*this, pWS, pFrame));
 }
 
 
@@ -427,9 +531,9 @@ void WebEventServiceImpl::receive(Poco::SharedPtr<Poco::Net::WebSocket> pWS)
 }
 
 
-void WebEventServiceImpl::shutdown(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool passive)
+void WebEventServiceImpl::shutdown(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool abort)
 {
-	_workerQueue.enqueueNotification(new ShutdownNotification(*this, pWS, statusCode, statusMessage, passive));
+	_workerQueue.enqueueNotification(new ShutdownNotification(*this, pWS, statusCode, statusMessage, abort));
 }
 
 
@@ -445,30 +549,44 @@ void WebEventServiceImpl::notifyImpl(const std::string& subjectName, const std::
 	message += VERSION;
 	message += "\r\n";
 	message += data;
-
-	std::string s(subjectName);
-	std::string::size_type pos = std::string::npos;
-	do
-	{
-		SubjectMap::const_iterator it = _subjectMap.find(s);
-		while (it != _subjectMap.end() && it->first == s)
-		{
-			send(it->second->pWebSocket, message);
-			++it;
-		}
-		EventMap::iterator itEv = _eventMap.find(s);
-		while (itEv != _eventMap.end() && itEv->first == s)
-		{
-			(*itEv->second)(ev);
-			++itEv;
-		}
-		pos = s.find_last_of('.');
-		if (pos != std::string::npos)
+	Frame::Ptr pFrame = new Frame(message);
+
+	// The matches are collected in member vectors, which are reused,
+	// so that no memory needs to be allocated in the common case.
+	// Events are fired after matching, as a delegate may register
+	// additional events with subjectNotified(). The vectors are
+	// cleared first, in case a delegate threw during the last call.
+	_matchedSubscribers.clear();
+	_matchedEvents.clear();
+	_subscriberTrie.match(subjectName, _matchedSubscribers);
+	_eventTrie.match(subjectName, _matchedEvents);
+
+	Poco::UInt64 notification = ++_notificationCounter;
+	std::vector<Subscriber::Ptr> slowSubscribers;
+	for (SubscriberTrie::ValueVec::iterator it = _matchedSubscribers.begin(); it != _matchedSubscribers.end(); ++it)
+	{
+		Subscriber& subscriber = **it;
+		if (subscriber.lastNotification != notification)
 		{
-			s.resize(pos);
+			subscriber.lastNotification = notification;
+			if (!queueFrameImpl(subscriber, pFrame))
+			{
+				slowSubscribers.push_back(*it);
+			}
 		}
 	}
-	while (pos != std::string::npos);
+	_matchedSubscribers.clear();
+
+	for (EventTrie::ValueVec::iterator it = _matchedEvents.begin(); it != _matchedEvents.end(); ++it)
+	{
+		(**it)(ev);
+	}
+	_matchedEvents.clear();
+	
+	for (std::vector<Subscriber::Ptr>::iterator it = slowSubscribers.begin(); it != slowSubscribers.end(); ++it)
+	{
+		removeSubscriberImpl((*it)->pWebSocket, true);
+	}
 }
 
 
@@ -476,6 +594,9 @@ void WebEventServiceImpl::addSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket
 {
 	Subscriber::Ptr pSubscriber = new Subscriber;
 	pSubscriber->pWebSocket = pWS;
+	// Pre-encoded frames are never compressed, so they cannot be
+	// sent to a subscriber using the permessage-deflate extension.
+	pSubscriber->nonBlockingSend = canSendNonBlocking(*pWS) && !static_cast<Poco::Net::WebSocketImpl*>(pWS->impl())->compressed();
 	_socketMap[*pWS] = pSubscriber;
 	watchSocketImpl(*pWS);
 	pWS->setSendTimeout(Poco::Timespan(WEBEVENT_SEND_TIMEOUT, 0));
@@ -483,17 +604,21 @@ void WebEventServiceImpl::addSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket
 }
 
 
-void WebEventServiceImpl::removeSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool clientShutdown)
+void WebEventServiceImpl::removeSubscriberImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, bool abort)
 {
 	SocketMap::iterator it = _socketMap.find(*pWS);
 	if (it != _socketMap.end())
 	{
+		// A Close frame cannot be sent after a partially sent frame.
+		if (it->second->outOffset > 0) abort = true;
 		unsubscribeImpl(pWS, it->second->subjectNames);
+		it->second->outQueue.clear();
+		it->second->outOffset = 0;
 		_socketMap.erase(it);
-		unwatchSocketImpl(*pWS);
+		_pollSet.remove(*pWS);
 		try
 		{
-			shutdown(pWS, Poco::Net::WebSocket::WS_NORMAL_CLOSE, "", clientShutdown);
+			shutdown(pWS, Poco::Net::WebSocket::WS_NORMAL_CLOSE, "", abort);
 		}
 		catch (Poco::Exception& exc)
 		{
@@ -513,7 +638,7 @@ void WebEventServiceImpl::subscribeImpl(Poco::SharedPtr<Poco::Net::WebSocket> pW
 			if (it->second->subjectNames.find(*itSub) == it->second->subjectNames.end())
 			{
 				it->second->subjectNames.insert(*itSub);
-				_subjectMap.insert(SubjectMap::value_type(*itSub, it->second));
+				_subscriberTrie.insert(*itSub, it->second);
 			}
 		}
 	}
@@ -540,32 +665,37 @@ void WebEventServiceImpl::unsubscribeImpl(Poco::SharedPtr<Poco::Net::WebSocket>
 			if (itFound != it->second->subjectNames.end())
 			{
 				it->second->subjectNames.erase(itFound);
-				SubjectMap::iterator itSM = _subjectMap.find(*itSub);
-				while (itSM != _subjectMap.end() && itSM->first == *itSub)
-				{
-					if (itSM->second == it->second)
-					{
-						_subjectMap.erase(itSM);
-						break;
-					}
-					++itSM;
-				}
+				_subscriberTrie.remove(*itSub, it->second);
 			}
 		}
 	}
 }
 
 
-void WebEventServiceImpl::sendImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, const std::string& message)
+void WebEventServiceImpl::sendImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Frame::Ptr pFrame)
+{
+	SocketMap::iterator it = _socketMap.find(*pWS);
+	if (it != _socketMap.end())
+	{
+		Subscriber::Ptr pSubscriber = it->second;
+		if (!queueFrameImpl(*pSubscriber, pFrame))
+		{
+			removeSubscriberImpl(pWS, true);
+		}
+	}
+}
+
+
+void WebEventServiceImpl::writeFrameImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Frame::Ptr pFrame)
 {
 	try
 	{
-		pWS->sendFrame(message.data(), message.size());
+		pWS->sendFrame(pFrame->payload(), static_cast<int>(pFrame->payloadSize()));
 	}
 	catch (Poco::Exception& exc)
 	{
 		_pContext->logger().error("Error while sending frame: " + exc.displayText());
-		removeSubscriber(pWS, false);
+		removeSubscriber(pWS, true);
 	}
 }
 
@@ -588,7 +718,9 @@ void WebEventServiceImpl::receiveImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS)
 		
 		if ((flags & Poco::Net::WebSocket::FRAME_OP_CLOSE) || n == 0)
 		{
-			removeSubscriber(pWS, true);
+			// Confirm the client's Close frame. If the client has 
+			// closed the connection, there is nothing to confirm.
+			removeSubscriber(pWS, n == 0 && (flags & Poco::Net::WebSocket::FRAME_OP_CLOSE) == 0);
 			return;
 		}
 		
@@ -662,50 +794,124 @@ void WebEventServiceImpl::receiveImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS)
 }
 
 
-void WebEventServiceImpl::shutdownImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool passive)
+void WebEventServiceImpl::shutdownImpl(Poco::SharedPtr<Poco::Net::WebSocket> pWS, Poco::UInt16 statusCode, const std::string& statusMessage, bool abort)
 {
-	//_pContext->logger().notice("Shutting down WebSocket.");
-	try
+	// The socket is closed right after sending the Close frame, without
+	// waiting for the client to confirm the shutdown, as this would block
+	// the worker thread.
+	if (!abort)
 	{
-		pWS->shutdown(statusCode, statusMessage);
+		try
+		{
+			pWS->shutdown(statusCode, statusMessage);
+		}
+		catch (Poco::Exception& exc)
+		{
+			_pContext->logger().notice("Error while shutting down WebSocket: " + exc.displayText());
+		}
 	}
-	catch (Poco::Exception& exc)
+	try
 	{
-		_pContext->logger().notice("Error while shutting down WebSocket: " + exc.displayText());
-		passive = true; // don't wait for client confirmation
+		pWS->close();
 	}
-	if (!passive)
+	catch (Poco::Exception& exc)
 	{
-		if (pWS->poll(Poco::Timespan(WEBEVENT_SHUTDOWN_TIMEOUT, 0), Poco::Net::Socket::SELECT_READ))
-		{
-			Poco::Buffer<char> buffer(4096);
-			int flags;
-			pWS->receiveFrame(buffer.begin(), buffer.size(), flags);
-			if (flags & Poco::Net::WebSocket::FRAME_OP_CLOSE)
-			{
-				pWS->close();
-				return;
-			}
-		}
-		_pContext->logger().notice("Client failed to confirm shutdown.");
+		_pContext->logger().notice("Error while closing WebSocket: " + exc.displayText());
 	}
-	pWS->close();
 }
 
 
 void WebEventServiceImpl::watchSocketImpl(const Poco::Net::Socket& socket)
 {
-	_socketList.push_back(socket);
+	SocketMap::iterator it = _socketMap.find(socket);
+	if (it != _socketMap.end())
+	{
+		it->second->watchRead = true;
+		updateWatchImpl(*it->second);
+	}
 }
 
 
 void WebEventServiceImpl::unwatchSocketImpl(const Poco::Net::Socket& socket)
 {
-	Poco::Net::Socket::SocketList::iterator itd = std::find(_socketList.begin(), _socketList.end(), socket);
-	if (itd != _socketList.end()) 
+	SocketMap::iterator it = _socketMap.find(socket);
+	if (it != _socketMap.end())
+	{
+		it->second->watchRead = false;
+		updateWatchImpl(*it->second);
+	}
+}
+
+
+bool WebEventServiceImpl::queueFrameImpl(Subscriber& subscriber, Frame::Ptr pFrame)
+{
+	if (!subscriber.nonBlockingSend)
+	{
+		writeFrame(subscriber.pWebSocket, pFrame);
+		return true;
+	}
+
+	if (subscriber.outQueue.size() >= _maxQueuedFrames)
+	{
+		if (_backlogPolicy == BACKLOG_DISCONNECT) 
+		{
+			_pContext->logger().notice("Subscriber cannot keep up with notifications. Closing WebSocket.");
+			return false;
+		}
+		
+		// Drop the oldest frame, unless it has already been partially sent.
+		std::deque<Frame::Ptr>::iterator itDrop = subscriber.outQueue.begin();
+		if (subscriber.outOffset > 0) ++itDrop;
+		if (itDrop == subscriber.outQueue.end()) return true;
+		subscriber.outQueue.erase(itDrop);
+	}
+	subscriber.outQueue.push_back(pFrame);
+	if (subscriber.outQueue.size() == 1)
+	{
+		// Try to send the frame immediately. Only if the socket's send 
+		// buffer is full, the socket is watched for becoming writable.
+		if (!flushImpl(subscriber)) return false;
+		if (!subscriber.outQueue.empty()) updateWatchImpl(subscriber);
+	}
+	return true;
+}
+
+
+bool WebEventServiceImpl::flushImpl(Subscriber& subscriber)
+{
+	while (!subscriber.outQueue.empty())
 	{
-		_socketList.erase(itd);
+		const Frame& frame = *subscriber.outQueue.front();
+		int n = sendNonBlocking(*subscriber.pWebSocket, frame.data() + subscriber.outOffset, frame.size() - subscriber.outOffset);
+		if (n < 0)
+		{
+			_pContext->logger().error("Error while sending frame: " + Poco::Error::getMessage(errno));
+			return false;
+		}
+		else if (n == 0) 
+		{
+			break;
+		}
+		subscriber.outOffset += n;
+		if (subscriber.outOffset == frame.size())
+		{
+			subscriber.outQueue.pop_front();
+			subscriber.outOffset = 0;
+		}
 	}
+	return true;
+}
+
+
+void WebEventServiceImpl::updateWatchImpl(const Subscriber& subscriber)
+{
+	int mode = 0;
+	if (subscriber.watchRead) mode |= Poco::Net::PollSet::POLL_READ | Poco::Net::PollSet::POLL_ERROR;
+	if (!subscriber.outQueue.empty()) mode |= Poco::Net::PollSet::POLL_WRITE | Poco::Net::PollSet::POLL_ERROR;
+	if (mode)
+		_pollSet.add(*subscriber.pWebSocket, mode);
+	else
+		_pollSet.remove(*subscriber.pWebSocket);
 }
 
 
@@ -0,0 +1,19 @@
+//
+// Driver.cpp
+//
+// $Id: //poco/1.6/OSP/WebEvent/testsuite/src/Driver.cpp#1 $
+//
+// Console-based test driver for Poco OSP WebEvent.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "CppUnit/TestRunner.h"
+#include "WebEventTestSuite.h"
+
+
+CppUnitMain(WebEventTestSuite)
@@ -0,0 +1,275 @@
+//
+// SubjectTrieTest.cpp
+//
+// $Id: //poco/1.6/OSP/WebEvent/testsuite/src/SubjectTrieTest.cpp#1 $
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "SubjectTrieTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/OSP/WebEvent/SubjectTrie.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Stopwatch.h"
+#include <algorithm>
+#include <iostream>
+
+
+using Poco::OSP::WebEvent::SubjectTrie;
+using Poco::NumberFormatter;
+using Poco::Stopwatch;
+
+
+namespace
+{
+	typedef SubjectTrie<int> IntTrie;
+
+	IntTrie::ValueVec match(const IntTrie& trie, const std::string& subject)
+	{
+		IntTrie::ValueVec matches;
+		trie.match(subject, matches);
+		std::sort(matches.begin(), matches.end());
+		return matches;
+	}
+}
+
+
+SubjectTrieTest::SubjectTrieTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+SubjectTrieTest::~SubjectTrieTest()
+{
+}
+
+
+void SubjectTrieTest::testInsertFind()
+{
+	IntTrie trie;
+	assert (trie.empty());
+	assert (trie.find("com.appinf") == 0);
+
+	trie.insert("com.appinf", 1);
+	trie.insert("com.appinf", 2);
+	trie.insert("com.appinf.events", 3);
+	assert (!trie.empty());
+
+	const IntTrie::ValueVec* pValues = trie.find("com.appinf");
+	assert (pValues != 0);
+	assert (pValues->size() == 2);
+	assert ((*pValues)[0] == 1);
+	assert ((*pValues)[1] == 2);
+
+	pValues = trie.find("com.appinf.events");
+	assert (pValues != 0);
+	assert (pValues->size() == 1);
+	assert ((*pValues)[0] == 3);
+
+	assert (trie.find("com") == 0);
+	assert (trie.find("com.appinf.events.x") == 0);
+	assert (trie.find("com.appin") == 0);
+
+	trie.clear();
+	assert (trie.empty());
+	assert (trie.find("com.appinf") == 0);
+}
+
+
+void SubjectTrieTest::testHierarchical()
+{
+	IntTrie trie;
+	trie.insert("com", 1);
+	trie.insert("com.appinf", 2);
+	trie.insert("com.appinf.events", 3);
+	trie.insert("com.other", 4);
+	trie.insert("", 5);
+
+	IntTrie::ValueVec m = match(trie, "com.appinf.events.someEvent");
+	assert (m.size() == 3);
+	assert (m[0] == 1 && m[1] == 2 && m[2] == 3);
+
+	m = match(trie, "com.appinf");
+	assert (m.size() == 2);
+	assert (m[0] == 1 && m[1] == 2);
+
+	m = match(trie, "com.appinfo");
+	assert (m.size() == 1);
+	assert (m[0] == 1);
+
+	m = match(trie, "org.appinf");
+	assert (m.empty());
+
+	m = match(trie, "");
+	assert (m.size() == 1);
+	assert (m[0] == 5);
+}
+
+
+void SubjectTrieTest::testAnySegment()
+{
+	IntTrie trie;
+	trie.insert("com.*.events", 1);
+	trie.insert("*", 2);
+	trie.insert("com.appinf.*.x", 3);
+
+	IntTrie::ValueVec m = match(trie, "com.appinf.events");
+	assert (m.size() == 2);
+	assert (m[0] == 1 && m[1] == 2);
+
+	m = match(trie, "com.other.events.someEvent");
+	assert (m.size() == 2);
+	assert (m[0] == 1 && m[1] == 2);
+
+	m = match(trie, "com.events");
+	assert (m.size() == 1);
+	assert (m[0] == 2);
+
+	m = match(trie, "com.appinf.foo.x.y");
+	assert (m.size() == 2);
+	assert (m[0] == 2 && m[1] == 3);
+
+	m = match(trie, "com.appinf.foo.y");
+	assert (m.size() == 1);
+	assert (m[0] == 2);
+}
+
+
+void SubjectTrieTest::testAnyChildren()
+{
+	IntTrie trie;
+	trie.insert("com.appinf.#", 1);
+	trie.insert("#", 2);
+	trie.insert("com.#.events", 3);
+
+	IntTrie::ValueVec m = match(trie, "com.appinf");
+	assert (m.size() == 2);
+	assert (m[0] == 1 && m[1] == 2);
+
+	m = match(trie, "com.appinf.events.someEvent");
+	assert (m.size() == 2);
+	assert (m[0] == 1 && m[1] == 2);
+
+	m = match(trie, "com");
+	assert (m.size() == 1);
+	assert (m[0] == 2);
+
+	// "#" is only a wildcard if it is the last segment
+	m = match(trie, "com.other.events");
+	assert (m.size() == 1);
+	assert (m[0] == 2);
+
+	m = match(trie, "com.#.events");
+	assert (m.size() == 2);
+	assert (m[0] == 2 && m[1] == 3);
+}
+
+
+void SubjectTrieTest::testRemove()
+{
+	IntTrie trie;
+	trie.insert("com.appinf", 1);
+	trie.insert("com.appinf", 2);
+	trie.insert("com.appinf.events", 3);
+	trie.insert("com.*.events", 4);
+	trie.insert("com.#", 5);
+
+	assert (!trie.remove("com.appinf", 3));
+	assert (!trie.remove("com.appinf.other", 1));
+	assert (!trie.remove("com.appinf.*", 4));
+
+	assert (trie.remove("com.appinf", 1));
+	IntTrie::ValueVec m = match(trie, "com.appinf.events");
+	assert (m.size() == 4);
+	assert (m[0] == 2 && m[1] == 3 && m[2] == 4 && m[3] == 5);
+
+	assert (trie.remove("com.*.events", 4));
+	assert (!trie.remove("com.*.events", 4));
+	assert (trie.remove("com.#", 5));
+	m = match(trie, "com.appinf.events");
+	assert (m.size() == 2);
+	assert (m[0] == 2 && m[1] == 3);
+
+	assert (trie.remove("com.appinf.events", 3));
+	assert (trie.find("com.appinf.events") == 0);
+	assert (trie.remove("com.appinf", 2));
+	assert (trie.empty());
+}
+
+
+void SubjectTrieTest::testPerformance()
+{
+	benchmark(1000, 1000000);
+	benchmark(10000, 1000000);
+	benchmark(100000, 1000000);
+}
+
+
+void SubjectTrieTest::benchmark(int subscriptions, int notifications)
+{
+	// Every subject has 10 subscribers, half of them subscribed
+	// to the subject itself, and half of them to its parent.
+	int subjects = subscriptions/10;
+	IntTrie trie;
+	for (int i = 0; i < subscriptions; i++)
+	{
+		std::string subject("com.appinf.device");
+		subject += NumberFormatter::format(i % subjects);
+		if (i % 2 == 0) subject += ".temperature";
+		trie.insert(subject, i);
+	}
+
+	std::vector<std::string> notifySubjects;
+	for (int i = 0; i < subjects; i++)
+	{
+		std::string subject("com.appinf.device");
+		subject += NumberFormatter::format(i);
+		subject += ".temperature.changed";
+		notifySubjects.push_back(subject);
+	}
+
+	IntTrie::ValueVec matches;
+	std::size_t total = 0;
+	Stopwatch sw;
+	sw.start();
+	for (int i = 0; i < notifications; i++)
+	{
+		total += trie.match(notifySubjects[i % subjects], matches);
+		matches.clear();
+	}
+	sw.stop();
+	assert (total == 10*static_cast<std::size_t>(notifications));
+
+	double rate = notifications*1000000.0/(sw.elapsed() > 0 ? sw.elapsed() : 1);
+	std::cout << subscriptions << " subscriptions: " << static_cast<Poco::UInt64>(rate) << " notifies/sec" << std::endl;
+}
+
+
+void SubjectTrieTest::setUp()
+{
+}
+
+
+void SubjectTrieTest::tearDown()
+{
+}
+
+
+CppUnit::Test* SubjectTrieTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SubjectTrieTest");
+
+	CppUnit_addTest(pSuite, SubjectTrieTest, testInsertFind);
+	CppUnit_addTest(pSuite, SubjectTrieTest, testHierarchical);
+	CppUnit_addTest(pSuite, SubjectTrieTest, testAnySegment);
+	CppUnit_addTest(pSuite, SubjectTrieTest, testAnyChildren);
+	CppUnit_addTest(pSuite, SubjectTrieTest, testRemove);
+	//CppUnit_addTest(pSuite, SubjectTrieTest, testPerformance);
+
+	return pSuite;
+}
@@ -0,0 +1,46 @@
+//
+// SubjectTrieTest.h
+//
+// $Id: //poco/1.6/OSP/WebEvent/testsuite/src/SubjectTrieTest.h#1 $
+//
+// Definition of the SubjectTrieTest class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef SubjectTrieTest_INCLUDED
+#define SubjectTrieTest_INCLUDED
+
+
+#include "Poco/OSP/WebEvent/WebEvent.h"
+#include "CppUnit/TestCase.h"
+
+
+class SubjectTrieTest: public CppUnit::TestCase
+{
+public:
+	SubjectTrieTest(const std::string& name);
+	~SubjectTrieTest();
+
+	void testInsertFind();
+	void testHierarchical();
+	void testAnySegment();
+	void testAnyChildren();
+	void testRemove();
+	void testPerformance();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+	void benchmark(int subscriptions, int notifications);
+};
+
+
+#endif // SubjectTrieTest_INCLUDED
@@ -0,0 +1,24 @@
+//
+// WebEventTestSuite.cpp
+//
+// $Id: //poco/1.6/OSP/WebEvent/testsuite/src/WebEventTestSuite.cpp#1 $
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "WebEventTestSuite.h"
+#include "SubjectTrieTest.h"
+
+
+CppUnit::Test* WebEventTestSuite::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WebEventTestSuite");
+
+	pSuite->addTest(SubjectTrieTest::suite());
+
+	return pSuite;
+}
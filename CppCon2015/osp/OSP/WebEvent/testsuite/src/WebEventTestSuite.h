@@ -0,0 +1,29 @@
+//
+// WebEventTestSuite.h
+//
+// $Id: //poco/1.6/OSP/WebEvent/testsuite/src/WebEventTestSuite.h#1 $
+//
+// Definition of the WebEventTestSuite class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef WebEventTestSuite_INCLUDED
+#define WebEventTestSuite_INCLUDED
+
+
+#include "CppUnit/TestSuite.h"
+
+
+class WebEventTestSuite
+{
+public:
+	static CppUnit::Test* suite();
+};
+
+
+#endif // WebEventTestSuite_INCLUDED
@@ -0,0 +1,30 @@
+//
+// WinDriver.cpp
+//
+// $Id: //poco/1.6/OSP/WebEvent/testsuite/src/WinDriver.cpp#1 $
+//
+// Windows test driver for Poco OSP WebEvent.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "WinTestRunner/WinTestRunner.h"
+#include "WebEventTestSuite.h"
+
+
+class TestDriver: public CppUnit::WinTestRunnerApp
+{
+	void TestMain()
+	{
+		CppUnit::WinTestRunner runner;
+		runner.addTest(WebEventTestSuite::suite());
+		runner.run();
+	}
+};
+
+
+TestDriver theDriver;
@@ -305,6 +305,24 @@ protected:
 		/// The resources and properties of the extension bundle
 		/// will no longer be available to the extended bundle.
 
+	void beginStart();
+		/// Puts the bundle into BUNDLE_STARTING state and fires the
+		/// bundleStarting event. Used by the BundleLoader to start 
+		/// the bundle's activator from another thread. 
+		///
+		/// Throws a BundleStateException if the bundle is not
+		/// in BUNDLE_RESOLVED state. If a bundleStarting delegate
+		/// throws, the bundle stays in BUNDLE_RESOLVED state.
+
+	void endStart(const Poco::Exception* pException);
+		/// Completes a start initiated with beginStart() by putting 
+		/// the bundle into BUNDLE_ACTIVE state and firing the 
+		/// bundleStarted event.
+		///
+		/// If pException is not null, starting the activator has failed.
+		/// In this case, the bundle is put back into BUNDLE_RESOLVED 
+		/// state and the exception is rethrown.
+
 	Bundle(int id, BundleLoader& loader, BundleStorage::Ptr pStorage, const LanguageTag& language);
 		/// Creates the Bundle and reads the manifest
 		/// using the given BundleStorage object.
@@ -44,6 +44,7 @@ public:
 	void list(const std::string& path, std::vector<std::string>& files) const;	
 	Poco::Timestamp lastModified(const std::string& path) const;	
 	std::string path() const;
+	bool extent(const std::string& path, std::string& filePath, Poco::UInt64& offset, Poco::UInt64& length) const;
 
 protected:
 	Poco::Path buildPath(const std::string& path) const;
@@ -49,6 +49,8 @@ public:
 	void list(const std::string& path, std::vector<std::string>& files) const;		
 	Poco::Timestamp lastModified(const std::string& path) const;	
 	std::string path() const;
+	std::string digest(const std::string& path) const;
+	bool extent(const std::string& path, std::string& filePath, Poco::UInt64& offset, Poco::UInt64& length) const;
 
 protected:
 	bool isSubdirectoryOf(const std::string& dir, const std::string& parent) const;
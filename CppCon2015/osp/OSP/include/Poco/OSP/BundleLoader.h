@@ -34,6 +34,7 @@
 #include "Poco/SharedPtr.h"
 #include "Poco/Mutex.h"
 #include "Poco/Logger.h"
+#include "Poco/Timespan.h"
 #if defined(POCO_OSP_STATIC)
 #include "Poco/Instantiator.h"
 #endif
@@ -77,6 +78,13 @@ public:
 		Poco::Exception* pException;
 	};
 	
+	struct BundleStartTime
+	{
+		std::string symbolicName; /// symbolic name of the bundle
+		Poco::Timespan duration;  /// time spent in BundleActivator::start()
+	};
+	typedef std::vector<BundleStartTime> BundleStartTimeVec;
+	
 	Poco::BasicEvent<const BundleError> bundleError;
 		/// Fired when an error occurs while resolving
 		/// or starting a bundle.
@@ -151,6 +159,52 @@ public:
 		/// If a bundle cannot be started, an error will be
 		/// logged, and the loader will continue to load
 		/// other bundles.
+		///
+		/// If more than one start thread has been set with
+		/// setStartThreads(), the activators of bundles that
+		/// do not depend on each other are started concurrently.
+		/// See setStartThreads() for details.
+		///
+		/// The time spent in the activator of each bundle
+		/// can be obtained with bundleStartTimes().
+
+	void setStartThreads(int threads);
+		/// Sets the maximum number of threads used by
+		/// startAllBundles() to start bundle activators.
+		/// The default is 1, which starts all bundles
+		/// one after another.
+		///
+		/// With more than one thread, the required bundles
+		/// (Require-Bundle) form a dependency graph, and a bundle's
+		/// activator is started as soon as all bundles it requires
+		/// are active, possibly concurrently with the activators 
+		/// of other bundles of the same run level. Run levels are
+		/// still started one after another: no activator of a
+		/// bundle is started before all bundles of lower run levels 
+		/// have been started. A required bundle is started with the 
+		/// run level of the bundle requiring it, as in a sequential 
+		/// start.
+		///
+		/// startAllBundles() fires the BundleEvents for all bundles 
+		/// from the calling thread, in a deterministic order. 
+		/// bundleStarting is fired before the bundle's activator 
+		/// is started, and bundleStarted is fired for all bundles in
+		/// the same order as a sequential start would. However, 
+		/// bundleStarting may be fired for several bundles before 
+		/// bundleStarted is fired for the first of them.
+		///
+		/// Activators of bundles started concurrently must not
+		/// depend on each other without declaring the dependency
+		/// in their manifests.
+
+	int getStartThreads() const;
+		/// Returns the maximum number of threads used by 
+		/// startAllBundles().
+		
+	void bundleStartTimes(BundleStartTimeVec& startTimes) const;
+		/// Fills startTimes with the time spent in BundleActivator::start()
+		/// for every bundle started by the last call to startAllBundles(), 
+		/// in the order the bundles have been started.
 	
 	void stopAllBundles();
 		/// Stops all bundles.
@@ -227,6 +281,23 @@ protected:
 	void startDependencies(Bundle* pBundle);
 		/// Starts all bundles that the given
 		/// bundle requires to run.
+
+	void startBundles(const std::vector<Bundle::Ptr>& bundles);
+		/// Concurrently starts the given bundles (see setStartThreads()),
+		/// and all bundles they require.
+
+	void startActivator(Bundle* pBundle);
+		/// Loads and starts the activator of the given bundle,
+		/// without starting any required bundles. Used by
+		/// startBundles().
+
+	void addStartTime(Bundle* pBundle, const Poco::Timespan& duration);
+		/// Records the time spent in the activator of the given bundle,
+		/// if startAllBundles() is in progress.
+
+	void logStartTimes(const Poco::Timespan& totalTime) const;
+		/// Writes a startup timing report for the recorded 
+		/// start times to the logger.
 		
 	BundleActivator* loadActivator(BundleInfo& bundleInfo);
 		/// Loads the activator for the given bundle,
@@ -238,6 +309,14 @@ protected:
 	void installLibraries(Bundle* pBundle);
 		/// Copies all shared libraries in the bundle
 		/// (for the current platform) to the code cache.
+		///
+		/// Libraries already in the code cache are only
+		/// replaced if automatic code cache updates are enabled,
+		/// and the library in the bundle is newer, based on
+		/// its modification timestamp. If the digests (see 
+		/// BundleStorage::digest()) of the newer library and the
+		/// cached library match, only the timestamp of the cached
+		/// library is updated.
 		
 	void uninstallLibraries(Bundle* pBundle);
 		/// Removes all shared libraries belonging
@@ -248,6 +327,10 @@ protected:
 		/// If timestamp is provided, the file creation
 		/// date is modified to the given time.
 
+	void updateLibraryTimestamp(const Poco::Path& p, const Poco::Timestamp& ts);
+		/// Sets the modification date of the cached copy
+		/// of the given library to the given time.
+
 	const std::string& libraryNameFor(Bundle* pBundle);
 		/// Returns the library name for the library
 		/// containing the activator for the given bundle.
@@ -290,6 +373,9 @@ private:
 	BundleMap                 _bundles;
 	BundleIdMap               _bundleIds;
 	BundleSet                 _resolvingBundles;
+	BundleStartTimeVec        _startTimes;
+	bool                      _recordStartTimes;
+	int                       _startThreads;
 	Poco::Logger&             _logger;
 	mutable Poco::Mutex       _mutex;
 
@@ -300,6 +386,7 @@ private:
 #endif
 	
 	friend class Bundle;
+	friend class BundleStartWorker;
 };
 
 
@@ -324,6 +411,12 @@ inline const std::string& BundleLoader::osArchitecture() const
 }
 
 
+inline int BundleLoader::getStartThreads() const
+{
+	return _startThreads;
+}
+
+
 } } // namespace Poco::OSP
 
 
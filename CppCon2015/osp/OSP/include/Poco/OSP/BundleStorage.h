@@ -67,6 +67,24 @@ public:
 	virtual std::string path() const = 0;
 		/// Returns the path to the bundle's directory or archive file.
 
+	virtual std::string digest(const std::string& path) const;
+		/// Returns a string identifying the contents of the specified file
+		/// (e.g., a checksum and the size of the file), if it can be 
+		/// obtained without reading the file. Two files with the same 
+		/// digest can be assumed to have the same contents.
+		///
+		/// Returns an empty string if no digest is available,
+		/// which is the default.
+
+	virtual bool extent(const std::string& path, std::string& filePath, Poco::UInt64& offset, Poco::UInt64& length) const;
+		/// If the specified file is stored uncompressed in the file system, 
+		/// either as a file of its own, or as part of the bundle's archive 
+		/// file, sets filePath to the path of the file containing it,
+		/// offset and length to the byte range within that file, and returns true.
+		/// This allows copying the file without going through a stream.
+		///
+		/// Otherwise, returns false, which is the default.
+
 protected:
 	virtual ~BundleStorage();
 		/// Destroys the BundleStorage.
@@ -56,9 +56,32 @@ public:
 		///
 		/// The name must not contain an filename extension.
 		
+	std::string libraryDigest(const std::string& name);
+		/// Returns the digest (see BundleStorage::digest()) stored
+		/// together with the library, or an empty string if the
+		/// library has been installed without a digest.
+		///
+		/// The name must not contain an filename extension.
+		
 	void installLibrary(const std::string& name, std::istream& istr);
 		/// Installs the library with the given name, which
 		/// must not contain an extension, into the code cache.
+
+	void installLibrary(const std::string& name, std::istream& istr, const std::string& digest);
+		/// Installs the library with the given name, which
+		/// must not contain an extension, into the code cache,
+		/// and stores the given digest together with it.
+
+	void installLibrary(const std::string& name, const std::string& sourcePath, Poco::UInt64 offset, Poco::UInt64 length, const std::string& digest);
+		/// Installs the library with the given name, which
+		/// must not contain an extension, into the code cache,
+		/// by copying length bytes, starting at offset, from
+		/// the file given by sourcePath, and stores the given 
+		/// digest together with it.
+		///
+		/// The data is copied within the kernel where supported
+		/// (copy_file_range() on Linux), or from a memory mapping
+		/// of the source file otherwise.
 		
 	void uninstallLibrary(const std::string& name);
 		/// Removes the library with the given name from
@@ -73,6 +96,27 @@ public:
 		/// Clears the cache by removing the entire
 		/// cache directory.	
 		
+protected:
+	std::string digestPathFor(const std::string& name) const;
+		/// Returns the path of the file storing the digest for the 
+		/// library with the given name.
+	
+	void writeDigest(const std::string& name, const std::string& digest);
+		/// Stores the digest for the library with the given name.
+		/// If digest is empty, removes the digest.
+	
+	void commitLibrary(const std::string& name, const Poco::Path& tempPath, const std::string& digest);
+		/// Replaces the library with the given name with the
+		/// temporary file given by tempPath, and stores its digest.
+
+	Poco::Path tempPathFor(const std::string& name) const;
+		/// Returns the path of a temporary file for installing
+		/// the library with the given name.
+
+	static void copyRange(const std::string& sourcePath, Poco::UInt64 offset, Poco::UInt64 length, const std::string& destPath);
+		/// Copies length bytes, starting at offset, from sourcePath
+		/// to the new file destPath.
+
 private:
 	CodeCache();
 	CodeCache(const CodeCache&);
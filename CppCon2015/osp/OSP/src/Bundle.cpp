@@ -204,6 +204,32 @@ void Bundle::start()
 }
 
 
+void Bundle::beginStart()
+{
+	if (_state != BUNDLE_RESOLVED) throw BundleStateException("start() requires RESOLVED state");
+
+	StateChange stateChange(_state, BUNDLE_STARTING);
+	BundleEvent startingEvent(this, BundleEvent::EV_BUNDLE_STARTING);
+	events().bundleStarting(this, startingEvent);
+	stateChange.commit();
+}
+
+
+void Bundle::endStart(const Poco::Exception* pException)
+{
+	poco_assert (_state == BUNDLE_STARTING);
+
+	if (pException)
+	{
+		_state = BUNDLE_RESOLVED;
+		pException->rethrow();
+	}
+	_state = BUNDLE_ACTIVE;
+	BundleEvent startedEvent(this, BundleEvent::EV_BUNDLE_STARTED);
+	events().bundleStarted(this, startedEvent);
+}
+
+
 void Bundle::stop()
 {
 	if (_state != BUNDLE_ACTIVE) throw BundleStateException("stop() requires ACTIVE state");
@@ -84,6 +84,21 @@ std::string BundleDirectory::path() const
 }
 
 
+bool BundleDirectory::extent(const std::string& path, std::string& filePath, Poco::UInt64& offset, Poco::UInt64& length) const
+{
+	Path p(buildPath(path));
+	File f(p);
+	if (f.exists() && f.isFile())
+	{
+		filePath = f.path();
+		offset = 0;
+		length = f.getSize();
+		return true;
+	}
+	return false;
+}
+
+
 Poco::Path BundleDirectory::buildPath(const std::string& path) const
 {
 	Path fullPath(_path);
@@ -20,6 +20,7 @@
 #include "Poco/Path.h"
 #include "Poco/Exception.h"
 #include "Poco/FileStream.h"
+#include "Poco/NumberFormatter.h"
 #include <set>
 #include <iostream>
 
@@ -158,6 +159,46 @@ std::string BundleFile::path() const
 }
 
 
+std::string BundleFile::digest(const std::string& path) const
+{
+	poco_assert (_pArchive);
+
+	// CRC and size are taken from the local file header (or its
+	// data descriptor) read when the archive was opened, so the
+	// archive does not need to be read again.
+	ZipArchive::FileHeaders::const_iterator it = _pArchive->findHeader(path);
+	if (it != _pArchive->headerEnd() && it->second.isFile())
+	{
+		std::string result("crc32:");
+		result += Poco::NumberFormatter::formatHex(it->second.getCRC(), 8);
+		result += ':';
+		result += Poco::NumberFormatter::format(it->second.getUncompressedSize());
+		return result;
+	}
+	return std::string();
+}
+
+
+bool BundleFile::extent(const std::string& path, std::string& filePath, Poco::UInt64& offset, Poco::UInt64& length) const
+{
+	poco_assert (_pArchive);
+
+	ZipArchive::FileHeaders::const_iterator it = _pArchive->findHeader(path);
+	if (it != _pArchive->headerEnd() && it->second.isFile() && it->second.getCompressionMethod() == Poco::Zip::ZipCommon::CM_STORE)
+	{
+		// With a data descriptor, sizes in the local header may be zero.
+		Poco::UInt32 size = it->second.getCompressedSize();
+		if (size == 0 || size != it->second.getUncompressedSize()) return false;
+
+		filePath = _path;
+		offset = static_cast<Poco::UInt64>(it->second.getDataStartPos());
+		length = size;
+		return true;
+	}
+	return false;
+}
+
+
 bool BundleFile::isSubdirectoryOf(const std::string& dir, const std::string& parent) const
 {
 	if (dir.size() > parent.size())
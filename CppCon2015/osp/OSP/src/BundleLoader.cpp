@@ -25,6 +25,12 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Environment.h"
 #include "Poco/Exception.h"
+#include "Poco/Format.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/Notification.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/SharedPtr.h"
 #if defined(POCO_REQUIRE_LICENSE)
 #include "Poco/Licensing/License.h"
 #endif
@@ -52,6 +58,8 @@ BundleLoader::BundleLoader(CodeCache& codeCache, BundleFactory::Ptr pBundleFacto
 	_pBundleContextFactory(pBundleContextFactory),
 	_osName(Environment::osName()),
 	_osArch(Environment::osArchitecture()),
+	_recordStartTimes(false),
+	_startThreads(1),
 	_logger(Logger::get("osp.core.BundleLoader"))
 {
 	makeValidFileName(_osName);
@@ -238,30 +246,494 @@ void BundleLoader::startAllBundles()
 	listBundles(bundles);
 	std::sort(bundles.begin(), bundles.end(), RunLevelLess());
 	
-	for (std::vector<Bundle::Ptr>::iterator it = bundles.begin(); it != bundles.end(); ++it)
 	{
-		if ((*it)->state() == Bundle::BUNDLE_RESOLVED && !(*it)->lazyStart())
+		Poco::Mutex::ScopedLock lock(_mutex);
+		_startTimes.clear();
+		_recordStartTimes = true;
+	}
+	Poco::Timestamp startTime;
+
+	if (_startThreads > 1)
+	{
+		try
+		{
+			startBundles(bundles);
+		}
+		catch (...)
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			_recordStartTimes = false;
+			throw;
+		}
+	}
+	else
+	{
+		for (std::vector<Bundle::Ptr>::iterator it = bundles.begin(); it != bundles.end(); ++it)
+		{
+			if ((*it)->state() == Bundle::BUNDLE_RESOLVED && !(*it)->lazyStart())
+			{
+				try
+				{
+					(*it)->start();
+				}
+				catch (Poco::Exception& exc)
+				{
+					std::string msg("Failed to start bundle ");
+					msg += (*it)->symbolicName();
+					msg += ": ";
+					msg += exc.displayText();
+					_logger.error(msg);
+					
+					BundleError error;
+					error.pBundle = *it;
+					error.targetState = Bundle::BUNDLE_ACTIVE;
+					error.pException = &exc;
+					bundleError(this, error);
+				}
+			}
+		}
+	}
+	
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		_recordStartTimes = false;
+	}
+	logStartTimes(startTime.elapsed());
+}
+
+
+void BundleLoader::setStartThreads(int threads)
+{
+	poco_assert (threads > 0);
+
+	_startThreads = threads;
+}
+
+
+void BundleLoader::bundleStartTimes(BundleStartTimeVec& startTimes) const
+{
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	startTimes = _startTimes;
+}
+
+
+namespace
+{
+	class BundleStartNotification: public Poco::Notification
+		/// Tells a BundleStartWorker to start the activator
+		/// of a bundle, and is sent back to the BundleLoader
+		/// when done.
+	{
+	public:
+		BundleStartNotification(std::size_t index, Bundle::Ptr pBundle):
+			_index(index),
+			_pBundle(pBundle)
+		{
+		}
+		
+		std::size_t index() const
+		{
+			return _index;
+		}
+		
+		Bundle* bundle()
+		{
+			return _pBundle.get();
+		}
+		
+		void setException(Poco::Exception* pException)
+		{
+			_pException = pException;
+		}
+		
+		Poco::SharedPtr<Poco::Exception> exception() const
+		{
+			return _pException;
+		}
+		
+	private:
+		std::size_t _index;
+		Bundle::Ptr _pBundle;
+		Poco::SharedPtr<Poco::Exception> _pException;
+	};
+	
+	
+	struct BundleStartEntry
+	{
+		BundleStartEntry():
+			pendingDeps(0),
+			dispatched(false),
+			done(false)
+		{
+		}
+		
+		Bundle::Ptr pBundle;
+		std::string runLevel;
+		std::vector<std::size_t> dependents;
+		std::size_t pendingDeps;
+		bool dispatched;
+		bool done;
+		Poco::SharedPtr<Poco::Exception> pException;
+	};
+	
+	
+	class BundleStartPlan
+		/// The bundles to start, together with all bundles they require that 
+		/// are not active yet, in the order a sequential start would start 
+		/// them (depth-first, required bundles first).
+		///
+		/// A required bundle is assigned the run level of the bundle
+		/// that requires it, as a sequential start would start it
+		/// together with that bundle. As bundles must be added in
+		/// run level order, run levels never decrease in the plan.
+	{
+	public:
+		typedef std::vector<BundleStartEntry> Entries;
+		
+		BundleStartPlan(BundleLoader& loader):
+			_loader(loader)
+		{
+		}
+		
+		std::size_t add(Bundle::Ptr pBundle)
+		{
+			return add(pBundle, pBundle->runLevel());
+		}
+		
+		Entries entries;
+		
+	private:
+		std::size_t add(Bundle::Ptr pBundle, const std::string& runLevel)
+		{
+			std::map<Bundle*, std::size_t>::const_iterator itIndex = _index.find(pBundle.get());
+			if (itIndex != _index.end()) return itIndex->second;
+			
+			BundleStartEntry entry;
+			entry.pBundle = pBundle;
+			entry.runLevel = runLevel;
+			std::vector<std::size_t> deps;
+			_visiting.insert(pBundle.get());
+			const BundleManifest::Dependencies& reqs = pBundle->requiredBundles();
+			for (BundleManifest::Dependencies::const_iterator it = reqs.begin(); it != reqs.end() && !entry.pException; ++it)
+			{
+				Bundle::Ptr pDepBundle(_loader.findBundle(it->symbolicName));
+				if (!pDepBundle)
+				{
+					entry.pException = new BundleResolveException("A required bundle is no longer available", it->symbolicName);
+				}
+				else if (!pDepBundle->isActive())
+				{
+					if (pDepBundle->state() == Bundle::BUNDLE_RESOLVED && _visiting.find(pDepBundle.get()) == _visiting.end())
+						deps.push_back(add(pDepBundle, runLevel));
+					else
+						entry.pException = new BundleStateException("A required bundle cannot be started", it->symbolicName);
+				}
+			}
+			_visiting.erase(pBundle.get());
+			
+			std::size_t index = entries.size();
+			entry.pendingDeps = deps.size();
+			entry.done = !entry.pException.isNull();
+			entries.push_back(entry);
+			for (std::vector<std::size_t>::const_iterator it = deps.begin(); it != deps.end(); ++it)
+			{
+				entries[*it].dependents.push_back(index);
+			}
+			_index[pBundle.get()] = index;
+			return index;
+		}
+		
+		BundleLoader& _loader;
+		std::map<Bundle*, std::size_t> _index;
+		std::set<Bundle*> _visiting;
+	};
+}
+
+
+class BundleStartWorker: public Poco::Runnable
+	/// Worker threads of BundleLoader::startBundles() run
+	/// the activators for all BundleStartNotifications
+	/// found in the start queue, until a different kind
+	/// of notification is found.
+{
+public:
+	BundleStartWorker(BundleLoader& loader, Poco::NotificationQueue& startQueue, Poco::NotificationQueue& doneQueue):
+		_loader(loader),
+		_startQueue(startQueue),
+		_doneQueue(doneQueue)
+	{
+	}
+	
+	void run()
+	{
+		Poco::AutoPtr<Poco::Notification> pNf(_startQueue.waitDequeueNotification());
+		while (pNf)
 		{
+			BundleStartNotification* pStartNf = dynamic_cast<BundleStartNotification*>(pNf.get());
+			if (!pStartNf) break;
 			try
 			{
-				(*it)->start();
+				_loader.startActivator(pStartNf->bundle());
 			}
 			catch (Poco::Exception& exc)
 			{
-				std::string msg("Failed to start bundle ");
-				msg += (*it)->symbolicName();
-				msg += ": ";
-				msg += exc.displayText();
-				_logger.error(msg);
+				pStartNf->setException(exc.clone());
+			}
+			catch (std::exception& exc)
+			{
+				pStartNf->setException(new Poco::SystemException(exc.what()));
+			}
+			catch (...)
+			{
+				pStartNf->setException(new Poco::UnhandledException("BundleActivator::start()"));
+			}
+			_doneQueue.enqueueNotification(pNf);
+			pNf = _startQueue.waitDequeueNotification();
+		}
+	}
+
+private:
+	BundleLoader& _loader;
+	Poco::NotificationQueue& _startQueue;
+	Poco::NotificationQueue& _doneQueue;
+};
+
+
+void BundleLoader::startBundles(const std::vector<Bundle::Ptr>& bundles)
+{
+	BundleStartPlan plan(*this);
+	for (std::vector<Bundle::Ptr>::const_iterator it = bundles.begin(); it != bundles.end(); ++it)
+	{
+		if ((*it)->state() == Bundle::BUNDLE_RESOLVED && !(*it)->lazyStart())
+		{
+			plan.add(*it);
+		}
+	}
+	BundleStartPlan::Entries& entries = plan.entries;
+	if (entries.empty()) return;
+
+	Poco::NotificationQueue startQueue;
+	Poco::NotificationQueue doneQueue;
+	BundleStartWorker worker(*this, startQueue, doneQueue);
+	std::vector<Poco::SharedPtr<Poco::Thread> > threads;
+	std::size_t nThreads = std::min(static_cast<std::size_t>(_startThreads), entries.size());
+	for (std::size_t i = 0; i < nThreads; i++)
+	{
+		Poco::SharedPtr<Poco::Thread> pThread = new Poco::Thread("BundleLoader");
+		pThread->start(worker);
+		threads.push_back(pThread);
+	}
+
+	// Activators are run by the worker threads as soon as all required
+	// bundles are active, and all bundles of lower run levels have
+	// been started. Starts are dispatched (i.e., bundleStarting is fired) 
+	// and committed (i.e., the bundle becomes active and bundleStarted
+	// is fired) by this thread. Starts are committed strictly in plan 
+	// order, and a start is dispatched only after the commit that has 
+	// made it ready, so events are fired in a deterministic order.
+	std::size_t running = 0;
+	std::size_t next = 0;
+	std::vector<std::size_t> ready;
+	for (std::size_t i = 0; i < entries.size(); i++)
+	{
+		if (entries[i].pendingDeps == 0 && !entries[i].done) ready.push_back(i);
+	}
+	try
+	{
+		while (next < entries.size())
+		{
+			// Entries before next have been committed, so the run level 
+			// of next is the lowest one that has not been finished yet.
+			std::vector<std::size_t> deferred;
+			for (std::vector<std::size_t>::const_iterator it = ready.begin(); it != ready.end(); ++it)
+			{
+				BundleStartEntry& entry = entries[*it];
+				if (entry.runLevel != entries[next].runLevel)
+				{
+					deferred.push_back(*it);
+					continue;
+				}
+				try
+				{
+					entry.pBundle->beginStart();
+					entry.dispatched = true;
+					startQueue.enqueueNotification(new BundleStartNotification(*it, entry.pBundle));
+					++running;
+				}
+				catch (Poco::Exception& exc)
+				{
+					entry.pException = exc.clone();
+					entry.done = true;
+				}
+			}
+			ready.swap(deferred);
+
+			BundleStartEntry& entry = entries[next];
+			if (entry.done)
+			{
+				bool started = false;
+				try
+				{
+					if (entry.dispatched)
+					{
+						entry.pBundle->endStart(entry.pException.get());
+					}
+					else entry.pException->rethrow();
+					started = true;
+				}
+				catch (Poco::Exception& exc)
+				{
+					std::string msg("Failed to start bundle ");
+					msg += entry.pBundle->symbolicName();
+					msg += ": ";
+					msg += exc.displayText();
+					_logger.error(msg);
+					
+					BundleError error;
+					error.pBundle = entry.pBundle;
+					error.targetState = Bundle::BUNDLE_ACTIVE;
+					error.pException = &exc;
+					bundleError(this, error);
+				}
 				
-				BundleError error;
-				error.pBundle = *it;
-				error.targetState = Bundle::BUNDLE_ACTIVE;
-				error.pException = &exc;
-				bundleError(this, error);
+				for (std::vector<std::size_t>::const_iterator it = entry.dependents.begin(); it != entry.dependents.end(); ++it)
+				{
+					BundleStartEntry& dependent = entries[*it];
+					if (dependent.done) continue;
+					if (started)
+					{
+						if (--dependent.pendingDeps == 0) ready.push_back(*it);
+					}
+					else
+					{
+						dependent.pException = new BundleException("A required bundle could not be started", entry.pBundle->symbolicName());
+						dependent.done = true;
+					}
+				}
+				++next;
+			}
+			else
+			{
+				poco_assert (running > 0);
+				
+				Poco::AutoPtr<Poco::Notification> pNf(doneQueue.waitDequeueNotification());
+				BundleStartNotification* pDoneNf = static_cast<BundleStartNotification*>(pNf.get());
+				entries[pDoneNf->index()].pException = pDoneNf->exception();
+				entries[pDoneNf->index()].done = true;
+				--running;
 			}
 		}
 	}
+	catch (...)
+	{
+		startQueue.clear();
+		for (std::size_t i = 0; i < threads.size(); i++)
+		{
+			startQueue.enqueueNotification(new Poco::Notification);
+		}
+		for (std::vector<Poco::SharedPtr<Poco::Thread> >::iterator it = threads.begin(); it != threads.end(); ++it)
+		{
+			(*it)->join();
+		}
+		throw;
+	}
+
+	for (std::size_t i = 0; i < threads.size(); i++)
+	{
+		startQueue.enqueueNotification(new Poco::Notification);
+	}
+	for (std::vector<Poco::SharedPtr<Poco::Thread> >::iterator it = threads.begin(); it != threads.end(); ++it)
+	{
+		(*it)->join();
+	}
+}
+
+
+void BundleLoader::startActivator(Bundle* pBundle)
+{
+	BundleActivator* pActivator = 0;
+	BundleContext::Ptr pContext;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+
+		if (_logger.debug())
+		{
+			_logger.debug(std::string("Starting bundle ") + pBundle->symbolicName());
+		}
+
+		BundleMap::iterator it = _bundles.find(pBundle->symbolicName());
+		if (it == _bundles.end()) throw BundleException("The bundle loader does not know the bundle", pBundle->symbolicName());
+		pActivator = loadActivator(it->second);
+		pContext = it->second.pContext;
+	}
+
+	// The mutex is not held while the activator is running, so
+	// that other activators can be started concurrently.
+	Poco::Timestamp startTime;
+	if (pActivator)
+	{
+		_logger.debug("Invoking BundleActivator::start()");
+		pActivator->start(pContext);
+	}
+	addStartTime(pBundle, startTime.elapsed());
+
+	if (_logger.information())
+	{
+		_logger.information(std::string("Bundle ") + pBundle->symbolicName() + " started");
+	}
+}
+
+
+void BundleLoader::addStartTime(Bundle* pBundle, const Poco::Timespan& duration)
+{
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	if (_recordStartTimes)
+	{
+		BundleStartTime startTime;
+		startTime.symbolicName = pBundle->symbolicName();
+		startTime.duration = duration;
+		_startTimes.push_back(startTime);
+	}
+}
+
+
+namespace
+{
+	struct DurationGreater
+	{
+		bool operator () (const BundleLoader::BundleStartTime& t1, const BundleLoader::BundleStartTime& t2) const
+		{
+			return t1.duration > t2.duration;
+		}
+	};
+}
+
+
+void BundleLoader::logStartTimes(const Poco::Timespan& totalTime) const
+{
+	if (!_logger.information()) return;
+
+	BundleStartTimeVec startTimes;
+	bundleStartTimes(startTimes);
+
+	Poco::Timespan activatorTime;
+	for (BundleStartTimeVec::const_iterator it = startTimes.begin(); it != startTimes.end(); ++it)
+	{
+		activatorTime += it->duration;
+	}
+	_logger.information(Poco::format("%z bundles started in %?d ms (%?d ms in activators, %d thread(s))", 
+		startTimes.size(), totalTime.totalMilliseconds(), activatorTime.totalMilliseconds(), _startThreads));
+
+	if (_logger.debug())
+	{
+		std::stable_sort(startTimes.begin(), startTimes.end(), DurationGreater());
+		for (BundleStartTimeVec::const_iterator it = startTimes.begin(); it != startTimes.end(); ++it)
+		{
+			_logger.debug(Poco::format("Start time for bundle %s: %?d us", it->symbolicName, it->duration.totalMicroseconds()));
+		}
+	}
 }
 
 
@@ -373,11 +845,13 @@ void BundleLoader::startBundle(Bundle* pBundle)
 	{
 		startDependencies(pBundle);
 		BundleActivator* pActivator = loadActivator(it->second);
+		Poco::Timestamp startTime;
 		if (pActivator)
 		{
 			_logger.debug("Invoking BundleActivator::start()");
 			pActivator->start(it->second.pContext);
 		}
+		addStartTime(pBundle, startTime.elapsed());
 		if (_logger.information())
 		{
 			_logger.information(std::string("Bundle ") + pBundle->symbolicName() + " started");
@@ -615,11 +1089,27 @@ void BundleLoader::installLibraries(Bundle* pBundle)
 		{
 			if (_autoUpdateCodeCache)
 			{
+				std::string resPath(p.toString(Path::PATH_UNIX));
 				Poco::Timestamp cachedFileTS(_codeCache.libraryTimestamp(*it));
-				Poco::Timestamp bundledFileTS(pBundle->storage().lastModified(p.toString(Path::PATH_UNIX)));
+				Poco::Timestamp bundledFileTS(pBundle->storage().lastModified(resPath));
 				if (cachedFileTS < bundledFileTS)
 				{
-					installLibrary(pBundle, p, &bundledFileTS);
+					// If the bundle storage can provide a digest, and it matches
+					// the digest of the cached library, the libraries are identical
+					// and only the timestamp of the cached library is updated.
+					std::string bundledDigest(pBundle->storage().digest(resPath));
+					if (!bundledDigest.empty() && bundledDigest == _codeCache.libraryDigest(*it))
+					{
+						if (_logger.debug())
+						{
+							_logger.debug(std::string("Identical library found in cache: ") + *it);
+						}
+						updateLibraryTimestamp(p, bundledFileTS);
+					}
+					else
+					{
+						installLibrary(pBundle, p, &bundledFileTS);
+					}
 				}
 				else
 				{
@@ -651,23 +1141,44 @@ void BundleLoader::installLibrary(Bundle* pBundle, const Poco::Path& p, const Po
 	{
 		_logger.debug(std::string("Installing library ") + p.toString(Path::PATH_UNIX));
 	}
-	std::auto_ptr<std::istream> pStream(pBundle->storage().getResource(p.toString(Path::PATH_UNIX)));
-	if (pStream.get())
+	std::string resPath(p.toString(Path::PATH_UNIX));
+	std::string digest(pBundle->storage().digest(resPath));
+	std::string filePath;
+	Poco::UInt64 offset;
+	Poco::UInt64 length;
+	bool installed = false;
+	if (pBundle->storage().extent(resPath, filePath, offset, length))
 	{
-		_codeCache.installLibrary(p.getFileName(), *pStream);
-		if (pTS)
+		_codeCache.installLibrary(p.getFileName(), filePath, offset, length, digest);
+		installed = true;
+	}
+	else
+	{
+		std::auto_ptr<std::istream> pStream(pBundle->storage().getResource(resPath));
+		if (pStream.get())
 		{
-			File f(_codeCache.pathFor(p.getFileName(), false));
-			try
-			{
-				f.setLastModified(*pTS);
-			}
-			catch (Poco::Exception& exc)
-			{
-				_logger.warning(Poco::format("Failed to set timestamp on %s: %s", p.toString(), exc.displayText()));
-			}
+			_codeCache.installLibrary(p.getFileName(), *pStream, digest);
+			installed = true;
 		}
 	}
+	if (installed && pTS)
+	{
+		updateLibraryTimestamp(p, *pTS);
+	}
+}
+
+
+void BundleLoader::updateLibraryTimestamp(const Poco::Path& p, const Poco::Timestamp& ts)
+{
+	File f(_codeCache.pathFor(p.getFileName(), false));
+	try
+	{
+		f.setLastModified(ts);
+	}
+	catch (Poco::Exception& exc)
+	{
+		_logger.warning(Poco::format("Failed to set timestamp on %s: %s", p.toString(), exc.displayText()));
+	}
 }
 
 
@@ -26,4 +26,16 @@ BundleStorage::~BundleStorage()
 }
 
 
+std::string BundleStorage::digest(const std::string& path) const
+{
+	return std::string();
+}
+
+
+bool BundleStorage::extent(const std::string& path, std::string& filePath, Poco::UInt64& offset, Poco::UInt64& length) const
+{
+	return false;
+}
+
+
 } } // namespace Poco::OSP
@@ -18,7 +18,19 @@
 #include "Poco/File.h"
 #include "Poco/FileStream.h"
 #include "Poco/SharedLibrary.h"
+#include "Poco/SharedMemory.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Process.h"
+#include "Poco/Exception.h"
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 
 using Poco::File;
@@ -61,23 +73,69 @@ Poco::Timestamp CodeCache::libraryTimestamp(const std::string& name)
 }
 
 
+std::string CodeCache::libraryDigest(const std::string& name)
+{
+	std::string digest;
+	File f(digestPathFor(name));
+	if (f.exists())
+	{
+		Poco::FileInputStream istr(f.path());
+		std::getline(istr, digest);
+	}
+	return digest;
+}
+
+
 void CodeCache::installLibrary(const std::string& name, std::istream& istr)
 {
-	Path p(_path, name);
-	File f(p);
-	Poco::FileOutputStream ostr(f.path());
-	if (ostr.good())
+	installLibrary(name, istr, std::string());
+}
+
+
+void CodeCache::installLibrary(const std::string& name, std::istream& istr, const std::string& digest)
+{
+	Path tempPath(tempPathFor(name));
+	File f(tempPath);
+	try
 	{
-		StreamCopier::copyStream(istr, ostr);
-		ostr.close();
-		f.setExecutable();
+		Poco::FileOutputStream ostr(f.path());
+		if (ostr.good())
+		{
+			StreamCopier::copyStream(istr, ostr);
+			ostr.close();
+			if (!ostr.good()) throw WriteFileException(f.path());
+		}
+		else throw CreateFileException(f.path());
+		commitLibrary(name, tempPath, digest);
+	}
+	catch (...)
+	{
+		if (f.exists()) f.remove();
+		throw;
+	}
+}
+
+
+void CodeCache::installLibrary(const std::string& name, const std::string& sourcePath, Poco::UInt64 offset, Poco::UInt64 length, const std::string& digest)
+{
+	Path tempPath(tempPathFor(name));
+	File f(tempPath);
+	try
+	{
+		copyRange(sourcePath, offset, length, f.path());
+		commitLibrary(name, tempPath, digest);
+	}
+	catch (...)
+	{
+		if (f.exists()) f.remove();
+		throw;
 	}
-	else throw CreateFileException(f.path());
 }
 
 	
 void CodeCache::uninstallLibrary(const std::string& name)
 {
+	writeDigest(name, std::string());
 	Path p(_path, name);
 	File f(p);
 	f.remove();
@@ -106,4 +164,106 @@ void CodeCache::clear()
 }
 
 
+std::string CodeCache::digestPathFor(const std::string& name) const
+{
+	Path p(_path, name + ".digest");
+	return p.toString();
+}
+
+
+void CodeCache::writeDigest(const std::string& name, const std::string& digest)
+{
+	File f(digestPathFor(name));
+	if (digest.empty())
+	{
+		if (f.exists()) f.remove();
+	}
+	else
+	{
+		Poco::FileOutputStream ostr(f.path());
+		ostr << digest << std::endl;
+		ostr.close();
+		if (!ostr.good()) throw WriteFileException(f.path());
+	}
+}
+
+
+void CodeCache::commitLibrary(const std::string& name, const Poco::Path& tempPath, const std::string& digest)
+{
+	// The library is written to a temporary file first and then
+	// renamed, so that an interrupted install never leaves a partially
+	// written library. The old digest is removed before, and the
+	// new one written after the library has been replaced.
+	File f(tempPath);
+	f.setExecutable();
+	writeDigest(name, std::string());
+	Path p(_path, name);
+	f.renameTo(p.toString());
+	writeDigest(name, digest);
+}
+
+
+Poco::Path CodeCache::tempPathFor(const std::string& name) const
+{
+	return Path(_path, name + "." + Poco::NumberFormatter::format(Poco::Process::id()) + ".tmp");
+}
+
+
+void CodeCache::copyRange(const std::string& sourcePath, Poco::UInt64 offset, Poco::UInt64 length, const std::string& destPath)
+{
+#if defined(POCO_OS_FAMILY_UNIX) && defined(SYS_copy_file_range)
+	int in = ::open(sourcePath.c_str(), O_RDONLY);
+	if (in == -1) throw OpenFileException(sourcePath);
+	int out = ::open(destPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+	if (out == -1)
+	{
+		::close(in);
+		throw CreateFileException(destPath);
+	}
+	loff_t inOffset = static_cast<loff_t>(offset);
+	Poco::UInt64 remaining = length;
+	int err = 0;
+	while (remaining > 0)
+	{
+		ssize_t n = ::syscall(SYS_copy_file_range, in, &inOffset, out, static_cast<loff_t*>(0), static_cast<std::size_t>(remaining), 0u);
+		if (n > 0) 
+		{
+			remaining -= n;
+		}
+		else if (n == 0)
+		{
+			err = EIO; // unexpected end of file
+			break;
+		}
+		else if (errno != EINTR)
+		{
+			err = errno;
+			break;
+		}
+	}
+	::close(in);
+	if (::close(out) != 0 && err == 0) err = errno;
+	if (err == 0) return;
+	
+	// Not supported by the kernel or the file systems involved,
+	// fall back to copying from a memory mapping.
+	if (remaining != length || (err != ENOSYS && err != EXDEV && err != EINVAL && err != EOPNOTSUPP))
+		throw WriteFileException(destPath);
+#endif
+
+	Poco::FileOutputStream ostr(destPath);
+	if (!ostr.good()) throw CreateFileException(destPath);
+	if (length > 0)
+	{
+		File source(sourcePath);
+		Poco::SharedMemory mem(source, Poco::SharedMemory::AM_READ);
+		if (offset + length > static_cast<Poco::UInt64>(mem.end() - mem.begin())) 
+			throw ReadFileException("Range exceeds file size", sourcePath);
+		ostr.write(mem.begin() + offset, static_cast<std::streamsize>(length));
+	}
+	ostr.close();
+	if (!ostr.good()) throw WriteFileException(destPath);
+}
+
+
 } } // namespace Poco::OSP
@@ -100,6 +100,8 @@ void OSPSubsystem::initialize(Poco::Util::Application& app)
 	BundleFactory::Ptr pBundleFactory(new BundleFactory(languageTag));
 	BundleContextFactory::Ptr pBundleContextFactory(new BundleContextFactory(*_pServiceRegistry, _systemEvents, dataPath));
 	_pBundleLoader     = new BundleLoader(*_pCodeCache, pBundleFactory, pBundleContextFactory, autoUpdateCodeCache);
+	int startThreads = app.config().getInt("osp.bundleStartThreads", 1);
+	_pBundleLoader->setStartThreads(startThreads > 0 ? startThreads : 1);
 	_pBundleRepository = new BundleRepository(bundleRepository, *_pBundleLoader);
 	
 	BundleStreamFactory::registerFactory(*_pBundleLoader);
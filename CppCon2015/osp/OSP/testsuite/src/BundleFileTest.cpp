@@ -14,6 +14,8 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/OSP/BundleFile.h"
+#include "Poco/OSP/CodeCache.h"
+#include "Poco/FileStream.h"
 #include "Poco/File.h"
 #include "Poco/Path.h"
 #include "Poco/Exception.h"
@@ -23,6 +25,7 @@
 
 using Poco::OSP::BundleFile;
 using Poco::OSP::BundleStorage;
+using Poco::OSP::CodeCache;
 using Poco::File;
 
 
@@ -69,6 +72,45 @@ void BundleFileTest::testDirectory()
 }
 
 
+void BundleFileTest::testDigest()
+{
+	BundleStorage::Ptr pBF(new BundleFile("testBundle.zip"));
+	assert (pBF->digest("bundle.properties") == "crc32:93FA16E8:10");
+	assert (pBF->digest("META-INF/manifest.mf") == "crc32:205ADF7A:22");
+	assert (pBF->digest("META-INF/").empty());
+	assert (pBF->digest("nonexistent").empty());
+}
+
+
+void BundleFileTest::testExtent()
+{
+	BundleStorage::Ptr pBF(new BundleFile("testBundle.zip"));
+	std::string path;
+	Poco::UInt64 offset;
+	Poco::UInt64 length;
+	assert (pBF->extent("bundle.properties", path, offset, length));
+	assert (path == "testBundle.zip");
+	assert (offset == 47);
+	assert (length == 10);
+	assert (!pBF->extent("nonexistent", path, offset, length));
+	
+	CodeCache cc("codeCache");
+	cc.installLibrary("properties", path, offset, length, pBF->digest("bundle.properties"));
+	assert (cc.hasLibrary("properties"));
+	assert (cc.libraryDigest("properties") == "crc32:93FA16E8:10");
+	
+	std::string s;
+	Poco::FileInputStream istr(cc.pathFor("properties", false));
+	std::getline(istr, s);
+	assert (s == "foo: bar");
+	istr.close();
+	
+	cc.uninstallLibrary("properties");
+	assert (!cc.hasLibrary("properties"));
+	assert (cc.libraryDigest("properties").empty());
+}
+
+
 void BundleFileTest::setUp()
 {
 	// The following is a ZIP file containing the same
@@ -122,6 +164,8 @@ CppUnit::Test* BundleFileTest::suite()
 
 	CppUnit_addTest(pSuite, BundleFileTest, testResource);
 	CppUnit_addTest(pSuite, BundleFileTest, testDirectory);
+	CppUnit_addTest(pSuite, BundleFileTest, testDigest);
+	CppUnit_addTest(pSuite, BundleFileTest, testExtent);
 
 	return pSuite;
 }
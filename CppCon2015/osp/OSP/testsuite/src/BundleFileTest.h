@@ -28,6 +28,8 @@ public:
 
 	void testResource();
 	void testDirectory();
+	void testDigest();
+	void testExtent();
 
 	void setUp();
 	void tearDown();
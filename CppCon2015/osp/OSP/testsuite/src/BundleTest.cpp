@@ -29,6 +29,8 @@
 #include "Poco/Logger.h"
 #include "Poco/ConsoleChannel.h"
 #include <memory>
+#include <set>
+#include <algorithm>
 
 
 using Poco::OSP::Bundle;
@@ -46,7 +48,9 @@ using Poco::Delegate;
 using Poco::Logger;
 
 
-BundleTest::BundleTest(const std::string& name): CppUnit::TestCase(name)
+BundleTest::BundleTest(const std::string& name): 
+	CppUnit::TestCase(name),
+	_pLoader(0)
 {
 }
 
@@ -549,6 +553,142 @@ void BundleTest::testResolveStartStopUnloadAll()
 }
 
 
+void BundleTest::testStartAllParallel()
+{
+	CodeCache cc("codeCache");
+	ServiceRegistry reg;
+	LanguageTag lang("en", "US");
+	
+	BundleFactory::Ptr pBundleFactory(new BundleFactory(lang));
+	Poco::OSP::SystemEvents systemEvents;
+	BundleContextFactory::Ptr pBundleContextFactory(new BundleContextFactory(reg, systemEvents));
+	BundleLoader loader(cc, pBundleFactory, pBundleContextFactory);
+
+	Bundle::Ptr pBundle1 = loader.createBundle(findBundle("com.appinf.osp.bundle1_1.0.0"));
+	Bundle::Ptr pBundle2 = loader.createBundle(findBundle("com.appinf.osp.bundle2_1.0.0"));
+	Bundle::Ptr pBundle3 = loader.createBundle(findBundle("com.appinf.osp.bundle3_1.0.0"));
+	Bundle::Ptr pBundle4 = loader.createBundle(findBundle("com.appinf.osp.bundle4_1.0.0"));
+	Bundle::Ptr pBundle8 = loader.createBundle(findBundle("com.appinf.osp.bundle8_1.0.0"));
+	Bundle::Ptr pBundle9 = loader.createBundle(findBundle("com.appinf.osp.bundle9_1.0.0"));
+	
+	loader.loadBundle(pBundle1);
+	loader.loadBundle(pBundle2);
+	loader.loadBundle(pBundle3);
+	loader.loadBundle(pBundle4);
+	loader.loadBundle(pBundle8);
+	loader.loadBundle(pBundle9);
+	
+	loader.resolveAllBundles();
+	
+	loader.events().bundleStarting += Delegate<BundleTest, BundleEvent>(this, &BundleTest::handleStartingEvent);
+	loader.events().bundleStarted  += Delegate<BundleTest, BundleEvent>(this, &BundleTest::handleStartedEvent);
+
+	// sequential start, for reference
+	_events.clear();
+	loader.startAllBundles();
+	std::vector<BundleEvent> sequentialEvents(_events);
+	loader.stopAllBundles();
+
+	loader.setStartThreads(4);
+	assert (loader.getStartThreads() == 4);
+	_pLoader = &loader;
+	loader.events().bundleStarting += Delegate<BundleTest, BundleEvent>(this, &BundleTest::handleStartingEventCountStartTimes);
+	_events.clear();
+	loader.startAllBundles();
+	std::vector<BundleEvent> parallelEvents(_events);
+	loader.events().bundleStarting -= Delegate<BundleTest, BundleEvent>(this, &BundleTest::handleStartingEventCountStartTimes);
+	_pLoader = 0;
+
+	assert (pBundle1->isActive());
+	assert (pBundle2->isActive());
+	assert (pBundle3->isActive());
+	assert (!pBundle4->isActive());
+	assert (pBundle8->isActive());
+	assert (pBundle9->isActive());
+	
+	BundleLoader::BundleStartTimeVec startTimes;
+	loader.bundleStartTimes(startTimes);
+	assert (startTimes.size() == 5);
+	std::set<std::string> startedBundles;
+	for (BundleLoader::BundleStartTimeVec::const_iterator it = startTimes.begin(); it != startTimes.end(); ++it)
+	{
+		startedBundles.insert(it->symbolicName);
+	}
+	assert (startedBundles.size() == 5);
+	assert (startedBundles.count("com.appinf.osp.bundle3") == 1);
+	assert (startedBundles.count("com.appinf.osp.bundle4") == 0);
+
+	// bundle1 has run level 100, bundle9 has run level 200, all others 
+	// have the default run level, so bundle1 and bundle9 must be started 
+	// one after another, before any other activator runs
+	assert (startTimes[0].symbolicName == "com.appinf.osp.bundle1");
+	assert (startTimes[1].symbolicName == "com.appinf.osp.bundle9");
+	assert (parallelEvents.size() == 10);
+	assert (parallelEvents[0].bundle() == pBundle1 && parallelEvents[0].what() == BundleEvent::EV_BUNDLE_STARTING);
+	assert (parallelEvents[1].bundle() == pBundle1 && parallelEvents[1].what() == BundleEvent::EV_BUNDLE_STARTED);
+	assert (parallelEvents[2].bundle() == pBundle9 && parallelEvents[2].what() == BundleEvent::EV_BUNDLE_STARTING);
+	assert (parallelEvents[3].bundle() == pBundle9 && parallelEvents[3].what() == BundleEvent::EV_BUNDLE_STARTED);
+	
+	// bundleStarting is fired before the activator is started, and
+	// only after the activators of all lower run levels have finished
+	assert (_startTimeCounts["com.appinf.osp.bundle1"] == 0);
+	assert (_startTimeCounts["com.appinf.osp.bundle9"] == 1);
+	assert (_startTimeCounts["com.appinf.osp.bundle2"] >= 2);
+	assert (_startTimeCounts["com.appinf.osp.bundle3"] >= 3);
+	assert (_startTimeCounts["com.appinf.osp.bundle8"] == 4);
+
+	// bundleStarted is fired in the same order as in a sequential start,
+	// bundleStarting for the same bundles
+	assert (sequentialEvents.size() == parallelEvents.size());
+	assert (bundleNames(parallelEvents, BundleEvent::EV_BUNDLE_STARTED) == bundleNames(sequentialEvents, BundleEvent::EV_BUNDLE_STARTED));
+	std::vector<std::string> sequentialStarting = bundleNames(sequentialEvents, BundleEvent::EV_BUNDLE_STARTING);
+	std::vector<std::string> parallelStarting = bundleNames(parallelEvents, BundleEvent::EV_BUNDLE_STARTING);
+	std::sort(sequentialStarting.begin(), sequentialStarting.end());
+	std::sort(parallelStarting.begin(), parallelStarting.end());
+	assert (parallelStarting == sequentialStarting);
+
+	// bundleStarting is fired before the activator is started, i.e.
+	// after all required bundles have been started
+	for (std::size_t i = 0; i < parallelEvents.size(); i++)
+	{
+		std::string name = parallelEvents[i].bundle()->symbolicName();
+		assert (eventIndex(parallelEvents, name, BundleEvent::EV_BUNDLE_STARTING) < eventIndex(parallelEvents, name, BundleEvent::EV_BUNDLE_STARTED));
+	}
+	assert (eventIndex(parallelEvents, "com.appinf.osp.bundle1", BundleEvent::EV_BUNDLE_STARTED) < eventIndex(parallelEvents, "com.appinf.osp.bundle3", BundleEvent::EV_BUNDLE_STARTING));
+	assert (eventIndex(parallelEvents, "com.appinf.osp.bundle2", BundleEvent::EV_BUNDLE_STARTED) < eventIndex(parallelEvents, "com.appinf.osp.bundle3", BundleEvent::EV_BUNDLE_STARTING));
+	assert (eventIndex(parallelEvents, "com.appinf.osp.bundle3", BundleEvent::EV_BUNDLE_STARTED) < eventIndex(parallelEvents, "com.appinf.osp.bundle8", BundleEvent::EV_BUNDLE_STARTING));
+
+	loader.stopAllBundles();
+	
+	// events are fired in the same order again, and start times 
+	// are recorded for the last startAllBundles() only
+	_events.clear();
+	loader.startAllBundles();
+	assert (_events.size() == parallelEvents.size());
+	for (std::size_t i = 0; i < _events.size(); i++)
+	{
+		assert (_events[i].bundle() == parallelEvents[i].bundle());
+		assert (_events[i].what() == parallelEvents[i].what());
+	}
+	loader.bundleStartTimes(startTimes);
+	assert (startTimes.size() == 5);
+
+	loader.stopAllBundles();
+	
+	loader.events().bundleStarting -= Delegate<BundleTest, BundleEvent>(this, &BundleTest::handleStartingEvent);
+	loader.events().bundleStarted  -= Delegate<BundleTest, BundleEvent>(this, &BundleTest::handleStartedEvent);
+
+	assert (pBundle1->state() == Bundle::BUNDLE_RESOLVED);
+	assert (pBundle2->state() == Bundle::BUNDLE_RESOLVED);
+	assert (pBundle3->state() == Bundle::BUNDLE_RESOLVED);
+	assert (pBundle4->state() == Bundle::BUNDLE_INSTALLED);
+	assert (pBundle8->state() == Bundle::BUNDLE_RESOLVED);
+	assert (pBundle9->state() == Bundle::BUNDLE_RESOLVED);
+	
+	loader.unloadAllBundles();
+}
+
+
 void BundleTest::testExtensionBundle()
 {
 	CodeCache cc("codeCache");
@@ -643,6 +783,27 @@ std::string BundleTest::findBundle(const std::string& name)
 }
 
 
+std::vector<std::string> BundleTest::bundleNames(const std::vector<BundleEvent>& events, BundleEvent::EventKind what)
+{
+	std::vector<std::string> names;
+	for (std::vector<BundleEvent>::const_iterator it = events.begin(); it != events.end(); ++it)
+	{
+		if (it->what() == what) names.push_back(it->bundle()->symbolicName());
+	}
+	return names;
+}
+
+
+std::size_t BundleTest::eventIndex(const std::vector<BundleEvent>& events, const std::string& symbolicName, BundleEvent::EventKind what)
+{
+	for (std::size_t i = 0; i < events.size(); i++)
+	{
+		if (events[i].what() == what && events[i].bundle()->symbolicName() == symbolicName) return i;
+	}
+	throw Poco::NotFoundException(symbolicName);
+}
+
+
 void BundleTest::handleEvent(const void* sender, Poco::OSP::BundleEvent& event)
 {
 	_events.push_back(event);
@@ -663,6 +824,14 @@ void BundleTest::handleStartedEvent(const void* sender, Poco::OSP::BundleEvent&
 }
 
 
+void BundleTest::handleStartingEventCountStartTimes(const void* sender, Poco::OSP::BundleEvent& event)
+{
+	BundleLoader::BundleStartTimeVec startTimes;
+	_pLoader->bundleStartTimes(startTimes);
+	_startTimeCounts[event.bundle()->symbolicName()] = startTimes.size();
+}
+
+
 void BundleTest::handleStoppingEvent(const void* sender, Poco::OSP::BundleEvent& event)
 {
 	_events.push_back(event);
@@ -692,6 +861,7 @@ CppUnit::Test* BundleTest::suite()
 	CppUnit_addTest(pSuite, BundleTest, testActivator);
 	CppUnit_addTest(pSuite, BundleTest, testStopAll);
 	CppUnit_addTest(pSuite, BundleTest, testResolveStartStopUnloadAll);
+	CppUnit_addTest(pSuite, BundleTest, testStartAllParallel);
 	CppUnit_addTest(pSuite, BundleTest, testExtensionBundle);
 
 	return pSuite;
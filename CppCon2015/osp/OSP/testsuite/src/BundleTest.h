@@ -19,7 +19,9 @@
 #include "Poco/OSP/OSP.h"
 #include "CppUnit/TestCase.h"
 #include "Poco/OSP/BundleEvent.h"
+#include "Poco/OSP/BundleLoader.h"
 #include <vector>
+#include <map>
 
 
 class BundleTest: public CppUnit::TestCase
@@ -39,6 +41,7 @@ public:
 	void testActivator();
 	void testStopAll();
 	void testResolveStartStopUnloadAll();
+	void testStartAllParallel();
 	void testExtensionBundle();
 
 	void setUp();
@@ -48,15 +51,20 @@ public:
 
 protected:
 	std::string findBundle(const std::string& name);
+	static std::vector<std::string> bundleNames(const std::vector<Poco::OSP::BundleEvent>& events, Poco::OSP::BundleEvent::EventKind what);
+	static std::size_t eventIndex(const std::vector<Poco::OSP::BundleEvent>& events, const std::string& symbolicName, Poco::OSP::BundleEvent::EventKind what);
 	
 	void handleEvent(const void* sender, Poco::OSP::BundleEvent& event);
 	void handleStartingEvent(const void* sender, Poco::OSP::BundleEvent& event);
 	void handleStartedEvent(const void* sender, Poco::OSP::BundleEvent& event);
+	void handleStartingEventCountStartTimes(const void* sender, Poco::OSP::BundleEvent& event);
 	void handleStoppingEvent(const void* sender, Poco::OSP::BundleEvent& event);
 	void handleStoppedEvent(const void* sender, Poco::OSP::BundleEvent& event);
 
 private:
 	std::vector<Poco::OSP::BundleEvent> _events;
+	Poco::OSP::BundleLoader* _pLoader;
+	std::map<std::string, std::size_t> _startTimeCounts;
 };
 
 
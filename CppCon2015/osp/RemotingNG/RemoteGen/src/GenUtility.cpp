@@ -19,6 +19,8 @@
 #include "Poco/Exception.h"
 #include "Poco/String.h"
 #include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/RemotingNG/Skeleton.h"
 #include <typeinfo>
 #include <cctype>
 
@@ -47,6 +49,12 @@ std::string GenUtility::getMethodName(const Poco::CppParser::Function* pFunc)
 }
 
 
+std::string GenUtility::getMethodId(const Poco::CppParser::Function* pFunc)
+{
+	return "0x" + Poco::NumberFormatter::formatHex(Poco::RemotingNG::Skeleton::methodId(getMethodName(pFunc)), 8);
+}
+
+
 std::string GenUtility::getRequestMethodName(const Poco::CppParser::Function* pFunc)
 {
 	Poco::CodeGeneration::CodeGenerator::Properties funcProps;
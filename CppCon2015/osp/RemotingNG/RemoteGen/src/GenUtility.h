@@ -37,6 +37,10 @@ public:
 
 	static std::string getMethodName(const Poco::CppParser::Function* pFunc);
 
+	static std::string getMethodId(const Poco::CppParser::Function* pFunc);
+		/// Returns the numeric method ID (see Poco::RemotingNG::Skeleton::methodId())
+		/// for the method name, formatted as a C++ hexadecimal literal.
+
 	static std::string getRequestMethodName(const Poco::CppParser::Function* pFunc);
 
 	static std::string getReplyMethodName(const Poco::CppParser::Function* pFunc);
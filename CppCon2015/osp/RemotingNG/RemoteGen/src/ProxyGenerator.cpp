@@ -249,10 +249,61 @@ void ProxyGenerator::methodStartImpl(Poco::CppParser::Function* pFunc, const Cod
 			pVarInt->setAccess(Poco::CppParser::Symbol::ACC_PRIVATE);
 		}
 		_cacheVariableSet |= enableCachingForThisMethod;
+
+		bool hasReturnParam = !retParamName.empty();
+		bool isOneWay = outParams.empty() && !hasReturnParam && (methodProperties.find(Utility::ONEWAY) != methodProperties.end());
+		bool isEvent = methodProperties.find("event") != methodProperties.end();
+		if (outParams.empty() && !isOneWay && !isEvent && !enableCachingForThisMethod)
+		{
+			addAsyncMethod(pFunc);
+		}
 	}
 }
 
 
+void ProxyGenerator::addAsyncMethod(const Poco::CppParser::Function* pFunc)
+{
+	std::string resultType(generateAsyncResultType(pFunc));
+	if (resultType.empty())
+		return;
+
+	std::string asyncName(generateAsyncFunctionName(pFunc));
+	Poco::CppParser::Function* pAsync = new Poco::CppParser::Function("Poco::ActiveResult < " + resultType + " > " + asyncName, _pStruct);
+	pAsync->setAccess(pFunc->getAccess());
+	pAsync->addDocumentation(" Asynchronously invokes " + pFunc->name() + "().");
+	pAsync->addDocumentation("");
+	pAsync->addDocumentation(" Returns as soon as the request has been sent. The reply");
+	pAsync->addDocumentation(" is received and deserialized in the background, and stored");
+	pAsync->addDocumentation(" in the returned ActiveResult.");
+	Poco::CppParser::Function::Iterator it = pFunc->begin();
+	Poco::CppParser::Function::Iterator itEnd = pFunc->end();
+	for (; it != itEnd; ++it)
+	{
+		std::string decl((*it)->declaration());
+		if ((*it)->hasDefaultValue())
+		{
+			decl.append(" = ");
+			decl.append((*it)->defaultDecl());
+		}
+		pAsync->addParameter(new Poco::CppParser::Parameter(decl, pAsync));
+	}
+	_asyncFunctions[asyncName] = pFunc;
+
+	std::string replyName(generateAsyncReplyFunctionName(pFunc));
+	Poco::CppParser::Function* pReply = new Poco::CppParser::Function("static void " + replyName, _pStruct);
+	pReply->setAccess(Poco::CppParser::Symbol::ACC_PRIVATE);
+	pReply->addParameter(new Poco::CppParser::Parameter("Poco::RemotingNG::Deserializer& remoting__deser", pReply));
+	if (resultType != Poco::CodeGeneration::Utility::TYPE_VOID)
+	{
+		pReply->addParameter(new Poco::CppParser::Parameter(resultType + "& remoting__ret", pReply));
+	}
+	_asyncFunctions[replyName] = pFunc;
+
+	_cppGen.addIncludeFile("Poco/ActiveResult.h");
+	_cppGen.addSrcIncludeFile("Poco/RemotingNG/AsyncReply.h");
+}
+
+
 void ProxyGenerator::registerCallbacks(Poco::CodeGeneration::GeneratorEngine& e)
 {
 	//we don't want any code for constructor and destructor
@@ -265,6 +316,15 @@ void ProxyGenerator::registerCallbacks(Poco::CodeGeneration::GeneratorEngine& e)
 	for (; it != _outerEventFunctions.end(); ++it)
 		e.registerCallback(*it, &ProxyGenerator::eventCodeGen);
 
+	std::map<std::string, const Poco::CppParser::Function*>::const_iterator itAsync = _asyncFunctions.begin();
+	for (; itAsync != _asyncFunctions.end(); ++itAsync)
+	{
+		if (itAsync->first == generateAsyncFunctionName(itAsync->second))
+			e.registerCallback(itAsync->first, &ProxyGenerator::asyncCodeGen);
+		else
+			e.registerCallback(itAsync->first, &ProxyGenerator::asyncReplyCodeGen);
+	}
+
 	// for all other methods we want the serializing implementation
 	e.registerDefaultCallback(&ProxyGenerator::serializeCodeGen);
 	e.registerPostClassCallback(&ProxyGenerator::staticMembersInitializer);
@@ -372,6 +432,68 @@ void ProxyGenerator::destructorCodeGen(const Poco::CppParser::Function* pFunc, c
 }
 
 
+void ProxyGenerator::asyncCodeGen(const Poco::CppParser::Function* pFuncAsync, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam)
+{
+	poco_check_ptr (addParam);
+
+	AbstractGenerator* pAGen = reinterpret_cast<AbstractGenerator*>(addParam);
+	ProxyGenerator* pProxy = dynamic_cast<ProxyGenerator*>(pAGen);
+	poco_check_ptr (pProxy);
+	std::map<std::string, const Poco::CppParser::Function*>::const_iterator itAsync = pProxy->_asyncFunctions.find(pFuncAsync->name());
+	poco_assert (itAsync != pProxy->_asyncFunctions.end());
+	const Poco::CppParser::Function* pFunc = itAsync->second;
+
+	OrderedParameters attrs;
+	OrderedParameters elems;
+	std::set<std::string> nsSet;
+	doElemAttrSplit(pFunc, attrs, elems, nsSet);
+	std::map<std::string, int> nsIdx;
+	std::string staticIds = ProxyGenerator::generateStaticIdString(pFunc, nsSet, attrs, elems, nsIdx);
+	gen.writeMethodImplementation("remoting__staticInitBegin(REMOTING__NAMES);");
+	gen.writeMethodImplementation(staticIds);
+	gen.writeMethodImplementation("remoting__staticInitEnd(REMOTING__NAMES);");
+
+	Poco::CodeGeneration::CodeGenerator::Properties methodProperties;
+	Poco::CodeGeneration::GeneratorEngine::parseProperties(pStruct, methodProperties);
+	Poco::CodeGeneration::GeneratorEngine::parseProperties(pFunc, methodProperties);
+	Poco::CodeGeneration::CodeGenerator::Properties::const_iterator itSync = methodProperties.find(Poco::CodeGeneration::Utility::SYNCHRONIZED);
+	if (itSync != methodProperties.end() && (itSync->second == Utility::VAL_TRUE || itSync->second.empty() || itSync->second == "all" || itSync->second == "proxy"))
+		gen.writeMethodImplementation("Poco::FastMutex::ScopedLock remoting__lock(remoting__mutex());");
+
+	writeSerializingBlock(pFunc, attrs, elems, nsIdx, gen, false, false);
+
+	std::string replyType("Poco::RemotingNG::AsyncReply<" + generateAsyncResultType(pFunc) + " >");
+	gen.writeMethodImplementation(replyType + "::Ptr remoting__pReply = new " + replyType + "(&" + pStruct->name() + "::" + generateAsyncReplyFunctionName(pFunc) + ");");
+	gen.writeMethodImplementation("remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);");
+	gen.writeMethodImplementation(Utility::RETURN + " remoting__pReply->result();");
+}
+
+
+void ProxyGenerator::asyncReplyCodeGen(const Poco::CppParser::Function* pFuncReply, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam)
+{
+	poco_check_ptr (addParam);
+
+	AbstractGenerator* pAGen = reinterpret_cast<AbstractGenerator*>(addParam);
+	ProxyGenerator* pProxy = dynamic_cast<ProxyGenerator*>(pAGen);
+	poco_check_ptr (pProxy);
+	std::map<std::string, const Poco::CppParser::Function*>::const_iterator itAsync = pProxy->_asyncFunctions.find(pFuncReply->name());
+	poco_assert (itAsync != pProxy->_asyncFunctions.end());
+	const Poco::CppParser::Function* pFunc = itAsync->second;
+
+	OrderedParameters attrs;
+	OrderedParameters elems;
+	std::set<std::string> nsSet;
+	doElemAttrSplit(pFunc, attrs, elems, nsSet);
+	std::map<std::string, int> nsIdx;
+	std::string staticIds = ProxyGenerator::generateStaticIdString(pFunc, nsSet, attrs, elems, nsIdx);
+	gen.writeMethodImplementation("remoting__staticInitBegin(REMOTING__NAMES);");
+	gen.writeMethodImplementation(staticIds);
+	gen.writeMethodImplementation("remoting__staticInitEnd(REMOTING__NAMES);");
+
+	writeDeserializingBlock(pFunc, attrs, elems, nsIdx, gen, false, false, false, 0, false, true);
+}
+
+
 void ProxyGenerator::staticMembersInitializer(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam)
 {
 	std::string code("const std::string ");
@@ -636,7 +758,10 @@ void ProxyGenerator::writeSerializingBlock(const Poco::CppParser::Function* pFun
 	}
 	
 	std::string messageType(isEvent ? "EVENT" : "REQUEST");
-	gen.writeMethodImplementation("remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
+	if (isEvent)
+		gen.writeMethodImplementation("remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
+	else
+		gen.writeMethodImplementation("remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], " + GenUtility::getMethodId(pFunc) + ", Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
 
 	writeTypeSerializer(pFunc, attrs, true, funcNsIdx, gen);
 	writeTypeSerializer(pFunc, elems, false, funcNsIdx, gen);
@@ -704,7 +829,7 @@ void ProxyGenerator::writeTypeSerializer(const Poco::CppParser::Function* pFunc,
 }
 
 
-void ProxyGenerator::writeDeserializingBlock(const Poco::CppParser::Function* pFunc, const OrderedParameters& attrs, const OrderedParameters& elems, const std::map<std::string, int>& nsIdx, CodeGenerator& gen, bool isOneWay, bool useCache, bool cacheCanExpire, Poco::UInt64 expireTime, bool isEvent)
+void ProxyGenerator::writeDeserializingBlock(const Poco::CppParser::Function* pFunc, const OrderedParameters& attrs, const OrderedParameters& elems, const std::map<std::string, int>& nsIdx, CodeGenerator& gen, bool isOneWay, bool useCache, bool cacheCanExpire, Poco::UInt64 expireTime, bool isEvent, bool isAsync)
 {
 	if (isOneWay)
 	{
@@ -712,7 +837,10 @@ void ProxyGenerator::writeDeserializingBlock(const Poco::CppParser::Function* pF
 	}
 	else
 	{
-		gen.writeMethodImplementation("Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);");
+		if (!isAsync)
+		{
+			gen.writeMethodImplementation("Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);");
+		}
 		std::map<std::string, const Poco::CppParser::Parameter*> outParams;
 		detectOutParams(pFunc, outParams);
 
@@ -798,7 +926,7 @@ void ProxyGenerator::writeDeserializingBlock(const Poco::CppParser::Function* pF
 
 		std::string retParamName(generateRetParamName(pFunc));
 		bool hasReturnParam = !retParamName.empty();
-		writeDeserializeReturnParam(pFunc, gen);
+		writeDeserializeReturnParam(pFunc, isAsync ? std::string("remoting__ret") : retParamName, gen);
 
 		writeTypeDeserializers(pFunc, elems, outParams, useCache, "", gen);
 		if (name != responseName)
@@ -868,10 +996,13 @@ void ProxyGenerator::writeDeserializingBlock(const Poco::CppParser::Function* pF
 		{
 			gen.writeMethodImplementation("remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);");
 		}
-		gen.writeMethodImplementation("remoting__trans.endRequest();");
-		if (hasReturnParam)
+		if (!isAsync)
 		{
-			gen.writeMethodImplementation(Utility::RETURN + " " + retParamName + ";");
+			gen.writeMethodImplementation("remoting__trans.endRequest();");
+			if (hasReturnParam)
+			{
+				gen.writeMethodImplementation(Utility::RETURN + " " + retParamName + ";");
+			}
 		}
 	}
 }
@@ -946,10 +1077,9 @@ void ProxyGenerator::writeTypeDeserializers(const Poco::CppParser::Function* pFu
 }
 
 
-void ProxyGenerator::writeDeserializeReturnParam(const Poco::CppParser::Function* pFunc, CodeGenerator& gen)
+void ProxyGenerator::writeDeserializeReturnParam(const Poco::CppParser::Function* pFunc, const std::string& retParamName, CodeGenerator& gen)
 {
-	std::string retParamName(generateRetParamName(pFunc));
-	bool hasReturnParam = !retParamName.empty();
+	bool hasReturnParam = !generateRetParamName(pFunc).empty();
 	
 	// always get the return param first
 	if (hasReturnParam)
@@ -1182,6 +1312,30 @@ std::string ProxyGenerator::generateEventFunctionName(const std::string& eventVa
 }
 
 
+std::string ProxyGenerator::generateAsyncFunctionName(const Poco::CppParser::Function* pFunc)
+{
+	return pFunc->name() + "Async";
+}
+
+
+std::string ProxyGenerator::generateAsyncResultType(const Poco::CppParser::Function* pFunc)
+{
+	if (generateRetParamName(pFunc).empty())
+		return Poco::CodeGeneration::Utility::TYPE_VOID;
+
+	Poco::CppParser::Parameter retParam(pFunc->getReturnParameter() + " dummy", 0);
+	if (retParam.isPointer())
+		return std::string();
+	return retParam.declType();
+}
+
+
+std::string ProxyGenerator::generateAsyncReplyFunctionName(const Poco::CppParser::Function* pFunc)
+{
+	return "remoting__" + pFunc->name() + "Reply";
+}
+
+
 void ProxyGenerator::eventCodeGen(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam)
 {
 	poco_check_ptr (addParam);
@@ -19,6 +19,7 @@
 #include "AbstractGenerator.h"
 #include "Poco/CodeGeneration/CppGenerator.h"
 #include <set>
+#include <map>
 
 
 class ProxyGenerator: public AbstractGenerator
@@ -101,6 +102,17 @@ public:
 	static std::string generateEventFunctionName(const std::string& eventVarname);
 		/// generates a fct name for an event member
 
+	static std::string generateAsyncFunctionName(const Poco::CppParser::Function* pFunc);
+		/// Generates the name of the asynchronous variant of a method.
+
+	static std::string generateAsyncReplyFunctionName(const Poco::CppParser::Function* pFunc);
+		/// Generates the name of the static method deserializing the reply
+		/// to an asynchronous request.
+
+	static std::string generateAsyncResultType(const Poco::CppParser::Function* pFunc);
+		/// Generates the result type of the asynchronous variant of a method,
+		/// or an empty string if no asynchronous variant can be generated.
+
 private:
 	static void serializeCodeGen(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam);
 
@@ -114,6 +126,12 @@ private:
 	static void destructorCodeGen(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam);
 		/// Code generator for destructor
 
+	static void asyncCodeGen(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam);
+		/// Code generator for the asynchronous variant of a method.
+
+	static void asyncReplyCodeGen(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam);
+		/// Code generator for the method deserializing the reply to an asynchronous request.
+
 	static void staticMembersInitializer(const Poco::CppParser::Function* pFunc, const Poco::CppParser::Struct* pStruct, CodeGenerator& gen, void* addParam);
 
 	static std::string generateOutParamName(const Poco::CppParser::Parameter* pParam, const std::string& functionName);
@@ -125,21 +143,29 @@ private:
 	static void writeCachingBlock(const Poco::CppParser::Function* pFunc, CodeGenerator& gen, bool cacheCanExpire);
 	static void writeSerializingBlock(const Poco::CppParser::Function* pFunc, const OrderedParameters& attrs, const OrderedParameters& elems, const std::map<std::string, int>& nsIdx, CodeGenerator& gen, bool isOneWay, bool isEvent);
 	static void writeTypeSerializer(const Poco::CppParser::Function* pFunc, const OrderedParameters& params, bool isAttr, int funcNsIdx, CodeGenerator& gen);
-	static void writeDeserializingBlock(const Poco::CppParser::Function* pFunc, const OrderedParameters& attrs, const OrderedParameters& elems, const std::map<std::string, int>& nsIdx, CodeGenerator& gen, bool isOneWay, bool useCache, bool cacheCanExpire, Poco::UInt64 expireTime, bool isEvent);
-		/// expireTime is in microsec
+	static void writeDeserializingBlock(const Poco::CppParser::Function* pFunc, const OrderedParameters& attrs, const OrderedParameters& elems, const std::map<std::string, int>& nsIdx, CodeGenerator& gen, bool isOneWay, bool useCache, bool cacheCanExpire, Poco::UInt64 expireTime, bool isEvent, bool isAsync = false);
+		/// expireTime is in microsec.
+		/// If isAsync is true, only the code for deserializing the reply
+		/// (into the remoting__ret parameter) is written.
 
-	static void writeDeserializeReturnParam(const Poco::CppParser::Function* pFunc, CodeGenerator& gen);
+	static void writeDeserializeReturnParam(const Poco::CppParser::Function* pFunc, const std::string& retParamName, CodeGenerator& gen);
 
 	void checkForEventMembers(const Poco::CppParser::Struct* pStruct);
 		/// checks if the class or any parent contains public BasicEvents
 
 	void methodStartImpl(Poco::CppParser::Function* pFunc, const CodeGenerator::Properties& methodProperties);
+
+	void addAsyncMethod(const Poco::CppParser::Function* pFunc);
+		/// Adds the asynchronous variant of the given method, returning
+		/// a Poco::ActiveResult, as well as the method deserializing
+		/// its reply.
 	
 	bool _cacheVariableSet;
 	std::vector<std::string> _boolsToInit;
 	std::vector<std::string> _events;
 	std::vector<std::string> _outerEventFunctions;
 	std::set<std::string> _functions;
+	std::map<std::string, const Poco::CppParser::Function*> _asyncFunctions;
 };
 
 
@@ -24,6 +24,7 @@
 #include "Poco/NumberFormatter.h"
 #include "Poco/String.h"
 #include "Poco/RemotingNG/SerializerBase.h"
+#include "Poco/RemotingNG/Skeleton.h"
 #include <cctype>
 
 
@@ -218,14 +219,23 @@ void SkeletonGenerator::constructorCodeGen(const Poco::CppParser::Function* pFun
 	SkeletonGenerator* pGen = dynamic_cast<SkeletonGenerator*>(pAGen);
 	poco_check_ptr (pGen);
 	
+	std::map<Poco::UInt32, std::string> methodIds;
 	SkeletonGenerator::MethodHandlers::const_iterator it = pGen->_methodHandlers.begin();
 	SkeletonGenerator::MethodHandlers::const_iterator itEnd = pGen->_methodHandlers.end();
 	for (; it != itEnd; ++it)
 	{
-		// add: addMethodHandler("create", new TransportManagerCreateMethodHandler());
+		Poco::UInt32 methodId = Poco::RemotingNG::Skeleton::methodId(it->first);
+		std::map<Poco::UInt32, std::string>::const_iterator itId = methodIds.find(methodId);
+		if (itId != methodIds.end())
+			throw Poco::InvalidArgumentException("Method IDs of " + itId->second + " and " + it->first + " collide in class " + pStruct->name() + ". Please rename one of the methods.");
+		methodIds[methodId] = it->first;
+
+		// add: addMethodHandler("create", 0x5B3F6E1D, new TransportManagerCreateMethodHandler());
 		std::string codeLine("addMethodHandler(\"");
 		codeLine.append(it->first);
-		codeLine.append("\", new ");
+		codeLine.append("\", 0x");
+		codeLine.append(Poco::NumberFormatter::formatHex(methodId, 8));
+		codeLine.append(", new ");
 		codeLine.append(it->second->fullName());
 		codeLine.append(");");
 		gen.writeMethodImplementation(codeLine);
@@ -468,17 +478,19 @@ void SkeletonGenerator::invokeCodeGen(const Poco::CppParser::Function* pFuncNew,
 
 		std::string name(GenUtility::getMethodName(pFunc));
 		std::string responseName(GenUtility::getReplyMethodName(pFunc));
-		std::string messageType(isEvent ? "EVENT" : "REPLY");		
+		std::string messageType(isEvent ? "EVENT" : "REPLY");
+		std::string messageId;
+		if (!isEvent) messageId = GenUtility::getMethodId(pFunc) + ", ";
 		if (name != responseName)
 		{
 			gen.writeMethodImplementation(indentation+"remoting__staticInitBegin(REMOTING__REPLY_NAME);");
 			gen.writeMethodImplementation(indentation+"static const std::string REMOTING__REPLY_NAME(\"" + responseName + "\");");
 			gen.writeMethodImplementation(indentation+"remoting__staticInitEnd(REMOTING__REPLY_NAME);");
-			gen.writeMethodImplementation(indentation+"remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
+			gen.writeMethodImplementation(indentation+"remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, " + messageId + "Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
 		}
 		else
 		{
-			gen.writeMethodImplementation(indentation+"remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
+			gen.writeMethodImplementation(indentation+"remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], " + messageId + "Poco::RemotingNG::SerializerBase::MESSAGE_" + messageType + ");");
 		}
 
 		// write first the attrs, then the return param, then the other out params
@@ -35,9 +35,39 @@ namespace RemotingNG {
 namespace TCP {
 
 
-class RemotingNGTCP_API ChannelStreamBuf: public Poco::BufferedStreamBuf
+class RemotingNGTCP_API ChannelBufferAllocator
+	/// The BufferAllocator used by ChannelStreamBuf.
+	///
+	/// Buffers for frames larger than Frame::FRAME_MAX_SIZE
+	/// are kept in a pool, so that large buffers do not
+	/// have to be allocated for every request and reply.
+{
+public:
+	typedef char char_type;
+
+	static char* allocate(std::streamsize size);
+	static void deallocate(char* ptr, std::streamsize size) throw();
+
+	enum
+	{
+		POOL_BUFFER_SIZE = Frame::FRAME_MAX_NEGOTIABLE_SIZE + 4,
+			/// Size of the pooled buffers.
+		
+		POOL_CAPACITY = 32
+			/// Maximum number of unused buffers kept in the pool.
+	};
+};
+
+
+class RemotingNGTCP_API ChannelStreamBuf: public Poco::BasicBufferedStreamBuf<char, std::char_traits<char>, ChannelBufferAllocator>
 	/// This is the streambuf class used for reading from
 	/// and writing to channels.
+	///
+	/// The size of the stream buffer depends on the maximum frame 
+	/// size negotiated for the connection, so that every frame 
+	/// is sent or received with a single buffer flush or refill.
+	/// Outgoing frames are sent directly from the stream buffer,
+	/// without copying the payload to a Frame.
 {
 public:
 	ChannelStreamBuf(Connection::Ptr pConnection, Poco::UInt32 frameType, Poco::UInt32 channel, Poco::Timespan timeout);
@@ -53,10 +83,14 @@ protected:
 	int writeToDevice(const char* buffer, std::streamsize length);
 
 private:
+	typedef Poco::BasicBufferedStreamBuf<char, std::char_traits<char>, ChannelBufferAllocator> Base;
+
 	Connection::Ptr _pConnection;
 	FrameQueue::Ptr _pQueue;
 	Poco::Timespan _timeout;
 	Frame::Ptr _pFrame;
+	Frame::Ptr _pReadFrame;
+	std::size_t _readOffset;
 };
 
 
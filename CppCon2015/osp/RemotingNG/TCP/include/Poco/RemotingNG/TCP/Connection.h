@@ -33,8 +33,11 @@
 #include "Poco/Mutex.h"
 #include "Poco/Logger.h"
 #include "Poco/AtomicCounter.h"
+#include "Poco/Buffer.h"
+#include "Poco/RemotingNG/TCP/PeerEndpoint.h"
 #include <vector>
 #include <set>
+#include <map>
 
 
 namespace Poco {
@@ -143,6 +146,40 @@ public:
 		/// Send a single frame.
 		/// The connection must be in STATE_ESTABLISHED.
 
+	void sendFrame(Frame::Ptr pHeader, const char* payload, Poco::UInt16 payloadSize);
+		/// Send a single frame, consisting of the header of the given
+		/// frame and the given payload, which must not exceed
+		/// maxPayloadSize(). Header and payload are sent with a single
+		/// vectored write, so the payload does not need to be
+		/// copied into the frame.
+		/// The connection must be in STATE_ESTABLISHED.
+
+	void setMaxFrameSize(Poco::UInt16 size);
+		/// Sets the maximum size of frames (header + payload) 
+		/// this endpoint accepts. The size is sent to the peer 
+		/// in the HELO frame, and must be between Frame::FRAME_MAX_SIZE
+		/// and Frame::FRAME_MAX_NEGOTIABLE_SIZE.
+		///
+		/// This must be done before the connection handshake takes place.
+		/// The default is Frame::FRAME_MAX_NEGOTIABLE_SIZE.
+		
+	Poco::UInt16 getMaxFrameSize() const;
+		/// Returns the maximum size of frames this endpoint accepts.
+		
+	Poco::UInt16 negotiatedFrameSize() const;
+		/// Returns the maximum size of frames that can be sent over
+		/// the connection, which is the smaller one of the maximum
+		/// frame sizes of both endpoints.
+		///
+		/// Returns Frame::FRAME_MAX_SIZE if the peer has not announced a
+		/// maximum frame size in its HELO frame, or if the handshake
+		/// has not taken place yet.
+		
+	Poco::UInt16 maxPayloadSize() const;
+		/// Returns the maximum payload size of frames that can be sent
+		/// over the connection, which is negotiatedFrameSize() minus
+		/// the size of the frame header.
+
 	void addCapability(Poco::UInt32 capability);
 		/// Adds the given capability to the connection.
 		///
@@ -156,6 +193,46 @@ public:
 		///
 		/// Peer capabilities will be available after the connection handshake.
 
+	bool messageIdsEnabled() const;
+		/// Returns true if both endpoints have the Frame::CAPA_MESSAGE_IDS
+		/// capability, and messages can therefore be sent with
+		/// numeric message IDs and endpoint handles.
+		///
+		/// Only valid after the connection handshake.
+
+	Poco::UInt32 endpointHandle(const std::string& oid, const std::string& tid);
+		/// Returns the handle for referring to the service object or event 
+		/// subscriber endpoint with the given object and type ID
+		/// when sending messages over the connection.
+		///
+		/// Allocates a new handle if the endpoint does not have one yet.
+		/// Returns 0 if MAX_ENDPOINT_HANDLES handles have already been
+		/// allocated.
+		///
+		/// The handle must be defined by sending the object and type ID
+		/// together with the handle, until a reply to such a message
+		/// has been received (see confirmEndpointHandle()). Only then 
+		/// the handle alone can be sent safely, as the peer may process 
+		/// messages in parallel.
+
+	void confirmEndpointHandle(Poco::UInt32 handle);
+		/// Marks the given handle as known to the peer, after a reply
+		/// to a message defining the handle has been received.
+
+	bool endpointHandleConfirmed(Poco::UInt32 handle) const;
+		/// Returns true if the given handle has been confirmed
+		/// with confirmEndpointHandle().
+
+	void definePeerEndpoint(Poco::UInt32 handle, PeerEndpoint::Ptr pEndpoint);
+		/// Stores the endpoint the peer has defined for the given handle.
+		///
+		/// Throws a ProtocolException if the handle is not 
+		/// in range 1 to MAX_ENDPOINT_HANDLES.
+
+	PeerEndpoint::Ptr findPeerEndpoint(Poco::UInt32 handle) const;
+		/// Returns the endpoint the peer has defined for the given 
+		/// handle, or null if no endpoint has been defined.
+
 	void setIdleTimeout(Poco::Timespan timeout);
 		/// Sets the timeout after an idle connection is closed.
 		
@@ -188,6 +265,19 @@ public:
 		
 	void popFrameHandler(Poco::AutoPtr<FrameHandler> pHandler);
 		/// Removes the FrameHandler from the internal stack.
+
+	void registerChannelHandler(Poco::UInt32 channel, Poco::AutoPtr<FrameHandler> pHandler);
+		/// Registers the FrameHandler for frames on the given channel.
+		///
+		/// A frame is first passed to the handler registered for
+		/// its channel, if any, and only if that handler does not
+		/// handle the frame, to the handlers on the internal stack.
+		/// Finding the channel handler takes a map lookup, so the
+		/// cost of dispatching a frame does not grow with the number
+		/// of outstanding asynchronous requests.
+		
+	void unregisterChannelHandler(Poco::UInt32 channel);
+		/// Removes the FrameHandler registered for the given channel.
 		
 	bool waitReady(Poco::Timespan timeout = 2*TIMEOUT_HELO);
 		/// Waits until the connection is established, or the
@@ -195,6 +285,13 @@ public:
 
 	void returnFrame(Frame::Ptr pFrame);
 		/// Returns the frame to the pool.
+
+	enum
+	{
+		MAX_ENDPOINT_HANDLES = 4096
+			/// The maximum number of endpoint handles allocated
+			/// or accepted by a Connection.
+	};
 	
 protected:
 	void run();
@@ -206,6 +303,11 @@ protected:
 	void processFrame(Frame::Ptr pFrame);
 		/// Process a single frame.
 
+	bool dispatchFrame(Connection::Ptr pThis, Poco::AutoPtr<FrameHandler> pHandler, Frame::Ptr pFrame);
+		/// Passes the frame to the given FrameHandler and returns true
+		/// if the handler has handled the frame. Exceptions thrown
+		/// by the handler are logged.
+
 	void receiveHELO();
 		/// Waits for and receives the initial HELO frame.
 		
@@ -221,10 +323,23 @@ protected:
 	void sendProtocolFrame(Frame::Ptr pFrame);
 		/// Send a single protocol frame.
 
+	void sendFrameImpl(const char* header, const char* payload, std::size_t payloadSize);
+		/// Writes the given frame header and payload to the socket.
+		/// Where possible, a single vectored write is used.
+		/// The caller must hold the mutex.
+
 	Frame::Ptr receiveFrame();
 		/// Receives the next frame from the connection,
 		/// or returns null if no frame has been received
 		/// within a certain time.
+		///
+		/// Frames with payloads up to Frame::FRAME_MAX_PAYLOAD_SIZE
+		/// are taken from a pool of small frames. Larger frames are
+		/// taken from a pool of medium frames (FRAME_MEDIUM_SIZE) 
+		/// or large frames (Frame::FRAME_MAX_NEGOTIABLE_SIZE), 
+		/// depending on their size. These pools only keep a limited
+		/// number of unused frames, and allocate a new frame if
+		/// no unused frame is available.
 
 	int receiveNBytes(char* buffer, int bytes);
 		/// Receive exactly the given number of bytes.
@@ -242,8 +357,17 @@ private:
 		TIMEOUT_FRAME =  500000
 	};
 	
+	enum FrameSizes
+	{
+		FRAME_MEDIUM_SIZE = 8192
+			/// Buffer size of the frames in the pool of medium frames.
+	};
+	
 	typedef Poco::ObjectPool<Frame, Frame::Ptr, FrameFactory> FramePool;
 	typedef std::vector<Poco::AutoPtr<FrameHandler> > FrameHandlerVec;
+	typedef std::map<Poco::UInt32, Poco::AutoPtr<FrameHandler> > ChannelHandlerMap;
+	typedef std::map<std::pair<std::string, std::string>, Poco::UInt32> EndpointHandleMap;
+	typedef std::vector<PeerEndpoint::Ptr> PeerEndpointVec;
 	
 	Poco::Net::StreamSocket _socket;
 	Poco::UInt32 _id;
@@ -251,10 +375,21 @@ private:
 	ConnectionMode _mode;
 	ConnectionState _state;
 	FramePool _framePool;
+	FramePool _mediumFramePool;
+	FramePool _largeFramePool;
+	Poco::UInt16 _maxFrameSize;
+	Poco::UInt16 _peerMaxFrameSize;
+	Poco::Buffer<char> _sendBuffer;
 	FrameHandlerVec _frameHandlers;
 	FrameHandlerVec _tmpFrameHandlers;
+	ChannelHandlerMap _channelHandlers;
 	std::set<Poco::UInt32> _capabilities;
 	std::set<Poco::UInt32> _peerCapabilities;
+	bool _messageIds;
+	EndpointHandleMap _endpointHandles;
+	std::vector<bool> _confirmedEndpointHandles;
+	PeerEndpointVec _peerEndpoints;
+	mutable Poco::FastMutex _endpointMutex;
 	std::set<Poco::UInt32> _allocatedChannels;
 	Poco::UInt32 _nextChannel;
 	Poco::Timestamp _lastFrame;
@@ -295,9 +430,38 @@ inline Connection::ConnectionState Connection::state() const
 }
 
 
+inline bool Connection::messageIdsEnabled() const
+{
+	return _messageIds;
+}
+
+
+inline Poco::UInt16 Connection::getMaxFrameSize() const
+{
+	return _maxFrameSize;
+}
+
+
+inline Poco::UInt16 Connection::negotiatedFrameSize() const
+{
+	return _peerMaxFrameSize < _maxFrameSize ? _peerMaxFrameSize : _maxFrameSize;
+}
+
+
+inline Poco::UInt16 Connection::maxPayloadSize() const
+{
+	return static_cast<Poco::UInt16>(negotiatedFrameSize() - Frame::FRAME_HEADER_SIZE);
+}
+
+
 inline void Connection::returnFrame(Frame::Ptr pFrame)
 {
-	_framePool.returnObject(pFrame);
+	if (pFrame->bufferSize() > FRAME_MEDIUM_SIZE)
+		_largeFramePool.returnObject(pFrame);
+	else if (pFrame->bufferSize() > Frame::FRAME_MAX_SIZE)
+		_mediumFramePool.returnObject(pFrame);
+	else
+		_framePool.returnObject(pFrame);
 }
 
 
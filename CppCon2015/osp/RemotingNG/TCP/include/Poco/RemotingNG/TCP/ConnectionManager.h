@@ -23,10 +23,14 @@
 #include "Poco/RemotingNG/TCP/TCP.h"
 #include "Poco/RemotingNG/TCP/Connection.h"
 #include "Poco/RemotingNG/TCP/SocketFactory.h"
+#include "Poco/RemotingNG/TCP/Timer.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/AutoPtr.h"
 #include <map>
 #include <set>
+#include <deque>
 
 
 namespace Poco {
@@ -34,6 +38,9 @@ namespace RemotingNG {
 namespace TCP {
 
 
+class ServerTransport;
+
+
 class RemotingNGTCP_API ConnectionManager
 	/// The ConnectionManager manages a collection of Connection objects.
 	///
@@ -46,7 +53,9 @@ class RemotingNGTCP_API ConnectionManager
 	///
 	/// A Poco::ThreadPool is used to obtain threads for driving the protocol
 	/// on the client side, as well as for scheduling requests on the server
-	/// and events on the client.
+	/// and events on the client. Requests and events are queued
+	/// (see dispatch()), so that the threads reading from connections
+	/// never have to wait for a thread from the pool to become available.
 {
 public:
 	ConnectionManager(Poco::ThreadPool& threadPool = Poco::ThreadPool::defaultPool());
@@ -96,12 +105,28 @@ public:
 	
 	ThreadPool& threadPool();
 		/// Returns a reference to the ConnectionManager's thread pool.
+
+	Timer& timer();
+		/// Returns a reference to the ConnectionManager's Timer,
+		/// which is used to time out asynchronous requests.
+
+	void dispatch(Poco::AutoPtr<ServerTransport> pServerTransport);
+		/// Enqueues the given ServerTransport, to be run by a thread
+		/// from the thread pool. Queued ServerTransport objects are
+		/// run in order of their arrival.
+		///
+		/// If the thread pool has no idle thread left, the
+		/// ServerTransport will be run by the next pool thread
+		/// that completes a dispatched ServerTransport.
+		/// If no such thread exists either, a
+		/// Poco::NoThreadAvailableException is thrown.
 	
 	static ConnectionManager& defaultManager();
 		/// Returns the default ConnectionManager instance.
 
 protected:
 	Connection::Ptr createConnection(const Poco::URI& endpointURI);
+	void runDispatched();
 
 private:
 	enum
@@ -114,6 +139,7 @@ private:
 
 	typedef std::map<Poco::Net::SocketAddress, Connection::Ptr> ConnectionMap;
 	typedef std::set<Poco::Net::SocketAddress> SocketAddressSet;
+	typedef std::deque<Poco::AutoPtr<ServerTransport> > ServerTransportQueue;
 
 	SocketFactory::Ptr _pSocketFactory;
 	Poco::Timespan _idleTimeout;
@@ -121,6 +147,11 @@ private:
 	ConnectionMap _connections;
 	SocketAddressSet _pendingConnections;
 	Poco::FastMutex _mutex;
+	Poco::RunnableAdapter<ConnectionManager> _dispatcher;
+	ServerTransportQueue _dispatchQueue;
+	int _activeDispatchers;
+	Poco::FastMutex _dispatchMutex;
+	Timer _timer;
 };
 
 
@@ -139,6 +170,12 @@ inline Poco::ThreadPool& ConnectionManager::threadPool()
 }
 
 
+inline Timer& ConnectionManager::timer()
+{
+	return _timer;
+}
+
+
 } } } // namespace Poco::RemotingNG::TCP
 
 
@@ -44,8 +44,10 @@ class RemotingNGTCP_API Frame: public Poco::RefCountedObject
 	///   - Payload Size: 16 bit unsigned integer.
 	///
 	/// All integers are in network byte order.
-	/// Payload sizes are 16 bit, although practically
-	/// only payloads up to a size of 1012 bytes are used.
+	/// Payload sizes are 16 bit. Unless both endpoints
+	/// have agreed on a larger maximum frame size in the
+	/// HELO handshake (see CAPA_MAX_FRAME_SIZE), only
+	/// payloads up to a size of 1012 bytes are used.
 {
 public:
 	typedef Poco::AutoPtr<Frame> Ptr;
@@ -119,10 +121,16 @@ public:
 			/// Size of frame header.
 
 		FRAME_MAX_SIZE = 1024,
-			/// Maximum frame size (header + payload) currently used by protocol.
+			/// Maximum frame size (header + payload) used by protocol,
+			/// unless a larger frame size has been negotiated.
 			
-		FRAME_MAX_PAYLOAD_SIZE = FRAME_MAX_SIZE - FRAME_HEADER_SIZE
-			/// Maximum frame payload size currently used by protocol.
+		FRAME_MAX_PAYLOAD_SIZE = FRAME_MAX_SIZE - FRAME_HEADER_SIZE,
+			/// Maximum frame payload size used by protocol,
+			/// unless a larger frame size has been negotiated.
+			
+		FRAME_MAX_NEGOTIABLE_SIZE = 65535
+			/// Largest frame size (header + payload) that can be negotiated.
+			/// Limited by the size of the frame size fields.
 	};
 	
 	enum Version
@@ -133,8 +141,25 @@ public:
 	
 	enum Capabilities
 	{
-		CAPA_REMOTING_PROTOCOL_1_0 = 0x524D0100 
+		CAPA_REMOTING_PROTOCOL_1_0 = 0x524D0100,
 			/// The endpoint understands the Remoting NG binary protocol, version 1.0
+			
+		CAPA_MAX_FRAME_SIZE        = 0x4D460000,
+			/// "MF" - The endpoint accepts frames larger than FRAME_MAX_SIZE.
+			/// The lower 16 bits of the capability contain the maximum
+			/// frame size (header + payload) the endpoint accepts.
+			/// Both endpoints use the smaller of their maximum frame sizes
+			/// for sending frames. If the capability is not present,
+			/// FRAME_MAX_SIZE is used.
+
+		CAPA_MESSAGE_IDS           = 0x4D490100,
+			/// "MI" - The endpoint understands messages identified by
+			/// numeric method IDs, and service object endpoints
+			/// identified by connection-scoped handles.
+			/// Only used if both endpoints have the capability.
+			
+		CAPA_VALUE_MASK            = 0x0000FFFF
+			/// Mask for the lower 16 bits of capabilities that contain a value.
 	};
 
 	Frame(Poco::UInt32 type, Poco::UInt32 channel, Poco::UInt16 flags, Poco::UInt16 bufferSize);
@@ -200,6 +225,14 @@ public:
 
 	const char* bufferEnd() const;
 		/// Returns a pointer to the end (one past last byte) of the buffer.
+		
+	void copyHeader(char* header, Poco::UInt16 payloadSize) const;
+		/// Copies the frame header to the given buffer, which must
+		/// be at least FRAME_HEADER_SIZE bytes large, and sets the
+		/// payload size in the copy to the given size.
+		///
+		/// Used for sending a frame whose payload is not stored
+		/// in the frame's buffer.
 	
 private:
 	enum
@@ -34,9 +34,16 @@ class RemotingNGTCP_API FrameFactory
 	/// Connection's Frame object pool.
 {
 public:
+	FrameFactory(Poco::UInt16 frameSize = Frame::FRAME_MAX_SIZE):
+		_frameSize(frameSize)
+		/// Creates the FrameFactory for frames with the given
+		/// buffer size.
+	{
+	}
+	
 	Frame::Ptr createObject()
 	{
-		return new Frame(0, 0, 0, Frame::FRAME_MAX_SIZE);
+		return new Frame(0, 0, 0, _frameSize);
 	}
 	
 	bool validateObject(Frame::Ptr pFrame)
@@ -55,6 +62,9 @@ public:
 	void destroyObject(Frame::Ptr pFrame)
 	{
 	}
+	
+private:
+	Poco::UInt16 _frameSize;
 };
 
 
@@ -0,0 +1,104 @@
+//
+// PeerEndpoint.h
+//
+// $Id$
+//
+// Library: RemotingNG/TCP
+// Package: TCP
+// Module:  PeerEndpoint
+//
+// Definition of the PeerEndpoint class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef RemotingNG_TCP_PeerEndpoint_INCLUDED
+#define RemotingNG_TCP_PeerEndpoint_INCLUDED
+
+
+#include "Poco/RemotingNG/TCP/TCP.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include <string>
+
+
+namespace Poco {
+namespace RemotingNG {
+namespace TCP {
+
+
+class RemotingNGTCP_API PeerEndpoint: public Poco::RefCountedObject
+	/// A PeerEndpoint stores a service object or event subscriber
+	/// endpoint the peer has defined a handle for
+	/// (see Connection::definePeerEndpoint()).
+	///
+	/// PeerEndpoint objects are immutable, so they can be shared
+	/// between the threads handling requests on a Connection.
+{
+public:
+	typedef Poco::AutoPtr<PeerEndpoint> Ptr;
+
+	PeerEndpoint(const std::string& oid, const std::string& tid);
+		/// Creates the PeerEndpoint for the given object and type ID.
+
+	PeerEndpoint(const PeerEndpoint& endpoint, const std::string& objectPath);
+		/// Creates a copy of the given PeerEndpoint,
+		/// with the given resolved object path.
+
+	const std::string& path() const;
+		/// Returns the path of the endpoint, in the form
+		/// <protocol>/<typeId>/<objectId>.
+
+	const std::string& objectPath() const;
+		/// Returns the ORB object path the endpoint has been
+		/// resolved to, or an empty string if the path
+		/// has not been resolved yet.
+
+	bool isEvent() const;
+		/// Returns true if the endpoint refers to an event
+		/// subscriber, false if it refers to a service object.
+
+protected:
+	~PeerEndpoint();
+		/// Destroys the PeerEndpoint.
+
+private:
+	PeerEndpoint();
+	PeerEndpoint(const PeerEndpoint&);
+	PeerEndpoint& operator = (const PeerEndpoint&);
+
+	std::string _path;
+	std::string _objectPath;
+	bool _isEvent;
+};
+
+
+//
+// inlines
+//
+inline const std::string& PeerEndpoint::path() const
+{
+	return _path;
+}
+
+
+inline const std::string& PeerEndpoint::objectPath() const
+{
+	return _objectPath;
+}
+
+
+inline bool PeerEndpoint::isEvent() const
+{
+	return _isEvent;
+}
+
+
+} } } // namespace Poco::RemotingNG::TCP
+
+
+#endif // RemotingNG_TCP_PeerEndpoint_INCLUDED
@@ -0,0 +1,120 @@
+//
+// ReplyCollector.h
+//
+// $Id$
+//
+// Library: RemotingNG/TCP
+// Package: TCP
+// Module:  ReplyCollector
+//
+// Definition of the ReplyCollector class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef RemotingNG_TCP_ReplyCollector_INCLUDED
+#define RemotingNG_TCP_ReplyCollector_INCLUDED
+
+
+#include "Poco/RemotingNG/TCP/TCP.h"
+#include "Poco/RemotingNG/TCP/FrameHandler.h"
+#include "Poco/RemotingNG/TCP/Timer.h"
+#include "Poco/RemotingNG/ReplyHandler.h"
+#include "Poco/Mutex.h"
+#include <string>
+
+
+namespace Poco {
+namespace RemotingNG {
+namespace TCP {
+
+
+class RemotingNGTCP_API ReplyCollector: public FrameHandler
+	/// A FrameHandler that collects the frames of the reply to an
+	/// asynchronous request (see Transport::sendRequestAsync()), and
+	/// passes the complete reply message to a ReplyHandler.
+	///
+	/// The ReplyHandler is invoked by the Connection's reader thread.
+	/// Before that, the ReplyCollector removes itself from the
+	/// Connection and releases the request's channel.
+	/// If the Connection is closed or aborted before the reply
+	/// has been received, or if no reply has been received within
+	/// the timeout, the ReplyHandler's handleError() method
+	/// is called instead.
+{
+public:
+	typedef Poco::AutoPtr<ReplyCollector> Ptr;
+
+	ReplyCollector(Connection::Ptr pConnection, Poco::UInt32 frameType, Poco::UInt32 channel, bool compressed, Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler, Poco::UInt32 endpointHandle = 0);
+		/// Creates the ReplyCollector, accepting frames having the
+		/// given type and channel. If compressed is true, the reply
+		/// message is inflated before it is passed to the ReplyHandler.
+		///
+		/// If the request has defined an endpoint handle, it must
+		/// be given in endpointHandle. The handle is confirmed
+		/// (see Connection::confirmEndpointHandle()) when the
+		/// reply has been received.
+		///
+		/// The ReplyCollector takes ownership of the channel.
+
+	~ReplyCollector();
+		/// Destroys the ReplyCollector.
+
+	void start(Timer& timer, const Poco::Timespan& timeout);
+		/// Registers the ReplyCollector with the Connection
+		/// as the handler for its channel (see 
+		/// Connection::registerChannelHandler()), and schedules
+		/// a timeout with the given Timer. If the reply has not been
+		/// received within the timeout, the ReplyCollector is finished,
+		/// and the ReplyHandler's handleError() method is called
+		/// with a Poco::TimeoutException.
+		///
+		/// Must be called before the request is sent.
+		/// Throws a RemotingException if the Connection has
+		/// already been closed.
+
+	void cancel();
+		/// Unregisters the ReplyCollector from the Connection
+		/// and releases the channel, without notifying the
+		/// ReplyHandler.
+
+	// FrameHandler
+	bool handleFrame(Connection::Ptr pConnection, Frame::Ptr pFrame);
+
+protected:
+	Poco::RemotingNG::ReplyHandler::Ptr finish();
+		/// Unregisters the ReplyCollector and releases the channel.
+		///
+		/// Returns the ReplyHandler, or a null pointer if the
+		/// ReplyCollector has already been finished.
+
+	void onConnectionClosed(const void* pSender, Connection::Ptr& pConnection);
+	void onTimeout();
+
+private:
+	class TimeoutTask;
+
+	ReplyCollector();
+	ReplyCollector(const ReplyCollector&);
+	ReplyCollector& operator = (const ReplyCollector&);
+
+	Connection::Ptr _pConnection;
+	Poco::UInt32 _frameType;
+	Poco::UInt32 _channel;
+	bool _compressed;
+	Poco::RemotingNG::ReplyHandler::Ptr _pReplyHandler;
+	Poco::UInt32 _endpointHandle;
+	std::string _message;
+	Poco::AutoPtr<TimeoutTask> _pTimeoutTask;
+	Poco::FastMutex _mutex;
+};
+
+
+} } } // namespace Poco::RemotingNG::TCP
+
+
+#endif // RemotingNG_TCP_ReplyCollector_INCLUDED
@@ -22,6 +22,8 @@
 
 #include "Poco/RemotingNG/TCP/TCP.h"
 #include "Poco/RemotingNG/TCP/ChannelStream.h"
+#include "Poco/RemotingNG/TCP/Connection.h"
+#include "Poco/RemotingNG/TCP/Frame.h"
 #include "Poco/RemotingNG/ServerTransport.h"
 #include "Poco/RemotingNG/BinarySerializer.h"
 #include "Poco/RemotingNG/BinaryDeserializer.h"
@@ -29,8 +31,8 @@
 #include "Poco/DeflatingStream.h"
 #include "Poco/SharedPtr.h"
 #include "Poco/AutoPtr.h"
-#include "Poco/Event.h"
 #include "Poco/Logger.h"
+#include <istream>
 
 
 namespace Poco {
@@ -43,18 +45,40 @@ class Listener;
 
 class RemotingNGTCP_API ServerTransport: public Poco::RemotingNG::ServerTransport, public Poco::Runnable, public Poco::RefCountedObject
 	/// The ServerTransport implementation for the RemotingNG TCP transport.
+	///
+	/// A ServerTransport is created by the Connection's reader thread
+	/// for every incoming request and then handed over to the
+	/// Listener's ConnectionManager (see start()). The reader thread
+	/// never waits for the server thread.
+	///
+	/// If the Connection supports message IDs, service objects 
+	/// are referred to by handles defined by the peer (see
+	/// Connection::definePeerEndpoint()).
 {
 public:
 	typedef Poco::AutoPtr<ServerTransport> Ptr;
 
-	ServerTransport(Listener& _listener, const Poco::SharedPtr<ChannelInputStream>& pRequestStream, const Poco::SharedPtr<ChannelOutputStream>& pReplyStream, bool compressed);
-		/// Creates a ServerTransport.
+	ServerTransport(Listener& listener, Connection::Ptr pConnection, const Poco::SharedPtr<ChannelInputStream>& pRequestStream, const Poco::SharedPtr<ChannelOutputStream>& pReplyStream, bool compressed);
+		/// Creates a ServerTransport for a request that spans 
+		/// more than one frame. The request message is read
+		/// from the given ChannelInputStream.
+		
+	ServerTransport(Listener& listener, Connection::Ptr pConnection, Frame::Ptr pRequestFrame, const Poco::SharedPtr<ChannelOutputStream>& pReplyStream, bool compressed);
+		/// Creates a ServerTransport for a request that has been
+		/// received in a single frame. The request message is read
+		/// directly from the frame's payload, and the frame is returned
+		/// to the Connection when the ServerTransport is destroyed.
 		
 	~ServerTransport();
 		/// Destroys the ServerTransport().
 		
-	void waitReady();
-		/// Waits until the server thread is ready.
+	void start();
+		/// Passes the ServerTransport to ConnectionManager::dispatch()
+		/// of the Listener's ConnectionManager, to be run
+		/// by a thread from its thread pool.
+		///
+		/// If dispatch() throws, the exception is passed on
+		/// and the request frame is not returned to the Connection.
 
 	// ServerTransport
 	Deserializer& beginRequest();
@@ -65,14 +89,18 @@ public:
 	void run();
 	
 private:
+	void setupStreams(bool compressed);
+	void sendFault(const std::string& message);
+
 	Listener& _listener;
-	Poco::SharedPtr<ChannelInputStream> _pRequestStream;
+	Connection::Ptr _pConnection;
+	Frame::Ptr _pRequestFrame;
+	Poco::SharedPtr<std::istream> _pRequestStream;
 	Poco::SharedPtr<ChannelOutputStream> _pReplyStream;
 	Poco::InflatingInputStream* _pInflater;
 	Poco::DeflatingOutputStream* _pDeflater;
 	Poco::RemotingNG::BinarySerializer _serializer;
 	Poco::RemotingNG::BinaryDeserializer _deserializer;
-	Poco::Event _ready;
 	Poco::Logger& _logger;
 };
 
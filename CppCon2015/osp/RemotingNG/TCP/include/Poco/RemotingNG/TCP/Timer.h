@@ -108,6 +108,10 @@ public:
 		/// running task finishes. If wait is true, waits
 		/// until the queue has been purged.
 			
+	void schedule(TimerTask::Ptr pTask, long delay);
+		/// Schedules a task for one-time execution after
+		/// the given delay in milliseconds.
+
 	void scheduleAtFixedRate(TimerTask::Ptr pTask, long delay, long interval);
 		/// Schedules a task for periodic execution at a fixed rate.
 		///
@@ -44,6 +44,19 @@ class ConnectionManager;
 
 class RemotingNGTCP_API Transport: public Poco::RemotingNG::Transport
 	/// The Transport implementation for RemotingNG TCP.
+	///
+	/// Requests sent with sendRequestAsync() are completed by the
+	/// Connection's reader thread, so any number of asynchronous
+	/// requests can be outstanding on a single Connection.
+	/// The response timeout (see setTimeout()) applies to these
+	/// requests as well. If no reply has been received in time,
+	/// the ReplyHandler's handleError() method is called with a
+	/// Poco::TimeoutException.
+	///
+	/// If both endpoints of the Connection support it, requests
+	/// are identified by numeric method IDs, and the service object
+	/// by a handle allocated once per Connection, instead of
+	/// object and type ID strings.
 {
 public:
 	static const std::string PROTOCOL;
@@ -77,9 +90,12 @@ public:
 	Poco::RemotingNG::Serializer& beginRequest(const Poco::RemotingNG::Identifiable::ObjectId& oid, const Poco::RemotingNG::Identifiable::TypeId& tid, const std::string& messageName, Poco::RemotingNG::SerializerBase::MessageType messageType);
 	Poco::RemotingNG::Deserializer& sendRequest(const Poco::RemotingNG::Identifiable::ObjectId& oid, const Poco::RemotingNG::Identifiable::TypeId& tid, const std::string& messageName, Poco::RemotingNG::SerializerBase::MessageType messageType);
 	void endRequest();
+	void sendRequestAsync(const Poco::RemotingNG::Identifiable::ObjectId& oid, const Poco::RemotingNG::Identifiable::TypeId& tid, const std::string& messageName, Poco::RemotingNG::SerializerBase::MessageType messageType, Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler);
 
 protected:
+	static Poco::UInt32 replyFrameType(Poco::RemotingNG::SerializerBase::MessageType messageType);
 	void setupSerializer(const Poco::RemotingNG::Identifiable::ObjectId& oid, const Poco::RemotingNG::Identifiable::TypeId& tid, Poco::RemotingNG::SerializerBase::MessageType messageType, Poco::UInt16 frameFlags);
+	void serializeEndPoint(const std::string& oid, const std::string& tid);
 
 private:
 	Transport();
@@ -98,6 +114,12 @@ private:
 	bool _compression;
 	Connection::Ptr _pConnection;
 	Poco::UInt32 _channel;
+	Poco::UInt32 _endpointConnectionId;
+	Poco::UInt32 _endpointHandle;
+	bool _endpointConfirmed;
+	Poco::UInt32 _requestEndpointHandle;
+	std::string _endpointOID;
+	std::string _endpointTID;
 	Poco::SharedPtr<ChannelOutputStream> _pRequestStream;
 	Poco::SharedPtr<ChannelInputStream> _pReplyStream;
 	Poco::SharedPtr<Poco::DeflatingOutputStream> _pDeflatingStream;
@@ -15,6 +15,9 @@
 
 
 #include "Poco/RemotingNG/TCP/ChannelStream.h"
+#include "Poco/Mutex.h"
+#include <vector>
+#include <cstring>
 
 
 namespace Poco {
@@ -22,25 +25,79 @@ namespace RemotingNG {
 namespace TCP {
 
 
+//
+// ChannelBufferAllocator
+//
+
+
+namespace
+{
+	Poco::FastMutex bufferPoolMutex;
+	std::vector<char*> bufferPool;
+}
+
+
+char* ChannelBufferAllocator::allocate(std::streamsize size)
+{
+	if (size > Frame::FRAME_MAX_SIZE + 4)
+	{
+		poco_assert (size <= POOL_BUFFER_SIZE);
+
+		Poco::FastMutex::ScopedLock lock(bufferPoolMutex);
+		if (!bufferPool.empty())
+		{
+			char* ptr = bufferPool.back();
+			bufferPool.pop_back();
+			return ptr;
+		}
+		return new char[POOL_BUFFER_SIZE];
+	}
+	else return new char[static_cast<std::size_t>(size)];
+}
+
+
+void ChannelBufferAllocator::deallocate(char* ptr, std::streamsize size) throw()
+{
+	if (size > Frame::FRAME_MAX_SIZE + 4)
+	{
+		try
+		{
+			Poco::FastMutex::ScopedLock lock(bufferPoolMutex);
+			if (bufferPool.size() < POOL_CAPACITY)
+			{
+				bufferPool.push_back(ptr);
+				return;
+			}
+		}
+		catch (...)
+		{
+		}
+	}
+	delete [] ptr;
+}
+
+
 //
 // ChannelStreamBuf
 //
 
 
 ChannelStreamBuf::ChannelStreamBuf(Connection::Ptr pConnection, Poco::UInt32 frameType, Poco::UInt32 channel, Poco::Timespan timeout):
-	Poco::BufferedStreamBuf(Frame::FRAME_MAX_PAYLOAD_SIZE + 4, std::ios::in),
+	Base(pConnection->maxPayloadSize() + 4, std::ios::in),
 	_pConnection(pConnection),
 	_pQueue(new FrameQueue(pConnection, frameType, channel)),
-	_timeout(timeout)
+	_timeout(timeout),
+	_readOffset(0)
 {
 	_pConnection->pushFrameHandler(_pQueue);
 }
 
 
 ChannelStreamBuf::ChannelStreamBuf(Connection::Ptr pConnection, Poco::UInt32 frameType, Poco::UInt32 channel, Poco::UInt16 flags):
-	Poco::BufferedStreamBuf(Frame::FRAME_MAX_PAYLOAD_SIZE, std::ios::out),
+	Base(pConnection->maxPayloadSize(), std::ios::out),
 	_pConnection(pConnection),
-	_pFrame(new Frame(frameType, channel, flags, Frame::FRAME_MAX_SIZE))
+	_pFrame(new Frame(frameType, channel, flags, Frame::FRAME_HEADER_SIZE)),
+	_readOffset(0)
 {
 }
 
@@ -49,6 +106,10 @@ ChannelStreamBuf::~ChannelStreamBuf()
 {
 	try
 	{
+		if (_pReadFrame)
+		{
+			_pConnection->returnFrame(_pReadFrame);
+		}
 		if (_pQueue)
 		{
 			_pConnection->popFrameHandler(_pQueue);
@@ -93,36 +154,38 @@ Connection::Ptr ChannelStreamBuf::connection()
 
 int ChannelStreamBuf::readFromDevice(char* buffer, std::streamsize length)
 {
-	if (_pQueue)
+	if (!_pReadFrame)
+	{
+		if (!_pQueue) return 0;
+		_pReadFrame = _pQueue->dequeueFrame(_timeout);
+		if (!_pReadFrame) return -1;
+		_readOffset = 0;
+	}
+
+	// A frame received from the peer may be larger than our
+	// buffer, so it may take more than one call to consume it.
+	std::size_t n = _pReadFrame->getPayloadSize() - _readOffset;
+	if (n > static_cast<std::size_t>(length)) n = static_cast<std::size_t>(length);
+	std::memcpy(buffer, _pReadFrame->payloadBegin() + _readOffset, n);
+	_readOffset += n;
+	if (_readOffset == _pReadFrame->getPayloadSize())
 	{
-		Frame::Ptr pFrame = _pQueue->dequeueFrame(_timeout);
-		if (pFrame)
+		bool eof = (_pReadFrame->flags() & Frame::FRAME_FLAG_EOM) != 0;
+		_pConnection->returnFrame(_pReadFrame);
+		_pReadFrame = 0;
+		if (eof)
 		{
-			poco_assert (length >= pFrame->getPayloadSize());
-			std::memcpy(buffer, pFrame->payloadBegin(), pFrame->getPayloadSize());
-			int n = static_cast<int>(pFrame->getPayloadSize());
-			bool eof = (pFrame->flags() & Frame::FRAME_FLAG_EOM) != 0;
-			_pConnection->returnFrame(pFrame);
-			if (eof)
-			{
-				_pConnection->popFrameHandler(_pQueue);
-				_pQueue = 0;
-			}
-			return n;
+			_pConnection->popFrameHandler(_pQueue);
+			_pQueue = 0;
 		}
-		else return -1;
 	}
-	else return 0;
+	return static_cast<int>(n);
 }
 
 
 int ChannelStreamBuf::writeToDevice(const char* buffer, std::streamsize length)
 {
-	poco_assert (length <= _pFrame->maxPayloadSize());
-
-	std::memcpy(_pFrame->payloadBegin(), buffer, static_cast<std::size_t>(length));
-	_pFrame->setPayloadSize(static_cast<Poco::UInt16>(length));
-	_pConnection->sendFrame(_pFrame);
+	_pConnection->sendFrame(_pFrame, buffer, static_cast<Poco::UInt16>(length));
 	_pFrame->updateFlags(_pFrame->flags() | Frame::FRAME_FLAG_CONT);
 	return static_cast<int>(length);
 }
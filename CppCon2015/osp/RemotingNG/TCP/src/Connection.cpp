@@ -20,9 +20,18 @@
 #include "Poco/BinaryReader.h"
 #include "Poco/BinaryWriter.h"
 #include "Poco/MemoryStream.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/Format.h"
+#include "Poco/Error.h"
 #include <cstring>
+#include <limits>
 #include <set>
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <errno.h>
+#endif
 
 
 namespace Poco {
@@ -40,6 +49,12 @@ Connection::Connection(const Poco::Net::StreamSocket& socket, ConnectionMode mod
 	_mode(mode),
 	_state(STATE_PRE_HANDSHAKE),
 	_framePool(256, 4096),
+	_mediumFramePool(FrameFactory(FRAME_MEDIUM_SIZE), 16, std::numeric_limits<std::size_t>::max()),
+	_largeFramePool(FrameFactory(Frame::FRAME_MAX_NEGOTIABLE_SIZE), 4, std::numeric_limits<std::size_t>::max()),
+	_maxFrameSize(Frame::FRAME_MAX_NEGOTIABLE_SIZE),
+	_peerMaxFrameSize(Frame::FRAME_MAX_SIZE),
+	_sendBuffer(0),
+	_messageIds(false),
 	_nextChannel(1),
 	_ready(false),
 	_logger(Poco::Logger::get("RemotingNG.TCP.Connection"))
@@ -50,6 +65,8 @@ Connection::Connection(const Poco::Net::StreamSocket& socket, ConnectionMode mod
 	
 	_frameHandlers.reserve(64);
 	_tmpFrameHandlers.reserve(64);
+
+	_capabilities.insert(Frame::CAPA_MESSAGE_IDS);
 }
 
 	
@@ -92,6 +109,32 @@ void Connection::sendFrame(Frame::Ptr pFrame)
 }
 
 
+void Connection::sendFrame(Frame::Ptr pHeader, const char* payload, Poco::UInt16 payloadSize)
+{
+	poco_assert (payloadSize <= maxPayloadSize());
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (_state == STATE_ESTABLISHED)
+	{
+		char header[Frame::FRAME_HEADER_SIZE];
+		pHeader->copyHeader(header, payloadSize);
+		if (_logger.debug())
+		{
+			std::string msg(Poco::format("Sending Frame, type=%08x, channel=%08x, flags=%04hx, psize=%hu",
+				pHeader->type(),
+				pHeader->channel(),
+				pHeader->flags(),
+				payloadSize));
+			_logger.dump(msg, payload, payloadSize);
+		}
+		sendFrameImpl(header, payload, payloadSize);
+		_lastFrame.update();
+	}
+	else throw Poco::IllegalStateException("Connection not in established state");
+}
+
+
 void Connection::sendProtocolFrame(Frame::Ptr pFrame)
 {
 	Poco::FastMutex::ScopedLock lock(_mutex);
@@ -110,6 +153,77 @@ void Connection::sendProtocolFrame(Frame::Ptr pFrame)
 }
 
 
+void Connection::sendFrameImpl(const char* header, const char* payload, std::size_t payloadSize)
+{
+#if defined(POCO_OS_FAMILY_UNIX)
+	if (!_socket.secure())
+	{
+		struct iovec iov[2];
+		iov[0].iov_base = const_cast<char*>(header);
+		iov[0].iov_len  = Frame::FRAME_HEADER_SIZE;
+		iov[1].iov_base = const_cast<char*>(payload);
+		iov[1].iov_len  = payloadSize;
+		struct msghdr msg;
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_iov    = iov;
+		msg.msg_iovlen = payloadSize > 0 ? 2 : 1;
+		int flags = 0;
+#if defined(MSG_NOSIGNAL)
+		flags |= MSG_NOSIGNAL;
+#endif
+		while (msg.msg_iovlen > 0)
+		{
+			ssize_t n = ::sendmsg(_socket.impl()->sockfd(), &msg, flags);
+			if (n < 0)
+			{
+				int err = errno;
+				if (err == EINTR) continue;
+				if (err == EAGAIN || err == EWOULDBLOCK) 
+					throw Poco::TimeoutException("Timeout sending frame");
+				else if (err == ECONNRESET || err == EPIPE)
+					throw Poco::Net::ConnectionResetException();
+				else
+					throw Poco::Net::NetException(Poco::Error::getMessage(err), err);
+			}
+			// skip the bytes already sent, in case of a partial write
+			while (n > 0 && msg.msg_iovlen > 0)
+			{
+				if (static_cast<std::size_t>(n) >= msg.msg_iov->iov_len)
+				{
+					n -= msg.msg_iov->iov_len;
+					++msg.msg_iov;
+					--msg.msg_iovlen;
+				}
+				else
+				{
+					msg.msg_iov->iov_base = static_cast<char*>(msg.msg_iov->iov_base) + n;
+					msg.msg_iov->iov_len -= n;
+					n = 0;
+				}
+			}
+		}
+		return;
+	}
+#endif
+	// No vectored I/O available - copy header and payload to a
+	// contiguous buffer, so that the frame is sent with a single write.
+	std::size_t frameSize = Frame::FRAME_HEADER_SIZE + payloadSize;
+	if (_sendBuffer.size() < frameSize) _sendBuffer.resize(frameSize, false);
+	std::memcpy(_sendBuffer.begin(), header, Frame::FRAME_HEADER_SIZE);
+	if (payloadSize > 0) std::memcpy(_sendBuffer.begin() + Frame::FRAME_HEADER_SIZE, payload, payloadSize);
+	_socket.sendBytes(_sendBuffer.begin(), static_cast<int>(frameSize));
+}
+
+
+void Connection::setMaxFrameSize(Poco::UInt16 size)
+{
+	poco_assert (size >= Frame::FRAME_MAX_SIZE);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_maxFrameSize = size;
+}
+
+
 void Connection::addCapability(Poco::UInt32 capability)
 {
 	Poco::FastMutex::ScopedLock lock(_mutex);
@@ -131,6 +245,61 @@ bool Connection::peerHasCapability(Poco::UInt32 capability)
 }
 
 
+Poco::UInt32 Connection::endpointHandle(const std::string& oid, const std::string& tid)
+{
+	Poco::FastMutex::ScopedLock lock(_endpointMutex);
+
+	std::pair<std::string, std::string> key(oid, tid);
+	EndpointHandleMap::const_iterator it = _endpointHandles.find(key);
+	if (it != _endpointHandles.end()) return it->second;
+	if (_endpointHandles.size() >= MAX_ENDPOINT_HANDLES) return 0;
+	Poco::UInt32 handle = static_cast<Poco::UInt32>(_endpointHandles.size() + 1);
+	_endpointHandles[key] = handle;
+	_confirmedEndpointHandles.push_back(false);
+	return handle;
+}
+
+
+void Connection::confirmEndpointHandle(Poco::UInt32 handle)
+{
+	Poco::FastMutex::ScopedLock lock(_endpointMutex);
+
+	poco_assert (handle > 0 && handle <= _confirmedEndpointHandles.size());
+	_confirmedEndpointHandles[handle - 1] = true;
+}
+
+
+bool Connection::endpointHandleConfirmed(Poco::UInt32 handle) const
+{
+	Poco::FastMutex::ScopedLock lock(_endpointMutex);
+
+	return handle > 0 && handle <= _confirmedEndpointHandles.size() && _confirmedEndpointHandles[handle - 1];
+}
+
+
+void Connection::definePeerEndpoint(Poco::UInt32 handle, PeerEndpoint::Ptr pEndpoint)
+{
+	if (handle == 0 || handle > MAX_ENDPOINT_HANDLES)
+		throw Poco::RemotingNG::ProtocolException(Poco::format("Invalid endpoint handle: %u", handle));
+
+	Poco::FastMutex::ScopedLock lock(_endpointMutex);
+
+	if (handle > _peerEndpoints.size()) _peerEndpoints.resize(handle);
+	_peerEndpoints[handle - 1] = pEndpoint;
+}
+
+
+PeerEndpoint::Ptr Connection::findPeerEndpoint(Poco::UInt32 handle) const
+{
+	Poco::FastMutex::ScopedLock lock(_endpointMutex);
+
+	if (handle > 0 && handle <= _peerEndpoints.size())
+		return _peerEndpoints[handle - 1];
+	else
+		return PeerEndpoint::Ptr();
+}
+
+
 Poco::Net::SocketAddress Connection::remoteAddress() const
 {
 	return _socket.peerAddress();
@@ -217,6 +386,22 @@ void Connection::popFrameHandler(Poco::AutoPtr<FrameHandler> pHandler)
 }
 
 
+void Connection::registerChannelHandler(Poco::UInt32 channel, Poco::AutoPtr<FrameHandler> pHandler)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	
+	_channelHandlers[channel] = pHandler;
+}
+
+	
+void Connection::unregisterChannelHandler(Poco::UInt32 channel)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	
+	_channelHandlers.erase(channel);
+}
+
+
 bool Connection::waitReady(Poco::Timespan timeout)
 {
 	return _ready.tryWait(static_cast<long>(timeout.totalMilliseconds()));
@@ -267,6 +452,7 @@ void Connection::runImpl()
 		_logger.debug("Connection established with " + remoteAddress().toString());
 	}
 
+	_messageIds = hasCapability(Frame::CAPA_MESSAGE_IDS) && peerHasCapability(Frame::CAPA_MESSAGE_IDS);
 	_state = STATE_ESTABLISHED;
 	connectionEstablished(pThis);
 	_ready.set();
@@ -289,13 +475,13 @@ void Connection::runImpl()
 		}
 		catch (Poco::Exception& exc)
 		{
-			if (pFrame) _framePool.returnObject(pFrame);
+			if (pFrame) returnFrame(pFrame);
 			_state = STATE_ABORTED;
 			_logger.error("Aborting connection due to exception: " + exc.displayText());
 		}
 		catch (...)
 		{
-			if (pFrame) _framePool.returnObject(pFrame);
+			if (pFrame) returnFrame(pFrame);
 			_state = STATE_ABORTED;
 			_logger.error("Aborting connection due to unknown exception.");
 		}
@@ -347,26 +533,29 @@ void Connection::processFrame(Frame::Ptr pFrame)
 	else
 	{
 		Connection::Ptr pThis(this, true);
+		FrameHandler::Ptr pChannelHandler;
 		{
 			Poco::FastMutex::ScopedLock lock(_mutex);
-			_tmpFrameHandlers = _frameHandlers;
+			ChannelHandlerMap::iterator it = _channelHandlers.find(pFrame->channel());
+			if (it != _channelHandlers.end())
+				pChannelHandler = it->second;
+			else
+				_tmpFrameHandlers = _frameHandlers;
 		}
 		bool handled = false;
-		for (FrameHandlerVec::reverse_iterator it = _tmpFrameHandlers.rbegin(); !handled && it != _tmpFrameHandlers.rend(); ++it)
+		if (pChannelHandler)
 		{
-			try
+			handled = dispatchFrame(pThis, pChannelHandler, pFrame);
+			if (!handled)
 			{
-				handled = (*it)->handleFrame(pThis, pFrame);
-			}
-			catch (Poco::Exception& exc)
-			{
-				_logger.warning("Frame handler exception: " + exc.displayText());
-			}
-			catch (...)
-			{
-				_logger.warning("Frame handler exception.");
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				_tmpFrameHandlers = _frameHandlers;
 			}
 		}
+		for (FrameHandlerVec::reverse_iterator it = _tmpFrameHandlers.rbegin(); !handled && it != _tmpFrameHandlers.rend(); ++it)
+		{
+			handled = dispatchFrame(pThis, *it, pFrame);
+		}
 		_tmpFrameHandlers.clear();
 		if (handled)
 		{
@@ -377,7 +566,25 @@ void Connection::processFrame(Frame::Ptr pFrame)
 			_logger.warning(Poco::format("No handler for frame with type=%08x, channel=%08x.", pFrame->type(), pFrame->channel()));
 		}
 	}
-	_framePool.returnObject(pFrame);
+	returnFrame(pFrame);
+}
+
+
+bool Connection::dispatchFrame(Connection::Ptr pThis, FrameHandler::Ptr pHandler, Frame::Ptr pFrame)
+{
+	try
+	{
+		return pHandler->handleFrame(pThis, pFrame);
+	}
+	catch (Poco::Exception& exc)
+	{
+		_logger.warning("Frame handler exception: " + exc.displayText());
+	}
+	catch (...)
+	{
+		_logger.warning("Frame handler exception.");
+	}
+	return false;
 }
 
 
@@ -410,16 +617,24 @@ void Connection::receiveHELO()
 					{
 						Poco::UInt32 cap(0);
 						reader >> cap;
-						_peerCapabilities.insert(cap);
+						if ((cap & ~Frame::CAPA_VALUE_MASK) == Frame::CAPA_MAX_FRAME_SIZE)
+						{
+							Poco::UInt16 peerMaxFrameSize = static_cast<Poco::UInt16>(cap & Frame::CAPA_VALUE_MASK);
+							if (peerMaxFrameSize > Frame::FRAME_MAX_SIZE) _peerMaxFrameSize = peerMaxFrameSize;
+						}
+						else
+						{
+							_peerCapabilities.insert(cap);
+						}
 					}
-					_framePool.returnObject(pFrame);
+					returnFrame(pFrame);
 					return;
 				}
 				else throw Poco::RemotingNG::ProtocolException(Poco::format("Unexpected frame received: %08x", pFrame->type()));
 			}
 			catch (...)
 			{
-				_framePool.returnObject(pFrame);
+				returnFrame(pFrame);
 				throw;
 			}
 		}
@@ -436,12 +651,13 @@ void Connection::sendHELO()
 	Poco::UInt8 majorVersion(Frame::PROTO_MAJOR_VERSION);
 	Poco::UInt8 minorVersion(Frame::PROTO_MINOR_VERSION);
 	Poco::UInt8 flags(0);
-	Poco::UInt8 nCaps(_capabilities.size());
+	Poco::UInt8 nCaps(_capabilities.size() + 1);
 	writer << majorVersion << minorVersion << flags << nCaps;
 	for (std::set<Poco::UInt32>::const_iterator it = _capabilities.begin(); it != _capabilities.end(); ++it)
 	{
 		writer << *it;
 	}
+	writer << static_cast<Poco::UInt32>(Frame::CAPA_MAX_FRAME_SIZE | _maxFrameSize);
 	pFrame->setPayloadSize(static_cast<Poco::UInt16>(ostr.charsWritten()));
 	sendProtocolFrame(pFrame);
 }
@@ -465,10 +681,10 @@ void Connection::receiveBYE()
 				}
 				catch (...)
 				{
-					_framePool.returnObject(pFrame);
+					returnFrame(pFrame);
 					throw;
 				}
-				_framePool.returnObject(pFrame);
+				returnFrame(pFrame);
 			}
 		}
 		catch (Poco::Exception&)
@@ -507,6 +723,16 @@ Frame::Ptr Connection::receiveFrame()
 		if (pFrame)
 		{
 			std::memcpy(pFrame->bufferBegin(), header, Frame::FRAME_HEADER_SIZE);
+			Poco::UInt16 payloadSize = pFrame->getPayloadSize();
+			if (payloadSize > pFrame->maxPayloadSize() && payloadSize <= _maxFrameSize - Frame::FRAME_HEADER_SIZE)
+			{
+				_framePool.returnObject(pFrame);
+				if (payloadSize <= FRAME_MEDIUM_SIZE - Frame::FRAME_HEADER_SIZE)
+					pFrame = _mediumFramePool.borrowObject();
+				else
+					pFrame = _largeFramePool.borrowObject();
+				std::memcpy(pFrame->bufferBegin(), header, Frame::FRAME_HEADER_SIZE);
+			}
 			if (pFrame->getPayloadSize() > 0)
 			{
 				try
@@ -519,7 +745,7 @@ Frame::Ptr Connection::receiveFrame()
 				}
 				catch (...)
 				{
-					_framePool.returnObject(pFrame);
+					returnFrame(pFrame);
 					throw;
 				}
 			}
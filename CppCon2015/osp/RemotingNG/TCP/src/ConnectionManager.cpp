@@ -15,8 +15,10 @@
 
 
 #include "Poco/RemotingNG/TCP/ConnectionManager.h"
+#include "Poco/RemotingNG/TCP/ServerTransport.h"
 #include "Poco/SingletonHolder.h"
 #include "Poco/ScopedUnlock.h"
+#include "Poco/ErrorHandler.h"
 
 
 namespace Poco {
@@ -27,7 +29,9 @@ namespace TCP {
 ConnectionManager::ConnectionManager(Poco::ThreadPool& threadPool):
 	_pSocketFactory(new SocketFactory),
 	_idleTimeout(DEFAULT_IDLE_TIMEOUT, 0),
-	_threadPool(threadPool)
+	_threadPool(threadPool),
+	_dispatcher(*this, &ConnectionManager::runDispatched),
+	_activeDispatchers(0)
 {
 }
 
@@ -35,7 +39,9 @@ ConnectionManager::ConnectionManager(Poco::ThreadPool& threadPool):
 ConnectionManager::ConnectionManager(SocketFactory::Ptr pSocketFactory, Poco::ThreadPool& threadPool):
 	_pSocketFactory(pSocketFactory),
 	_idleTimeout(DEFAULT_IDLE_TIMEOUT, 0),
-	_threadPool(threadPool)
+	_threadPool(threadPool),
+	_dispatcher(*this, &ConnectionManager::runDispatched),
+	_activeDispatchers(0)
 {
 }
 
@@ -169,6 +175,66 @@ void ConnectionManager::shutdown()
 }
 
 
+void ConnectionManager::dispatch(Poco::AutoPtr<ServerTransport> pServerTransport)
+{
+	Poco::FastMutex::ScopedLock lock(_dispatchMutex);
+
+	_dispatchQueue.push_back(pServerTransport);
+	try
+	{
+		_threadPool.start(_dispatcher);
+		_activeDispatchers++;
+	}
+	catch (Poco::NoThreadAvailableException&)
+	{
+		// A dispatcher thread only stops after finding the queue
+		// empty while holding _dispatchMutex, so any active
+		// dispatcher is guaranteed to pick up the request.
+		if (_activeDispatchers == 0)
+		{
+			_dispatchQueue.pop_back();
+			throw;
+		}
+	}
+}
+
+
+void ConnectionManager::runDispatched()
+{
+	for (;;)
+	{
+		Poco::AutoPtr<ServerTransport> pServerTransport;
+		{
+			Poco::FastMutex::ScopedLock lock(_dispatchMutex);
+
+			if (_dispatchQueue.empty())
+			{
+				_activeDispatchers--;
+				return;
+			}
+			pServerTransport = _dispatchQueue.front();
+			_dispatchQueue.pop_front();
+		}
+		try
+		{
+			pServerTransport->run();
+		}
+		catch (Poco::Exception& exc)
+		{
+			Poco::ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			Poco::ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			Poco::ErrorHandler::handle();
+		}
+	}
+}
+
+
 Connection::Ptr ConnectionManager::createConnection(const Poco::URI& endpointURI)
 {
 	Poco::Net::StreamSocket ss = _pSocketFactory->createSocket(endpointURI);
@@ -15,6 +15,7 @@
 
 
 #include "Poco/RemotingNG/TCP/Frame.h"
+#include <cstring>
 
 
 namespace Poco {
@@ -39,4 +40,11 @@ Frame::~Frame()
 }
 
 
+void Frame::copyHeader(char* header, Poco::UInt16 payloadSize) const
+{
+	std::memcpy(header, _buffer.begin(), FRAME_OFFSET_PAYLOAD);
+	*reinterpret_cast<Poco::UInt16*>(header + FRAME_OFFSET_SIZE) = Poco::ByteOrder::toNetwork(payloadSize);
+}
+
+
 } } } // namespace Poco::RemotingNG::TCP
@@ -42,7 +42,6 @@ public:
 	{
 		if (pFrame->type() == Frame::FRAME_TYPE_EVNT && (pFrame->flags() & Frame::FRAME_FLAG_CONT) == 0)
 		{
-			Poco::SharedPtr<ChannelInputStream> pRequestStream = new ChannelInputStream(pConnection, pFrame->type(), pFrame->channel(), _pListener->getTimeout());
 			Poco::SharedPtr<ChannelOutputStream> pReplyStream;
 			if ((pFrame->flags() & Frame::FRAME_FLAG_ONEWAY) == 0)
 			{
@@ -51,11 +50,19 @@ public:
 					flags |= Frame::FRAME_FLAG_DEFLATE;
 				pReplyStream = new ChannelOutputStream(pConnection, Frame::FRAME_TYPE_EVNR, pFrame->channel(), flags);
 			}
-			ServerTransport::Ptr pServerTransport = new ServerTransport(*_pListener, pRequestStream, pReplyStream, (pFrame->flags() & Frame::FRAME_FLAG_DEFLATE) != 0);
-			_pListener->connectionManager().threadPool().start(*pServerTransport);
-			Poco::Thread::yield();
-			pServerTransport->waitReady();
-			pRequestStream->rdbuf()->queue()->handleFrame(pConnection, pFrame);
+			bool compressed = (pFrame->flags() & Frame::FRAME_FLAG_DEFLATE) != 0;
+			if (pFrame->flags() & Frame::FRAME_FLAG_EOM)
+			{
+				ServerTransport::Ptr pServerTransport = new ServerTransport(*_pListener, pConnection, pFrame, pReplyStream, compressed);
+				pServerTransport->start();
+			}
+			else
+			{
+				Poco::SharedPtr<ChannelInputStream> pRequestStream = new ChannelInputStream(pConnection, pFrame->type(), pFrame->channel(), _pListener->getTimeout());
+				ServerTransport::Ptr pServerTransport = new ServerTransport(*_pListener, pConnection, pRequestStream, pReplyStream, compressed);
+				pServerTransport->start();
+				pRequestStream->rdbuf()->queue()->handleFrame(pConnection, pFrame);
+			}
 			return true;
 		}
 		else return false;
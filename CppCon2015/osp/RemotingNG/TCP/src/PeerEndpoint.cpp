@@ -0,0 +1,51 @@
+//
+// PeerEndpoint.cpp
+//
+// $Id$
+//
+// Library: RemotingNG/TCP
+// Package: TCP
+// Module:  PeerEndpoint
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "Poco/RemotingNG/TCP/PeerEndpoint.h"
+#include "Poco/RemotingNG/TCP/Transport.h"
+
+
+namespace Poco {
+namespace RemotingNG {
+namespace TCP {
+
+
+PeerEndpoint::PeerEndpoint(const std::string& oid, const std::string& tid):
+	_isEvent(oid.find('#') != std::string::npos)
+{
+	_path.reserve(Transport::PROTOCOL.size() + tid.size() + oid.size() + 2);
+	_path += Transport::PROTOCOL;
+	_path += '/';
+	_path += tid;
+	_path += '/';
+	_path += oid;
+}
+
+
+PeerEndpoint::PeerEndpoint(const PeerEndpoint& endpoint, const std::string& objectPath):
+	_path(endpoint._path),
+	_objectPath(objectPath),
+	_isEvent(endpoint._isEvent)
+{
+}
+
+
+PeerEndpoint::~PeerEndpoint()
+{
+}
+
+
+} } } // namespace Poco::RemotingNG::TCP
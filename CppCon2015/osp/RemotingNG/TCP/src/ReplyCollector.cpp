@@ -0,0 +1,195 @@
+//
+// ReplyCollector.cpp
+//
+// $Id$
+//
+// Library: RemotingNG/TCP
+// Package: TCP
+// Module:  ReplyCollector
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "Poco/RemotingNG/TCP/ReplyCollector.h"
+#include "Poco/RemotingNG/BinaryDeserializer.h"
+#include "Poco/RemotingNG/RemotingException.h"
+#include "Poco/InflatingStream.h"
+#include "Poco/MemoryStream.h"
+#include "Poco/Delegate.h"
+
+
+namespace Poco {
+namespace RemotingNG {
+namespace TCP {
+
+
+class ReplyCollector::TimeoutTask: public TimerTask
+	/// Calls ReplyCollector::onTimeout() when run.
+	///
+	/// The reference to the ReplyCollector is dropped by release(),
+	/// so that a finished ReplyCollector is not kept alive until
+	/// the Timer discards the task.
+{
+public:
+	typedef Poco::AutoPtr<TimeoutTask> Ptr;
+
+	TimeoutTask(ReplyCollector::Ptr pCollector):
+		_pCollector(pCollector)
+	{
+	}
+
+	void release()
+	{
+		cancel();
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_pCollector = 0;
+	}
+
+	void run()
+	{
+		ReplyCollector::Ptr pCollector;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			pCollector.swap(_pCollector);
+		}
+		if (pCollector) pCollector->onTimeout();
+	}
+
+private:
+	ReplyCollector::Ptr _pCollector;
+	Poco::FastMutex _mutex;
+};
+
+
+ReplyCollector::ReplyCollector(Connection::Ptr pConnection, Poco::UInt32 frameType, Poco::UInt32 channel, bool compressed, Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler, Poco::UInt32 endpointHandle):
+	_pConnection(pConnection),
+	_frameType(frameType),
+	_channel(channel),
+	_compressed(compressed),
+	_pReplyHandler(pReplyHandler),
+	_endpointHandle(endpointHandle)
+{
+	poco_check_ptr (_pReplyHandler);
+}
+
+
+ReplyCollector::~ReplyCollector()
+{
+}
+
+
+void ReplyCollector::start(Timer& timer, const Poco::Timespan& timeout)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		_pTimeoutTask = new TimeoutTask(ReplyCollector::Ptr(this, true));
+	}
+	_pConnection->connectionClosed += Poco::delegate(this, &ReplyCollector::onConnectionClosed);
+	_pConnection->connectionAborted += Poco::delegate(this, &ReplyCollector::onConnectionClosed);
+	_pConnection->registerChannelHandler(_channel, FrameHandler::Ptr(this, true));
+
+	// The connection may have been closed before we subscribed to its events.
+	Connection::ConnectionState state = _pConnection->state();
+	if (state != Connection::STATE_ESTABLISHED)
+	{
+		cancel();
+		throw Poco::RemotingNG::RemotingException("Connection has been closed");
+	}
+	timer.schedule(_pTimeoutTask, static_cast<long>(timeout.totalMilliseconds()));
+}
+
+
+void ReplyCollector::cancel()
+{
+	finish();
+}
+
+
+bool ReplyCollector::handleFrame(Connection::Ptr pConnection, Frame::Ptr pFrame)
+{
+	poco_assert_dbg (pConnection == _pConnection);
+
+	if (pFrame->type() == _frameType && pFrame->channel() == _channel)
+	{
+		_message.append(pFrame->payloadBegin(), pFrame->getPayloadSize());
+		bool eom = (pFrame->flags() & Frame::FRAME_FLAG_EOM) != 0;
+		pConnection->returnFrame(pFrame);
+		if (eom)
+		{
+			Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler = finish();
+			if (pReplyHandler)
+			{
+				if (_endpointHandle != 0) pConnection->confirmEndpointHandle(_endpointHandle);
+				try
+				{
+					Poco::MemoryInputStream istr(_message.data(), _message.size());
+					BinaryDeserializer deserializer;
+					if (_compressed)
+					{
+						Poco::InflatingInputStream inflater(istr);
+						deserializer.setup(inflater);
+						pReplyHandler->handleReply(deserializer);
+					}
+					else
+					{
+						deserializer.setup(istr);
+						pReplyHandler->handleReply(deserializer);
+					}
+				}
+				catch (Poco::Exception& exc)
+				{
+					pReplyHandler->handleError(exc);
+				}
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+
+Poco::RemotingNG::ReplyHandler::Ptr ReplyCollector::finish()
+{
+	// the Connection may hold the last reference to us
+	FrameHandler::Ptr pThis(this, true);
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler = _pReplyHandler;
+	if (pReplyHandler)
+	{
+		_pReplyHandler = 0;
+		_pConnection->connectionClosed -= Poco::delegate(this, &ReplyCollector::onConnectionClosed);
+		_pConnection->connectionAborted -= Poco::delegate(this, &ReplyCollector::onConnectionClosed);
+		_pConnection->unregisterChannelHandler(_channel);
+		_pConnection->releaseChannel(_channel);
+		_pTimeoutTask->release();
+	}
+	return pReplyHandler;
+}
+
+
+void ReplyCollector::onConnectionClosed(const void* pSender, Connection::Ptr& pConnection)
+{
+	Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler = finish();
+	if (pReplyHandler)
+	{
+		pReplyHandler->handleError(Poco::RemotingNG::RemotingException("Connection closed before reply was received"));
+	}
+}
+
+
+void ReplyCollector::onTimeout()
+{
+	Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler = finish();
+	if (pReplyHandler)
+	{
+		pReplyHandler->handleError(Poco::TimeoutException("No reply received within timeout"));
+	}
+}
+
+
+} } } // namespace Poco::RemotingNG::TCP
@@ -44,7 +44,6 @@ public:
 	{
 		if (pFrame->type() == Frame::FRAME_TYPE_REQU && (pFrame->flags() & Frame::FRAME_FLAG_CONT) == 0)
 		{
-			Poco::SharedPtr<ChannelInputStream> pRequestStream = new ChannelInputStream(pConnection, pFrame->type(), pFrame->channel(), _pListener->getTimeout());
 			Poco::SharedPtr<ChannelOutputStream> pReplyStream;
 			if ((pFrame->flags() & Frame::FRAME_FLAG_ONEWAY) == 0)
 			{
@@ -53,11 +52,21 @@ public:
 					flags |= Frame::FRAME_FLAG_DEFLATE;
 				pReplyStream = new ChannelOutputStream(pConnection, Frame::FRAME_TYPE_REPL, pFrame->channel(), flags);
 			}
-			ServerTransport::Ptr pServerTransport = new ServerTransport(*_pListener, pRequestStream, pReplyStream, (pFrame->flags() & Frame::FRAME_FLAG_DEFLATE) != 0);
-			_pListener->connectionManager().threadPool().start(*pServerTransport);
-			Poco::Thread::yield();
-			pServerTransport->waitReady();
-			pRequestStream->rdbuf()->queue()->handleFrame(pConnection, pFrame);
+			bool compressed = (pFrame->flags() & Frame::FRAME_FLAG_DEFLATE) != 0;
+			if (pFrame->flags() & Frame::FRAME_FLAG_EOM)
+			{
+				// Common case: the complete request fits into a single frame,
+				// which is passed to the ServerTransport directly.
+				ServerTransport::Ptr pServerTransport = new ServerTransport(*_pListener, pConnection, pFrame, pReplyStream, compressed);
+				pServerTransport->start();
+			}
+			else
+			{
+				Poco::SharedPtr<ChannelInputStream> pRequestStream = new ChannelInputStream(pConnection, pFrame->type(), pFrame->channel(), _pListener->getTimeout());
+				ServerTransport::Ptr pServerTransport = new ServerTransport(*_pListener, pConnection, pRequestStream, pReplyStream, compressed);
+				pServerTransport->start();
+				pRequestStream->rdbuf()->queue()->handleFrame(pConnection, pFrame);
+			}
 			return true;
 		}
 		else return false;
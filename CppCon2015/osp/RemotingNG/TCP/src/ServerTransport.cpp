@@ -19,6 +19,8 @@
 #include "Poco/RemotingNG/TCP/Transport.h"
 #include "Poco/RemotingNG/ORB.h"
 #include "Poco/RemotingNG/Context.h"
+#include "Poco/MemoryStream.h"
+#include "Poco/Format.h"
 
 
 namespace Poco {
@@ -26,13 +28,53 @@ namespace RemotingNG {
 namespace TCP {
 
 
-ServerTransport::ServerTransport(Listener& listener, const Poco::SharedPtr<ChannelInputStream>& pRequestStream, const Poco::SharedPtr<ChannelOutputStream>& pReplyStream, bool compressed):
+ServerTransport::ServerTransport(Listener& listener, Connection::Ptr pConnection, const Poco::SharedPtr<ChannelInputStream>& pRequestStream, const Poco::SharedPtr<ChannelOutputStream>& pReplyStream, bool compressed):
 	_listener(listener),
+	_pConnection(pConnection),
 	_pRequestStream(pRequestStream),
 	_pReplyStream(pReplyStream),
 	_pInflater(0),
 	_pDeflater(0),
 	_logger(Poco::Logger::get("RemotingNG.TCP.ServerTransport"))
+{
+	setupStreams(compressed);
+}
+
+
+ServerTransport::ServerTransport(Listener& listener, Connection::Ptr pConnection, Frame::Ptr pRequestFrame, const Poco::SharedPtr<ChannelOutputStream>& pReplyStream, bool compressed):
+	_listener(listener),
+	_pConnection(pConnection),
+	_pRequestFrame(pRequestFrame),
+	_pRequestStream(new Poco::MemoryInputStream(pRequestFrame->payloadBegin(), pRequestFrame->getPayloadSize())),
+	_pReplyStream(pReplyStream),
+	_pInflater(0),
+	_pDeflater(0),
+	_logger(Poco::Logger::get("RemotingNG.TCP.ServerTransport"))
+{
+	setupStreams(compressed);
+}
+
+	
+ServerTransport::~ServerTransport()
+{
+	delete _pInflater;
+	delete _pDeflater;
+	_pRequestStream = 0;
+	if (_pRequestFrame)
+	{
+		try
+		{
+			_pConnection->returnFrame(_pRequestFrame);
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+	}
+}
+
+
+void ServerTransport::setupStreams(bool compressed)
 {
 	if (compressed)
 	{
@@ -44,17 +86,19 @@ ServerTransport::ServerTransport(Listener& listener, const Poco::SharedPtr<Chann
 	}
 }
 
-	
-ServerTransport::~ServerTransport()
-{
-	delete _pInflater;
-	delete _pDeflater;
-}
 
-	
-void ServerTransport::waitReady()
+void ServerTransport::start()
 {
-	_ready.wait();
+	try
+	{
+		_listener.connectionManager().dispatch(Ptr(this, true));
+	}
+	catch (...)
+	{
+		// the caller still owns the request frame
+		_pRequestFrame = 0;
+		throw;
+	}
 }
 
 
@@ -91,30 +135,57 @@ void ServerTransport::endRequest()
 
 void ServerTransport::run()
 {
-	Ptr pThis(this, true);
-	_ready.set();
-
 	Poco::RemotingNG::ScopedContext scopedContext;
 	scopedContext.context()->setValue("transport", Transport::PROTOCOL);
-	scopedContext.context()->setValue("remoteAddress", _pRequestStream->rdbuf()->connection()->remoteAddress());
-	scopedContext.context()->setValue("localAddress", _pRequestStream->rdbuf()->connection()->localAddress());
-	scopedContext.context()->setValue("id", _pRequestStream->rdbuf()->connection()->id());
+	scopedContext.context()->setValue("remoteAddress", _pConnection->remoteAddress());
+	scopedContext.context()->setValue("localAddress", _pConnection->localAddress());
+	scopedContext.context()->setValue("id", _pConnection->id());
 
 	if (_pInflater)
 		_deserializer.setup(*_pInflater);
 	else
 		_deserializer.setup(*_pRequestStream);
+
+	PeerEndpoint::Ptr pEndpoint;
+	Poco::UInt32 handle(0);
 	std::string oid;
 	std::string tid;
-	_deserializer.deserializeEndPoint(oid, tid);
-	std::string path = Transport::PROTOCOL;
-	path += '/';
-	path += tid;
-	path += '/';
-	path += oid;
+	if (_pConnection->messageIdsEnabled())
+	{
+		_serializer.enableMessageIds(true);
+		if (_deserializer.deserializeEndPoint(handle, oid, tid))
+		{
+			pEndpoint = new PeerEndpoint(oid, tid);
+			if (handle > Connection::MAX_ENDPOINT_HANDLES)
+			{
+				sendFault("Invalid endpoint handle");
+				return;
+			}
+			else if (handle != 0)
+			{
+				_pConnection->definePeerEndpoint(handle, pEndpoint);
+			}
+		}
+		else
+		{
+			pEndpoint = _pConnection->findPeerEndpoint(handle);
+			if (!pEndpoint)
+			{
+				_logger.error(Poco::format("Unknown endpoint handle: %u", handle));
+				sendFault("Unknown endpoint handle");
+				return;
+			}
+		}
+	}
+	else
+	{
+		_deserializer.deserializeEndPoint(oid, tid);
+		pEndpoint = new PeerEndpoint(oid, tid);
+	}
+	const std::string& path = pEndpoint->path();
 	
 	Poco::RemotingNG::ORB& orb = Poco::RemotingNG::ORB::instance();
-	if (oid.find('#') != std::string::npos)
+	if (pEndpoint->isEvent())
 	{
 		if (_logger.debug()) 
 		{
@@ -128,9 +199,7 @@ void ServerTransport::run()
 		else
 		{
 			_logger.error("Unknown event subscriber: " + path);
-			RemotingException exc("Unknown event subscriber");
-			sendReply(Poco::RemotingNG::SerializerBase::MESSAGE_FAULT).serializeFaultMessage("fault", exc);
-			endRequest();
+			sendFault("Unknown event subscriber");
 		}
 	}
 	else
@@ -139,17 +208,38 @@ void ServerTransport::run()
 		{
 			_logger.debug("Dispatching request to service object: " + path);
 		}
-				
-		bool serviceFound = orb.invoke(_listener, path, *this);
+
+		// The object path a handle resolves to is cached with
+		// the handle, so the URI needs to be resolved only once.
+		bool serviceFound = false;
+		if (!pEndpoint->objectPath().empty())
+		{
+			serviceFound = orb.invoke(pEndpoint->objectPath(), *this);
+		}
+		if (!serviceFound)
+		{
+			std::string objectPath;
+			serviceFound = orb.invoke(_listener, path, *this, objectPath);
+			if (serviceFound && handle != 0 && objectPath != pEndpoint->objectPath())
+			{
+				_pConnection->definePeerEndpoint(handle, new PeerEndpoint(*pEndpoint, objectPath));
+			}
+		}
 		if (!serviceFound)
 		{
 			_logger.error("Unknown service object: " + path);
-			RemotingException exc("Unknown service");
-			sendReply(Poco::RemotingNG::SerializerBase::MESSAGE_FAULT).serializeFaultMessage("fault", exc);
-			endRequest();
+			sendFault("Unknown service");
 		}
 	}
 }
 
 
+void ServerTransport::sendFault(const std::string& message)
+{
+	RemotingException exc(message);
+	sendReply(Poco::RemotingNG::SerializerBase::MESSAGE_FAULT).serializeFaultMessage("fault", exc);
+	endRequest();
+}
+
+
 } } } // namespace Poco::RemotingNG::TCP
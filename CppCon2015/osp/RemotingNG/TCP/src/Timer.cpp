@@ -231,6 +231,14 @@ void Timer::cancel(bool wait)
 }
 
 
+void Timer::schedule(TimerTask::Ptr pTask, long delay)
+{
+	Poco::Timestamp time;
+	time += static_cast<Poco::Timestamp::TimeDiff>(delay)*1000;
+	_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
+}
+
+
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, long delay, long interval)
 {
 	Poco::Timestamp time;
@@ -17,6 +17,7 @@
 #include "Poco/RemotingNG/TCP/Transport.h"
 #include "Poco/RemotingNG/TCP/ConnectionManager.h"
 #include "Poco/RemotingNG/TCP/ChannelStream.h"
+#include "Poco/RemotingNG/TCP/ReplyCollector.h"
 #include "Poco/RemotingNG/RemotingException.h"
 #include "Poco/NullStream.h"
 #include "Poco/InflatingStream.h"
@@ -39,6 +40,10 @@ Transport::Transport(ConnectionManager& connectionManager):
 	_timeout(DEFAULT_TIMEOUT, 0),
 	_compression(false),
 	_channel(0),
+	_endpointConnectionId(0),
+	_endpointHandle(0),
+	_endpointConfirmed(false),
+	_requestEndpointHandle(0),
 	_logger(Poco::Logger::get("RemotingNG.TCP.Transport"))
 {
 }
@@ -136,6 +141,7 @@ void Transport::sendMessage(const Poco::RemotingNG::Identifiable::ObjectId& /*oi
 	_pRequestStream = 0;
 	_pConnection->releaseChannel(_channel);
 	_channel = 0;
+	_requestEndpointHandle = 0;
 }
 
 
@@ -160,22 +166,7 @@ Poco::RemotingNG::Deserializer& Transport::sendRequest(const Poco::RemotingNG::I
 	// race condition (no reply handler registered) with fast
 	// connections.
 	
-	Poco::UInt32 frameType = 0;
-	switch (messageType)
-	{
-	case Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST:
-		frameType = Frame::FRAME_TYPE_REPL;
-		break;
-	
-	case Poco::RemotingNG::SerializerBase::MESSAGE_EVENT:
-		frameType = Frame::FRAME_TYPE_EVNR;
-		break;
-	
-	default:
-		poco_bugcheck();
-	}
-
-	_pReplyStream = new ChannelInputStream(_pConnection, frameType, _channel, _timeout);
+	_pReplyStream = new ChannelInputStream(_pConnection, replyFrameType(messageType), _channel, _timeout);
 
 	if (_pDeflatingStream)
 	{
@@ -206,12 +197,69 @@ void Transport::endRequest()
 	_deserializer.reset();
 	_pReplyStream = 0;
 	_pInflatingStream = 0;
+	if (_requestEndpointHandle != 0)
+	{
+		_pConnection->confirmEndpointHandle(_requestEndpointHandle);
+		_endpointConfirmed = true;
+		_requestEndpointHandle = 0;
+	}
 	_pConnection->releaseChannel(_channel);
 	_channel = 0;
 	_pConnection = 0;
 }
 
 
+void Transport::sendRequestAsync(const Poco::RemotingNG::Identifiable::ObjectId& /*oid*/, const Poco::RemotingNG::Identifiable::TypeId& /*tid*/, const std::string& messageName, Poco::RemotingNG::SerializerBase::MessageType messageType, Poco::RemotingNG::ReplyHandler::Ptr pReplyHandler)
+{
+	if (_logger.debug()) _logger.debug("Sending asynchronous request...");
+
+	// As in sendRequest(), the reply handler must be registered
+	// before the request is complete. The ReplyCollector takes
+	// over the channel and releases it when the reply arrives.
+
+	ReplyCollector::Ptr pCollector = new ReplyCollector(_pConnection, replyFrameType(messageType), _channel, _compression, pReplyHandler, _requestEndpointHandle);
+	pCollector->start(_connectionManager.timer(), _timeout);
+	_channel = 0;
+	_requestEndpointHandle = 0;
+
+	try
+	{
+		if (_pDeflatingStream)
+		{
+			_pDeflatingStream->close();
+			_pDeflatingStream = 0;
+		}
+		_pRequestStream->close();
+		_pRequestStream = 0;
+	}
+	catch (...)
+	{
+		pCollector->cancel();
+		throw;
+	}
+
+	_serializer.reset();
+	_pConnection = 0;
+}
+
+
+Poco::UInt32 Transport::replyFrameType(Poco::RemotingNG::SerializerBase::MessageType messageType)
+{
+	switch (messageType)
+	{
+	case Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST:
+		return Frame::FRAME_TYPE_REPL;
+	
+	case Poco::RemotingNG::SerializerBase::MESSAGE_EVENT:
+		return Frame::FRAME_TYPE_EVNR;
+	
+	default:
+		poco_bugcheck();
+		return 0;
+	}
+}
+
+
 void Transport::setupSerializer(const Poco::RemotingNG::Identifiable::ObjectId& oid, const Poco::RemotingNG::Identifiable::TypeId& tid, Poco::RemotingNG::SerializerBase::MessageType messageType, Poco::UInt16 frameFlags)
 {
 	Poco::UInt32 frameType = 0;
@@ -241,16 +289,51 @@ void Transport::setupSerializer(const Poco::RemotingNG::Identifiable::ObjectId&
 	{
 		_serializer.setup(*_pRequestStream);
 	}
+	_serializer.enableMessageIds(_pConnection->messageIdsEnabled());
 	if (messageType == Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST)
 	{
-		_serializer.serializeEndPoint(oid, tid);
+		serializeEndPoint(oid, tid);
 	}
 	else
 	{
 		std::string eoid(oid);
 		eoid += '#';
 		eoid += _endPointURI.getFragment();
-		_serializer.serializeEndPoint(eoid, tid);
+		serializeEndPoint(eoid, tid);
+	}
+}
+
+
+void Transport::serializeEndPoint(const std::string& oid, const std::string& tid)
+{
+	_requestEndpointHandle = 0;
+	if (_pConnection->messageIdsEnabled())
+	{
+		if (_pConnection->id() != _endpointConnectionId || oid != _endpointOID || tid != _endpointTID)
+		{
+			_endpointHandle = _pConnection->endpointHandle(oid, tid);
+			_endpointConnectionId = _pConnection->id();
+			_endpointOID = oid;
+			_endpointTID = tid;
+			_endpointConfirmed = false;
+		}
+		if (_endpointHandle != 0 && !_endpointConfirmed)
+		{
+			_endpointConfirmed = _pConnection->endpointHandleConfirmed(_endpointHandle);
+		}
+		if (_endpointConfirmed)
+		{
+			_serializer.serializeEndPoint(_endpointHandle);
+		}
+		else
+		{
+			_serializer.serializeEndPoint(_endpointHandle, oid, tid);
+			_requestEndpointHandle = _endpointHandle;
+		}
+	}
+	else
+	{
+		_serializer.serializeEndPoint(oid, tid);
 	}
 }
 
@@ -44,8 +44,14 @@ public:
 	void testClass1();
 	void testPtr();
 	void testStruct1Vec();
+	void testLargeMessage();
 	void testOneWay();
 	void testFault();
+	void testAsync();
+	void testAsyncLargeMessages();
+	void testAsyncTimeout();
+	void testMessageIds();
+	void testPerformance();
 	void testEvent();
 	void testOneWayEvent();
 
@@ -67,6 +73,7 @@ protected:
 	void testClass1(ITester::Ptr pTester);
 	void testPtr(ITester::Ptr pTester);
 	void testStruct1Vec(ITester::Ptr pTester);
+	void testLargeMessage(ITester::Ptr pTester);
 
 	virtual ITester::Ptr createProxy(const std::string& uri);
 
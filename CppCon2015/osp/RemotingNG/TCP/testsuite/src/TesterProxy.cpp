@@ -12,6 +12,7 @@
 #include "TesterProxy.h"
 #include "Class1Deserializer.h"
 #include "Class1Serializer.h"
+#include "Poco/RemotingNG/AsyncReply.h"
 #include "Poco/RemotingNG/Deserializer.h"
 #include "Poco/RemotingNG/RemotingException.h"
 #include "Poco/RemotingNG/Serializer.h"
@@ -80,7 +81,7 @@ void TesterProxy::fireTestEvent(const std::string& arg)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginMessage(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x284B046B, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<std::string >::serialize(REMOTING__NAMES[1], arg, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -98,7 +99,7 @@ void TesterProxy::fireTestOneWayEvent(const std::string& arg)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginMessage(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x147F8B8E, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<std::string >::serialize(REMOTING__NAMES[1], arg, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -152,7 +153,7 @@ Class1 TesterProxy::testClass11(const Class1& c1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x79302CA1, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Class1 >::serialize(REMOTING__NAMES[1], c1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -170,6 +171,26 @@ Class1 TesterProxy::testClass11(const Class1& c1)
 }
 
 
+Poco::ActiveResult < Class1 > TesterProxy::testClass11Async(const Class1& c1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testClass11","c1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x79302CA1, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Class1 >::serialize(REMOTING__NAMES[1], c1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Class1 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Class1 >(&TesterProxy::remoting__testClass11Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testClass12(Class1& c1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -180,7 +201,7 @@ void TesterProxy::testClass12(Class1& c1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x763027E8, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Class1 >::serialize(REMOTING__NAMES[1], c1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -207,7 +228,7 @@ void TesterProxy::testClass13(const Class1& c1, Class1& c2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x7730297B, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Class1 >::serialize(REMOTING__NAMES[1], c1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -234,7 +255,7 @@ Enum1 TesterProxy::testEnum11(Enum1 e1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC962B756, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -254,6 +275,26 @@ Enum1 TesterProxy::testEnum11(Enum1 e1)
 }
 
 
+Poco::ActiveResult < Enum1 > TesterProxy::testEnum11Async(Enum1 e1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testEnum11","e1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC962B756, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Enum1 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Enum1 >(&TesterProxy::remoting__testEnum11Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testEnum12(Enum1& e1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -264,7 +305,7 @@ void TesterProxy::testEnum12(Enum1& e1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC862B5C3, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -293,7 +334,7 @@ void TesterProxy::testEnum13(Enum1 e1, Enum1& e2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC762B430, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -322,7 +363,7 @@ Struct1::Enum2 TesterProxy::testEnum21(Struct1::Enum2 e1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xD1650285, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -342,6 +383,26 @@ Struct1::Enum2 TesterProxy::testEnum21(Struct1::Enum2 e1)
 }
 
 
+Poco::ActiveResult < Struct1::Enum2 > TesterProxy::testEnum21Async(Struct1::Enum2 e1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testEnum21","e1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xD1650285, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Struct1::Enum2 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Struct1::Enum2 >(&TesterProxy::remoting__testEnum21Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testEnum22(Struct1::Enum2& e1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -352,7 +413,7 @@ void TesterProxy::testEnum22(Struct1::Enum2& e1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xCE64FDCC, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -381,7 +442,7 @@ void TesterProxy::testEnum23(Struct1::Enum2 e1, Struct1::Enum2& e2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xCF64FF5F, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -410,7 +471,7 @@ void TesterProxy::testFault()
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x6DCE5F7F, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 	Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
@@ -425,6 +486,25 @@ void TesterProxy::testFault()
 }
 
 
+Poco::ActiveResult < void > TesterProxy::testFaultAsync()
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testFault"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x6DCE5F7F, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<void >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<void >(&TesterProxy::remoting__testFaultReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 int TesterProxy::testInt1(int i)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -435,7 +515,7 @@ int TesterProxy::testInt1(int i)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC5CC329D, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], i, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -453,6 +533,26 @@ int TesterProxy::testInt1(int i)
 }
 
 
+Poco::ActiveResult < int > TesterProxy::testInt1Async(int i)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"TestInt1","Value"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC5CC329D, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], i, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<int >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<int >(&TesterProxy::remoting__testInt1Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testInt2(int& i)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -463,7 +563,7 @@ void TesterProxy::testInt2(int& i)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC2CC2DE4, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], i, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -490,7 +590,7 @@ void TesterProxy::testInt3(int i1, int& i2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xC3CC2F77, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], i1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -517,7 +617,7 @@ Poco::Int64 TesterProxy::testNestedType(Poco::Int64 arg)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xD31D68CA, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Poco::Int64 >::serialize(REMOTING__NAMES[1], arg, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -535,6 +635,26 @@ Poco::Int64 TesterProxy::testNestedType(Poco::Int64 arg)
 }
 
 
+Poco::ActiveResult < Poco::Int64 > TesterProxy::testNestedTypeAsync(Poco::Int64 arg)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testNestedType","arg"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xD31D68CA, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Poco::Int64 >::serialize(REMOTING__NAMES[1], arg, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Poco::Int64 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Poco::Int64 >(&TesterProxy::remoting__testNestedTypeReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testOneWay(const std::string& arg)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -545,7 +665,7 @@ void TesterProxy::testOneWay(const std::string& arg)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginMessage(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x6B86A056, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<std::string >::serialize(REMOTING__NAMES[1], arg, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -563,7 +683,7 @@ std::string TesterProxy::testOneWayResult()
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4464BE7F, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 	Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
@@ -580,6 +700,25 @@ std::string TesterProxy::testOneWayResult()
 }
 
 
+Poco::ActiveResult < std::string > TesterProxy::testOneWayResultAsync()
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testOneWayResult"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4464BE7F, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<std::string >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<std::string >(&TesterProxy::remoting__testOneWayResultReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 Poco::SharedPtr < Struct1 > TesterProxy::testPtr(Poco::SharedPtr < Struct1 > p1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -590,7 +729,7 @@ Poco::SharedPtr < Struct1 > TesterProxy::testPtr(Poco::SharedPtr < Struct1 > p1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x39616809, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Poco::SharedPtr < Struct1 > >::serialize(REMOTING__NAMES[1], p1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -608,6 +747,26 @@ Poco::SharedPtr < Struct1 > TesterProxy::testPtr(Poco::SharedPtr < Struct1 > p1)
 }
 
 
+Poco::ActiveResult < Poco::SharedPtr < Struct1 > > TesterProxy::testPtrAsync(Poco::SharedPtr < Struct1 > p1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testPtr","p1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x39616809, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Poco::SharedPtr < Struct1 > >::serialize(REMOTING__NAMES[1], p1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Poco::SharedPtr < Struct1 > >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Poco::SharedPtr < Struct1 > >(&TesterProxy::remoting__testPtrReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 Struct1 TesterProxy::testStruct11(const Struct1& s1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -618,7 +777,7 @@ Struct1 TesterProxy::testStruct11(const Struct1& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4670ACF6, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -636,6 +795,26 @@ Struct1 TesterProxy::testStruct11(const Struct1& s1)
 }
 
 
+Poco::ActiveResult < Struct1 > TesterProxy::testStruct11Async(const Struct1& s1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct11","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4670ACF6, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Struct1 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Struct1 >(&TesterProxy::remoting__testStruct11Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testStruct12(Struct1& s1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -646,7 +825,7 @@ void TesterProxy::testStruct12(Struct1& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4570AB63, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -673,7 +852,7 @@ void TesterProxy::testStruct13(const Struct1& s1, Struct1& s2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4470A9D0, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -700,7 +879,7 @@ std::vector < Struct1 > TesterProxy::testStruct1Vec1(const std::vector < Struct1
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xE9940302, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(REMOTING__NAMES[1], vec, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -719,6 +898,26 @@ std::vector < Struct1 > TesterProxy::testStruct1Vec1(const std::vector < Struct1
 }
 
 
+Poco::ActiveResult < std::vector < Struct1 > > TesterProxy::testStruct1Vec1Async(const std::vector < Struct1 >& vec)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct1Vec1","vec"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xE9940302, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(REMOTING__NAMES[1], vec, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<std::vector < Struct1 > >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<std::vector < Struct1 > >(&TesterProxy::remoting__testStruct1Vec1Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testStruct1Vec2(std::vector < Struct1 >& vec)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -729,7 +928,7 @@ void TesterProxy::testStruct1Vec2(std::vector < Struct1 >& vec)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xE894016F, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(REMOTING__NAMES[1], vec, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -756,7 +955,7 @@ void TesterProxy::testStruct1Vec3(const std::vector < Struct1 >& vec1, std::vect
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xE793FFDC, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(REMOTING__NAMES[1], vec1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -783,7 +982,7 @@ Struct2 TesterProxy::testStruct21(const Struct2& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4E72F825, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -801,6 +1000,26 @@ Struct2 TesterProxy::testStruct21(const Struct2& s1)
 }
 
 
+Poco::ActiveResult < Struct2 > TesterProxy::testStruct21Async(const Struct2& s1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct21","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4E72F825, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Struct2 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Struct2 >(&TesterProxy::remoting__testStruct21Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testStruct22(Struct2& s1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -811,7 +1030,7 @@ void TesterProxy::testStruct22(Struct2& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4B72F36C, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -838,7 +1057,7 @@ void TesterProxy::testStruct23(const Struct2& s1, Struct2& s2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x4C72F4FF, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -865,7 +1084,7 @@ Struct3 TesterProxy::testStruct31(const Struct3& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x52753D08, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -883,6 +1102,26 @@ Struct3 TesterProxy::testStruct31(const Struct3& s1)
 }
 
 
+Poco::ActiveResult < Struct3 > TesterProxy::testStruct31Async(const Struct3& s1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct31","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x52753D08, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Struct3 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Struct3 >(&TesterProxy::remoting__testStruct31Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testStruct32(Struct3& s1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -893,7 +1132,7 @@ void TesterProxy::testStruct32(Struct3& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x557541C1, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -920,7 +1159,7 @@ void TesterProxy::testStruct33(const Struct3& s1, Struct3& s2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x5475402E, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -947,7 +1186,7 @@ Struct4 TesterProxy::testStruct41(const Struct4& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x5A778837, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -965,6 +1204,26 @@ Struct4 TesterProxy::testStruct41(const Struct4& s1)
 }
 
 
+Poco::ActiveResult < Struct4 > TesterProxy::testStruct41Async(const Struct4& s1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct41","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x5A778837, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Struct4 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Struct4 >(&TesterProxy::remoting__testStruct41Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testStruct42(Struct4& s1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -975,7 +1234,7 @@ void TesterProxy::testStruct42(Struct4& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x5B7789CA, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1002,7 +1261,7 @@ void TesterProxy::testStruct43(const Struct4& s1, Struct4& s2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x5C778B5D, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1029,7 +1288,7 @@ Struct5 TesterProxy::testStruct51(const Struct5& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xDE7A969A, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1047,6 +1306,26 @@ Struct5 TesterProxy::testStruct51(const Struct5& s1)
 }
 
 
+Poco::ActiveResult < Struct5 > TesterProxy::testStruct51Async(const Struct5& s1)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct51","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xDE7A969A, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<Struct5 >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<Struct5 >(&TesterProxy::remoting__testStruct51Reply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testStruct52(Struct5& s1)
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -1057,7 +1336,7 @@ void TesterProxy::testStruct52(Struct5& s1)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xDD7A9507, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1084,7 +1363,7 @@ void TesterProxy::testStruct53(const Struct5& s1, Struct5& s2)
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xDC7A9374, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 	Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[2], s2, remoting__ser);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
@@ -1113,7 +1392,7 @@ void TesterProxy::testSynchronized()
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x7E3E4A1B, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 	Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
@@ -1128,6 +1407,26 @@ void TesterProxy::testSynchronized()
 }
 
 
+Poco::ActiveResult < void > TesterProxy::testSynchronizedAsync()
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testSynchronized"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	Poco::FastMutex::ScopedLock remoting__lock(remoting__mutex());
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0x7E3E4A1B, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<void >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<void >(&TesterProxy::remoting__testSynchronizedReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testSynchronizedProxy()
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -1139,7 +1438,7 @@ void TesterProxy::testSynchronizedProxy()
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xB7C61AD5, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 	Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
@@ -1154,6 +1453,26 @@ void TesterProxy::testSynchronizedProxy()
 }
 
 
+Poco::ActiveResult < void > TesterProxy::testSynchronizedProxyAsync()
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testSynchronizedProxy"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	Poco::FastMutex::ScopedLock remoting__lock(remoting__mutex());
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xB7C61AD5, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<void >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<void >(&TesterProxy::remoting__testSynchronizedProxyReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
 void TesterProxy::testSynchronizedRemote()
 {
 	remoting__staticInitBegin(REMOTING__NAMES);
@@ -1164,7 +1483,7 @@ void TesterProxy::testSynchronizedRemote()
 	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
 	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
-	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xDB062741, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
 	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 	Poco::RemotingNG::Deserializer& remoting__deser = remoting__trans.sendRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
@@ -1179,4 +1498,296 @@ void TesterProxy::testSynchronizedRemote()
 }
 
 
+Poco::ActiveResult < void > TesterProxy::testSynchronizedRemoteAsync()
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testSynchronizedRemote"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	const std::string& remoting__namespace(DEFAULT_NS);
+	Poco::RemotingNG::Transport& remoting__trans = remoting__transport();
+	remoting__trans.setAttribute(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	Poco::RemotingNG::Serializer& remoting__ser = remoting__trans.beginRequest(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, remoting__namespace);
+	remoting__ser.serializeMessageBegin(REMOTING__NAMES[0], 0xDB062741, Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.serializeMessageEnd(REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST);
+	remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+	Poco::RemotingNG::AsyncReply<void >::Ptr remoting__pReply = new Poco::RemotingNG::AsyncReply<void >(&TesterProxy::remoting__testSynchronizedRemoteReply);
+	remoting__trans.sendRequestAsync(remoting__objectId(), remoting__typeId(), REMOTING__NAMES[0], Poco::RemotingNG::SerializerBase::MESSAGE_REQUEST, remoting__pReply);
+	return remoting__pReply->result();
+}
+
+
+void TesterProxy::remoting__testClass11Reply(Poco::RemotingNG::Deserializer& remoting__deser, Class1& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testClass11","c1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testClass11Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Class1 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testEnum11Reply(Poco::RemotingNG::Deserializer& remoting__deser, Enum1& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testEnum11","e1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testEnum11Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	int remoting__tmpReturn;
+	Poco::RemotingNG::TypeDeserializer<int >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__tmpReturn);
+	remoting__ret = static_cast<Enum1>(remoting__tmpReturn);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testEnum21Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct1::Enum2& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testEnum21","e1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testEnum21Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	int remoting__tmpReturn;
+	Poco::RemotingNG::TypeDeserializer<int >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__tmpReturn);
+	remoting__ret = static_cast<Struct1::Enum2>(remoting__tmpReturn);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testFaultReply(Poco::RemotingNG::Deserializer& remoting__deser)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testFault"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testFaultReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testInt1Reply(Poco::RemotingNG::Deserializer& remoting__deser, int& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"TestInt1","Value"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("TestInt1Response");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<int >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testNestedTypeReply(Poco::RemotingNG::Deserializer& remoting__deser, Poco::Int64& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testNestedType","arg"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testNestedTypeReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Poco::Int64 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testOneWayResultReply(Poco::RemotingNG::Deserializer& remoting__deser, std::string& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testOneWayResult"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testOneWayResultReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<std::string >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testPtrReply(Poco::RemotingNG::Deserializer& remoting__deser, Poco::SharedPtr < Struct1 >& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testPtr","p1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testPtrReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Poco::SharedPtr < Struct1 > >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testStruct11Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct1& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct11","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testStruct11Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Struct1 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testStruct1Vec1Reply(Poco::RemotingNG::Deserializer& remoting__deser, std::vector < Struct1 >& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct1Vec1","vec"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testStruct1Vec1Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__ret.clear();
+	Poco::RemotingNG::TypeDeserializer<std::vector < Struct1 > >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testStruct21Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct2& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct21","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testStruct21Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Struct2 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testStruct31Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct3& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct31","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testStruct31Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Struct3 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testStruct41Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct4& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct41","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testStruct41Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Struct4 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testStruct51Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct5& remoting__ret)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testStruct51","s1"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testStruct51Reply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	Poco::RemotingNG::TypeDeserializer<Struct5 >::deserialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, true, remoting__deser, remoting__ret);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testSynchronizedProxyReply(Poco::RemotingNG::Deserializer& remoting__deser)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testSynchronizedProxy"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testSynchronizedProxyReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testSynchronizedRemoteReply(Poco::RemotingNG::Deserializer& remoting__deser)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testSynchronizedRemote"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testSynchronizedRemoteReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
+void TesterProxy::remoting__testSynchronizedReply(Poco::RemotingNG::Deserializer& remoting__deser)
+{
+	remoting__staticInitBegin(REMOTING__NAMES);
+	static const std::string REMOTING__NAMES[] = {"testSynchronized"};
+	remoting__staticInitEnd(REMOTING__NAMES);
+	remoting__deser.pushProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE, DEFAULT_NS);
+	remoting__staticInitBegin(REMOTING__REPLY_NAME);
+	static const std::string REMOTING__REPLY_NAME("testSynchronizedReply");
+	remoting__staticInitEnd(REMOTING__REPLY_NAME);
+	remoting__deser.deserializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.deserializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+	remoting__deser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
+}
+
+
 const std::string TesterProxy::DEFAULT_NS("urn:appinf.com:service:Tester:1");
@@ -14,6 +14,7 @@
 
 
 #include "ITester.h"
+#include "Poco/ActiveResult.h"
 #include "Poco/RemotingNG/EventListener.h"
 #include "Poco/RemotingNG/EventSubscriber.h"
 #include "Poco/RemotingNG/Proxy.h"
@@ -40,81 +41,234 @@ public:
 
 	Class1 testClass11(const Class1& c1);
 
+	Poco::ActiveResult < Class1 > testClass11Async(const Class1& c1);
+		/// Asynchronously invokes testClass11().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testClass12(Class1& c1);
 
 	void testClass13(const Class1& c1, Class1& c2);
 
 	Enum1 testEnum11(Enum1 e1);
 
+	Poco::ActiveResult < Enum1 > testEnum11Async(Enum1 e1);
+		/// Asynchronously invokes testEnum11().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testEnum12(Enum1& e1);
 
 	void testEnum13(Enum1 e1, Enum1& e2);
 
 	Struct1::Enum2 testEnum21(Struct1::Enum2 e1);
 
+	Poco::ActiveResult < Struct1::Enum2 > testEnum21Async(Struct1::Enum2 e1);
+		/// Asynchronously invokes testEnum21().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testEnum22(Struct1::Enum2& e1);
 
 	void testEnum23(Struct1::Enum2 e1, Struct1::Enum2& e2);
 
 	void testFault();
 
+	Poco::ActiveResult < void > testFaultAsync();
+		/// Asynchronously invokes testFault().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	int testInt1(int i);
 
+	Poco::ActiveResult < int > testInt1Async(int i);
+		/// Asynchronously invokes testInt1().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testInt2(int& i);
 
 	void testInt3(int i1, int& i2);
 
 	Poco::Int64 testNestedType(Poco::Int64 arg);
 
+	Poco::ActiveResult < Poco::Int64 > testNestedTypeAsync(Poco::Int64 arg);
+		/// Asynchronously invokes testNestedType().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testOneWay(const std::string& arg);
 
 	std::string testOneWayResult();
 
+	Poco::ActiveResult < std::string > testOneWayResultAsync();
+		/// Asynchronously invokes testOneWayResult().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	Poco::SharedPtr < Struct1 > testPtr(Poco::SharedPtr < Struct1 > p1);
 
+	Poco::ActiveResult < Poco::SharedPtr < Struct1 > > testPtrAsync(Poco::SharedPtr < Struct1 > p1);
+		/// Asynchronously invokes testPtr().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	Struct1 testStruct11(const Struct1& s1);
 
+	Poco::ActiveResult < Struct1 > testStruct11Async(const Struct1& s1);
+		/// Asynchronously invokes testStruct11().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testStruct12(Struct1& s1);
 
 	void testStruct13(const Struct1& s1, Struct1& s2);
 
 	std::vector < Struct1 > testStruct1Vec1(const std::vector < Struct1 >& vec);
 
+	Poco::ActiveResult < std::vector < Struct1 > > testStruct1Vec1Async(const std::vector < Struct1 >& vec);
+		/// Asynchronously invokes testStruct1Vec1().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testStruct1Vec2(std::vector < Struct1 >& vec);
 
 	void testStruct1Vec3(const std::vector < Struct1 >& vec1, std::vector < Struct1 >& vec2);
 
 	Struct2 testStruct21(const Struct2& s1);
 
+	Poco::ActiveResult < Struct2 > testStruct21Async(const Struct2& s1);
+		/// Asynchronously invokes testStruct21().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testStruct22(Struct2& s1);
 
 	void testStruct23(const Struct2& s1, Struct2& s2);
 
 	Struct3 testStruct31(const Struct3& s1);
 
+	Poco::ActiveResult < Struct3 > testStruct31Async(const Struct3& s1);
+		/// Asynchronously invokes testStruct31().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testStruct32(Struct3& s1);
 
 	void testStruct33(const Struct3& s1, Struct3& s2);
 
 	Struct4 testStruct41(const Struct4& s1);
 
+	Poco::ActiveResult < Struct4 > testStruct41Async(const Struct4& s1);
+		/// Asynchronously invokes testStruct41().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testStruct42(Struct4& s1);
 
 	void testStruct43(const Struct4& s1, Struct4& s2);
 
 	Struct5 testStruct51(const Struct5& s1);
 
+	Poco::ActiveResult < Struct5 > testStruct51Async(const Struct5& s1);
+		/// Asynchronously invokes testStruct51().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testStruct52(Struct5& s1);
 
 	void testStruct53(const Struct5& s1, Struct5& s2);
 
 	void testSynchronized();
 
+	Poco::ActiveResult < void > testSynchronizedAsync();
+		/// Asynchronously invokes testSynchronized().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testSynchronizedProxy();
 
+	Poco::ActiveResult < void > testSynchronizedProxyAsync();
+		/// Asynchronously invokes testSynchronizedProxy().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 	void testSynchronizedRemote();
 
+	Poco::ActiveResult < void > testSynchronizedRemoteAsync();
+		/// Asynchronously invokes testSynchronizedRemote().
+		///
+		/// Returns as soon as the request has been sent. The reply
+		/// is received and deserialized in the background, and stored
+		/// in the returned ActiveResult.
+
 private:
+	static void remoting__testClass11Reply(Poco::RemotingNG::Deserializer& remoting__deser, Class1& remoting__ret);
+
+	static void remoting__testEnum11Reply(Poco::RemotingNG::Deserializer& remoting__deser, Enum1& remoting__ret);
+
+	static void remoting__testEnum21Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct1::Enum2& remoting__ret);
+
+	static void remoting__testFaultReply(Poco::RemotingNG::Deserializer& remoting__deser);
+
+	static void remoting__testInt1Reply(Poco::RemotingNG::Deserializer& remoting__deser, int& remoting__ret);
+
+	static void remoting__testNestedTypeReply(Poco::RemotingNG::Deserializer& remoting__deser, Poco::Int64& remoting__ret);
+
+	static void remoting__testOneWayResultReply(Poco::RemotingNG::Deserializer& remoting__deser, std::string& remoting__ret);
+
+	static void remoting__testPtrReply(Poco::RemotingNG::Deserializer& remoting__deser, Poco::SharedPtr < Struct1 >& remoting__ret);
+
+	static void remoting__testStruct11Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct1& remoting__ret);
+
+	static void remoting__testStruct1Vec1Reply(Poco::RemotingNG::Deserializer& remoting__deser, std::vector < Struct1 >& remoting__ret);
+
+	static void remoting__testStruct21Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct2& remoting__ret);
+
+	static void remoting__testStruct31Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct3& remoting__ret);
+
+	static void remoting__testStruct41Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct4& remoting__ret);
+
+	static void remoting__testStruct51Reply(Poco::RemotingNG::Deserializer& remoting__deser, Struct5& remoting__ret);
+
+	static void remoting__testSynchronizedProxyReply(Poco::RemotingNG::Deserializer& remoting__deser);
+
+	static void remoting__testSynchronizedRemoteReply(Poco::RemotingNG::Deserializer& remoting__deser);
+
+	static void remoting__testSynchronizedReply(Poco::RemotingNG::Deserializer& remoting__deser);
+
 	static const std::string DEFAULT_NS;
 	Poco::RemotingNG::EventListener::Ptr _pEventListener;
 	Poco::RemotingNG::EventSubscriber::Ptr _pEventSubscriber;
@@ -110,7 +110,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testClass11Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x79302CA1, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Class1 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -171,7 +171,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testClass12Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x763027E8, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Class1 >::serialize(REMOTING__NAMES[1], c1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -233,7 +233,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testClass13Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x7730297B, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Class1 >::serialize(REMOTING__NAMES[2], c2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -296,7 +296,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testEnum11Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xC962B756, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -359,7 +359,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testEnum12Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xC862B5C3, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -423,7 +423,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testEnum13Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xC762B430, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[2], e2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -486,7 +486,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testEnum21Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xD1650285, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -549,7 +549,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testEnum22Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xCE64FDCC, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], e1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -613,7 +613,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testEnum23Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xCF64FF5F, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[2], e2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -672,7 +672,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testFaultReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x6DCE5F7F, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 		}
@@ -732,7 +732,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("TestInt1Response");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xC5CC329D, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -793,7 +793,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("TestInt2Response");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xC2CC2DE4, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[1], i, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -855,7 +855,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("TestInt3Response");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xC3CC2F77, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<int >::serialize(REMOTING__NAMES[2], i2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -916,7 +916,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testNestedTypeReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xD31D68CA, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Poco::Int64 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1002,7 +1002,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testOneWayResultReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4464BE7F, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<std::string >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1063,7 +1063,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testPtrReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x39616809, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Poco::SharedPtr < Struct1 > >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1124,7 +1124,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct11Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4670ACF6, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1185,7 +1185,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct12Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4570AB63, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1247,7 +1247,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct13Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4470A9D0, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct1 >::serialize(REMOTING__NAMES[2], s2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1308,7 +1308,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct1Vec1Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xE9940302, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1369,7 +1369,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct1Vec2Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xE894016F, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(REMOTING__NAMES[1], vec, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1431,7 +1431,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct1Vec3Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xE793FFDC, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<std::vector < Struct1 > >::serialize(REMOTING__NAMES[2], vec2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1492,7 +1492,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct21Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4E72F825, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1553,7 +1553,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct22Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4B72F36C, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1615,7 +1615,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct23Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x4C72F4FF, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct2 >::serialize(REMOTING__NAMES[2], s2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1676,7 +1676,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct31Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x52753D08, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1737,7 +1737,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct32Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x557541C1, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1799,7 +1799,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct33Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x5475402E, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct3 >::serialize(REMOTING__NAMES[2], s2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1860,7 +1860,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct41Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x5A778837, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1921,7 +1921,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct42Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x5B7789CA, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -1983,7 +1983,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct43Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x5C778B5D, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct4 >::serialize(REMOTING__NAMES[2], s2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -2044,7 +2044,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct51Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xDE7A969A, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(Poco::RemotingNG::SerializerBase::RETURN_PARAM, remoting__return, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -2105,7 +2105,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct52Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xDD7A9507, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[1], s1, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -2168,7 +2168,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testStruct53Reply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xDC7A9374, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			Poco::RemotingNG::TypeSerializer<Struct5 >::serialize(REMOTING__NAMES[2], s2, remoting__ser);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
@@ -2227,7 +2227,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testSynchronizedReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0x7E3E4A1B, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 		}
@@ -2285,7 +2285,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testSynchronizedProxyReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xB7C61AD5, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 		}
@@ -2343,7 +2343,7 @@ public:
 			remoting__staticInitBegin(REMOTING__REPLY_NAME);
 			static const std::string REMOTING__REPLY_NAME("testSynchronizedRemoteReply");
 			remoting__staticInitEnd(REMOTING__REPLY_NAME);
-			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
+			remoting__ser.serializeMessageBegin(REMOTING__REPLY_NAME, 0xDB062741, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.serializeMessageEnd(REMOTING__REPLY_NAME, Poco::RemotingNG::SerializerBase::MESSAGE_REPLY);
 			remoting__ser.popProperty(Poco::RemotingNG::SerializerBase::PROP_NAMESPACE);
 		}
@@ -2382,46 +2382,46 @@ TesterSkeleton::TesterSkeleton():
 	Poco::RemotingNG::Skeleton()
 
 {
-	addMethodHandler("TestInt1", new TesterTestInt1MethodHandler);
-	addMethodHandler("TestInt2", new TesterTestInt2MethodHandler);
-	addMethodHandler("TestInt3", new TesterTestInt3MethodHandler);
-	addMethodHandler("fireTestEvent", new TesterFireTestEventMethodHandler);
-	addMethodHandler("fireTestOneWayEvent", new TesterFireTestOneWayEventMethodHandler);
-	addMethodHandler("testClass11", new TesterTestClass11MethodHandler);
-	addMethodHandler("testClass12", new TesterTestClass12MethodHandler);
-	addMethodHandler("testClass13", new TesterTestClass13MethodHandler);
-	addMethodHandler("testEnum11", new TesterTestEnum11MethodHandler);
-	addMethodHandler("testEnum12", new TesterTestEnum12MethodHandler);
-	addMethodHandler("testEnum13", new TesterTestEnum13MethodHandler);
-	addMethodHandler("testEnum21", new TesterTestEnum21MethodHandler);
-	addMethodHandler("testEnum22", new TesterTestEnum22MethodHandler);
-	addMethodHandler("testEnum23", new TesterTestEnum23MethodHandler);
-	addMethodHandler("testFault", new TesterTestFaultMethodHandler);
-	addMethodHandler("testNestedType", new TesterTestNestedTypeMethodHandler);
-	addMethodHandler("testOneWay", new TesterTestOneWayMethodHandler);
-	addMethodHandler("testOneWayResult", new TesterTestOneWayResultMethodHandler);
-	addMethodHandler("testPtr", new TesterTestPtrMethodHandler);
-	addMethodHandler("testStruct11", new TesterTestStruct11MethodHandler);
-	addMethodHandler("testStruct12", new TesterTestStruct12MethodHandler);
-	addMethodHandler("testStruct13", new TesterTestStruct13MethodHandler);
-	addMethodHandler("testStruct1Vec1", new TesterTestStruct1Vec1MethodHandler);
-	addMethodHandler("testStruct1Vec2", new TesterTestStruct1Vec2MethodHandler);
-	addMethodHandler("testStruct1Vec3", new TesterTestStruct1Vec3MethodHandler);
-	addMethodHandler("testStruct21", new TesterTestStruct21MethodHandler);
-	addMethodHandler("testStruct22", new TesterTestStruct22MethodHandler);
-	addMethodHandler("testStruct23", new TesterTestStruct23MethodHandler);
-	addMethodHandler("testStruct31", new TesterTestStruct31MethodHandler);
-	addMethodHandler("testStruct32", new TesterTestStruct32MethodHandler);
-	addMethodHandler("testStruct33", new TesterTestStruct33MethodHandler);
-	addMethodHandler("testStruct41", new TesterTestStruct41MethodHandler);
-	addMethodHandler("testStruct42", new TesterTestStruct42MethodHandler);
-	addMethodHandler("testStruct43", new TesterTestStruct43MethodHandler);
-	addMethodHandler("testStruct51", new TesterTestStruct51MethodHandler);
-	addMethodHandler("testStruct52", new TesterTestStruct52MethodHandler);
-	addMethodHandler("testStruct53", new TesterTestStruct53MethodHandler);
-	addMethodHandler("testSynchronized", new TesterTestSynchronizedMethodHandler);
-	addMethodHandler("testSynchronizedProxy", new TesterTestSynchronizedProxyMethodHandler);
-	addMethodHandler("testSynchronizedRemote", new TesterTestSynchronizedRemoteMethodHandler);
+	addMethodHandler("TestInt1", 0xC5CC329D, new TesterTestInt1MethodHandler);
+	addMethodHandler("TestInt2", 0xC2CC2DE4, new TesterTestInt2MethodHandler);
+	addMethodHandler("TestInt3", 0xC3CC2F77, new TesterTestInt3MethodHandler);
+	addMethodHandler("fireTestEvent", 0x284B046B, new TesterFireTestEventMethodHandler);
+	addMethodHandler("fireTestOneWayEvent", 0x147F8B8E, new TesterFireTestOneWayEventMethodHandler);
+	addMethodHandler("testClass11", 0x79302CA1, new TesterTestClass11MethodHandler);
+	addMethodHandler("testClass12", 0x763027E8, new TesterTestClass12MethodHandler);
+	addMethodHandler("testClass13", 0x7730297B, new TesterTestClass13MethodHandler);
+	addMethodHandler("testEnum11", 0xC962B756, new TesterTestEnum11MethodHandler);
+	addMethodHandler("testEnum12", 0xC862B5C3, new TesterTestEnum12MethodHandler);
+	addMethodHandler("testEnum13", 0xC762B430, new TesterTestEnum13MethodHandler);
+	addMethodHandler("testEnum21", 0xD1650285, new TesterTestEnum21MethodHandler);
+	addMethodHandler("testEnum22", 0xCE64FDCC, new TesterTestEnum22MethodHandler);
+	addMethodHandler("testEnum23", 0xCF64FF5F, new TesterTestEnum23MethodHandler);
+	addMethodHandler("testFault", 0x6DCE5F7F, new TesterTestFaultMethodHandler);
+	addMethodHandler("testNestedType", 0xD31D68CA, new TesterTestNestedTypeMethodHandler);
+	addMethodHandler("testOneWay", 0x6B86A056, new TesterTestOneWayMethodHandler);
+	addMethodHandler("testOneWayResult", 0x4464BE7F, new TesterTestOneWayResultMethodHandler);
+	addMethodHandler("testPtr", 0x39616809, new TesterTestPtrMethodHandler);
+	addMethodHandler("testStruct11", 0x4670ACF6, new TesterTestStruct11MethodHandler);
+	addMethodHandler("testStruct12", 0x4570AB63, new TesterTestStruct12MethodHandler);
+	addMethodHandler("testStruct13", 0x4470A9D0, new TesterTestStruct13MethodHandler);
+	addMethodHandler("testStruct1Vec1", 0xE9940302, new TesterTestStruct1Vec1MethodHandler);
+	addMethodHandler("testStruct1Vec2", 0xE894016F, new TesterTestStruct1Vec2MethodHandler);
+	addMethodHandler("testStruct1Vec3", 0xE793FFDC, new TesterTestStruct1Vec3MethodHandler);
+	addMethodHandler("testStruct21", 0x4E72F825, new TesterTestStruct21MethodHandler);
+	addMethodHandler("testStruct22", 0x4B72F36C, new TesterTestStruct22MethodHandler);
+	addMethodHandler("testStruct23", 0x4C72F4FF, new TesterTestStruct23MethodHandler);
+	addMethodHandler("testStruct31", 0x52753D08, new TesterTestStruct31MethodHandler);
+	addMethodHandler("testStruct32", 0x557541C1, new TesterTestStruct32MethodHandler);
+	addMethodHandler("testStruct33", 0x5475402E, new TesterTestStruct33MethodHandler);
+	addMethodHandler("testStruct41", 0x5A778837, new TesterTestStruct41MethodHandler);
+	addMethodHandler("testStruct42", 0x5B7789CA, new TesterTestStruct42MethodHandler);
+	addMethodHandler("testStruct43", 0x5C778B5D, new TesterTestStruct43MethodHandler);
+	addMethodHandler("testStruct51", 0xDE7A969A, new TesterTestStruct51MethodHandler);
+	addMethodHandler("testStruct52", 0xDD7A9507, new TesterTestStruct52MethodHandler);
+	addMethodHandler("testStruct53", 0xDC7A9374, new TesterTestStruct53MethodHandler);
+	addMethodHandler("testSynchronized", 0x7E3E4A1B, new TesterTestSynchronizedMethodHandler);
+	addMethodHandler("testSynchronizedProxy", 0xB7C61AD5, new TesterTestSynchronizedProxyMethodHandler);
+	addMethodHandler("testSynchronizedRemote", 0xDB062741, new TesterTestSynchronizedRemoteMethodHandler);
 }
 
 
@@ -0,0 +1,166 @@
+//
+// AsyncReply.h
+//
+// $Id$
+//
+// Library: RemotingNG
+// Package: Transport
+// Module:  AsyncReply
+//
+// Definition of the AsyncReply class template.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef RemotingNG_AsyncReply_INCLUDED
+#define RemotingNG_AsyncReply_INCLUDED
+
+
+#include "Poco/RemotingNG/ReplyHandler.h"
+#include "Poco/ActiveResult.h"
+#include <exception>
+
+
+namespace Poco {
+namespace RemotingNG {
+
+
+template <class ResultType>
+class AsyncReply: public ReplyHandler
+	/// A ReplyHandler that deserializes the reply message using
+	/// a function generated by RemoteGen, stores the result in a
+	/// Poco::ActiveResult and notifies any threads waiting for it.
+	///
+	/// Faults sent by the server, as well as errors reported by
+	/// the Transport, are stored as exception in the ActiveResult.
+{
+public:
+	typedef Poco::AutoPtr<AsyncReply> Ptr;
+	typedef Poco::ActiveResult<ResultType> ActiveResultType;
+	typedef void (*DeserializeFunc)(Deserializer& deserializer, ResultType& result);
+
+	explicit AsyncReply(DeserializeFunc deserialize):
+		_deserialize(deserialize),
+		_result(new Poco::ActiveResultHolder<ResultType>)
+		/// Creates the AsyncReply, using the given function
+		/// to deserialize the reply message.
+	{
+		poco_check_ptr (deserialize);
+	}
+
+	const ActiveResultType& result() const
+		/// Returns the ActiveResult.
+	{
+		return _result;
+	}
+
+	void handleReply(Deserializer& deserializer)
+	{
+		try
+		{
+			_result.data(new ResultType);
+			_deserialize(deserializer, _result.data());
+		}
+		catch (Poco::Exception& exc)
+		{
+			_result.error(exc);
+		}
+		catch (std::exception& exc)
+		{
+			_result.error(exc.what());
+		}
+		catch (...)
+		{
+			_result.error("unknown exception");
+		}
+		_result.notify();
+	}
+
+	void handleError(const Poco::Exception& exc)
+	{
+		_result.error(exc);
+		_result.notify();
+	}
+
+protected:
+	~AsyncReply()
+	{
+	}
+
+private:
+	DeserializeFunc  _deserialize;
+	ActiveResultType _result;
+};
+
+
+template <>
+class AsyncReply<void>: public ReplyHandler
+	/// Specialization of AsyncReply for methods
+	/// without a return value.
+{
+public:
+	typedef Poco::AutoPtr<AsyncReply> Ptr;
+	typedef Poco::ActiveResult<void> ActiveResultType;
+	typedef void (*DeserializeFunc)(Deserializer& deserializer);
+
+	explicit AsyncReply(DeserializeFunc deserialize):
+		_deserialize(deserialize),
+		_result(new Poco::ActiveResultHolder<void>)
+		/// Creates the AsyncReply, using the given function
+		/// to deserialize the reply message.
+	{
+		poco_check_ptr (deserialize);
+	}
+
+	const ActiveResultType& result() const
+		/// Returns the ActiveResult.
+	{
+		return _result;
+	}
+
+	void handleReply(Deserializer& deserializer)
+	{
+		try
+		{
+			_deserialize(deserializer);
+		}
+		catch (Poco::Exception& exc)
+		{
+			_result.error(exc);
+		}
+		catch (std::exception& exc)
+		{
+			_result.error(exc.what());
+		}
+		catch (...)
+		{
+			_result.error("unknown exception");
+		}
+		_result.notify();
+	}
+
+	void handleError(const Poco::Exception& exc)
+	{
+		_result.error(exc);
+		_result.notify();
+	}
+
+protected:
+	~AsyncReply()
+	{
+	}
+
+private:
+	DeserializeFunc  _deserialize;
+	ActiveResultType _result;
+};
+
+
+} } // namespace Poco::RemotingNG
+
+
+#endif // RemotingNG_AsyncReply_INCLUDED
@@ -49,8 +49,23 @@ public:
 	void deserializeEndPoint(std::string& oid, std::string& tid);
 		/// Serializes the object and type ID of the service object.
 
+	bool deserializeEndPoint(Poco::UInt32& handle, std::string& oid, std::string& tid);
+		/// Deserializes an endpoint written by 
+		/// BinarySerializer::serializeEndPoint(handle) or 
+		/// BinarySerializer::serializeEndPoint(handle, oid, tid).
+		///
+		/// Returns true if the object and type ID have been
+		/// sent, otherwise false. In the latter case, only
+		/// handle is set, and the Transport must look up
+		/// the endpoint previously defined for the handle.
+
+	Poco::UInt32 messageId() const;
+		/// Returns the numeric ID of the current message,
+		/// or 0 if the message has been identified by name.
+
 	// Deserializer
 	SerializerBase::MessageType findMessage(std::string& name);
+	SerializerBase::MessageType findMessage(std::string& name, Poco::UInt32& id);
 	void deserializeMessageBegin(const std::string& name, SerializerBase::MessageType type);
 	void deserializeMessageEnd(const std::string& name, SerializerBase::MessageType type);
 	bool deserializeStructBegin(const std::string& name, bool isMandatory);
@@ -93,6 +108,8 @@ private:
 
 	BinaryReaderPtr _pReader;
 	std::string _messageName;
+	Poco::UInt32 _messageId;
+	bool _messageFound;
 	SerializerBase::MessageType _messageType;
 	LevelLengthVec _sequenceLengths;
 	int _curLevel;
@@ -102,6 +119,12 @@ private:
 //
 // inlines
 //
+inline Poco::UInt32 BinaryDeserializer::messageId() const
+{
+	return _messageId;
+}
+
+
 inline bool BinaryDeserializer::checkStream()
 {
 	if (_pReader->good())
@@ -49,6 +49,12 @@ class RemotingNG_API BinarySerializer: public Serializer
 	/// self describing and contain only minimal measures
 	/// for detecting deserialization failures or message
 	/// version incompatibilities.
+	///
+	/// If enabled with enableMessageIds(), request and reply
+	/// messages are identified by the numeric method ID
+	/// generated by RemoteGen, instead of the method name.
+	/// This must only be done if the peer is known to
+	/// support message IDs.
 {
 public:
 	BinarySerializer();
@@ -60,8 +66,33 @@ public:
 	void serializeEndPoint(const std::string& oid, const std::string& tid);
 		/// Serializes the object and type ID of the service object.
 
+	void serializeEndPoint(Poco::UInt32 handle);
+		/// Serializes a handle referring to the object and type ID 
+		/// of the service object, which has previously been
+		/// defined with serializeEndPoint(handle, oid, tid).
+
+	void serializeEndPoint(Poco::UInt32 handle, const std::string& oid, const std::string& tid);
+		/// Serializes the object and type ID of the service object,
+		/// and defines the given handle for it. A handle of 0
+		/// sends the object and type ID without defining a handle.
+		///
+		/// Handles are scoped to a connection and must be
+		/// interpreted by the Transport, which must use
+		/// BinaryDeserializer::deserializeEndPoint(handle, oid, tid) 
+		/// for reading them.
+
+	void enableMessageIds(bool enable);
+		/// Enables or disables writing numeric message IDs
+		/// instead of message names, for messages that have
+		/// an ID.
+
+	bool messageIdsEnabled() const;
+		/// Returns true iff writing numeric message IDs
+		/// is enabled.
+
 	// Serializer
 	void serializeMessageBegin(const std::string& name, SerializerBase::MessageType type);
+	void serializeMessageBegin(const std::string& name, Poco::UInt32 id, SerializerBase::MessageType type);
 	void serializeMessageEnd(const std::string& name, SerializerBase::MessageType type);
 	void serializeFaultMessage(const std::string& name, Poco::Exception& exc);
 	void serializeStructBegin(const std::string& name);
@@ -102,18 +133,33 @@ protected:
 		MESSAGE_CODE_EVENT        = 0x02,
 		MESSAGE_CODE_REPLY        = 0x11,
 		MESSAGE_CODE_EVENT_REPLY  = 0x12,
-		MESSAGE_CODE_FAULT        = 0x18
+		MESSAGE_CODE_FAULT        = 0x18,
+		MESSAGE_CODE_ID_FLAG      = 0x80
+			/// Set if the message code is followed by a 
+			/// 7-bit encoded message ID instead of the name.
 	};
 
+	static Poco::UInt8 messageCode(SerializerBase::MessageType type);
+
 private:
 	typedef std::auto_ptr<Poco::BinaryWriter> BinaryWriterPtr;
 
 	BinaryWriterPtr _pWriter;
+	bool _messageIds;
 	
 	friend class BinaryDeserializer;
 };
 
 
+//
+// inlines
+//
+inline bool BinarySerializer::messageIdsEnabled() const
+{
+	return _messageIds;
+}
+
+
 } } // namespace Poco::RemotingNG
 
 
@@ -69,6 +69,16 @@ public:
 		/// This method must be implemented in such a way that it can be called
 		/// multiple times in succession, until deserializeMessageBegin() is called.
 
+	virtual SerializerBase::MessageType findMessage(std::string& name, Poco::UInt32& id);
+		/// Reads from the stream until the message has been found.
+		/// Returns the type of the message, and either the name or the
+		/// numeric ID (see Serializer::serializeMessageBegin()) of the
+		/// found message. If the message has been identified by its ID,
+		/// the returned name is empty. Otherwise, id is set to 0.
+		///
+		/// The default implementation calls findMessage(name) and
+		/// sets id to 0.
+
 	virtual void deserializeMessageBegin(const std::string& name, SerializerBase::MessageType type) = 0;
 		/// Begin deserialization of a message.
 		///
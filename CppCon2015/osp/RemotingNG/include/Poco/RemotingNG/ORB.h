@@ -31,6 +31,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/Logger.h"
 #include "Poco/Mutex.h"
+#include "Poco/AtomicCounter.h"
 #include "Poco/SingletonHolder.h"
 #include <map>
 #include <set>
@@ -58,6 +59,17 @@ class RemotingNG_API ORB
 	/// (client helper, server helper) generated by the Remoting code 
 	/// generator to obtain an instance of an object instead of using
 	/// findObject() directly.
+	///
+	/// Registration and unregistration of listeners and objects are
+	/// serialized. Each change publishes a new immutable snapshot of
+	/// the object tables, which is used by invoke() and findObject(). 
+	/// These methods therefore never wait for each other, or for 
+	/// a registration in progress. They neither take a lock nor
+	/// update a reference count shared by all threads to access
+	/// the snapshot. Instead, a reader announces itself in one of
+	/// several per-thread counters, and a replaced snapshot is only 
+	/// deleted after all readers that may still use it have finished
+	/// (see publishSnapshot()).
 {
 public:
 	typedef std::vector<Listener::Ptr> ListenerVec;
@@ -80,6 +92,16 @@ public:
 		/// URI can be a complete URI, or a URI path. In any case, only the URI path will
 		/// be considered. The given URI can be an alias URI.
 
+	bool invoke(const Listener& listener, const std::string& uri, ServerTransport& transport, std::string& objectPath) const;
+		/// Invoke a method on the object registered for the given Listener and URI,
+		/// and returns the path of the object the URI has been resolved to in objectPath.
+		///
+		/// A Transport can remember the object path and pass it to 
+		/// invoke(objectPath, transport) for subsequent requests with
+		/// the same URI, avoiding the resolution of the URI.
+		///
+		/// Returns true if the object with the given URI was found, false otherwise.
+
 	bool invoke(const std::string& objectPath, ServerTransport& transport) const;
 		/// Invoke a method on the object registered for the given object path.
 		///
@@ -256,7 +278,67 @@ private:
 	ORB(const ORB&);
 	ORB& operator = (const ORB&);
 
-	RemoteObjectInfo::Ptr findLocalObject(const Identifiable::TypeId& tid, const Identifiable::ObjectId& oid, const std::string& protocol) const;
+	struct Snapshot
+		/// An immutable copy of the tables needed for
+		/// resolving and invoking objects.
+		///
+		/// RemoteObjectInfo objects are shared with the
+		/// ORB's own tables. Except for their eventDispatchers,
+		/// which are only accessed with _mutex held, they are
+		/// never modified after registration.
+	{
+		ListenerMap   listeners;
+		RemoteObjects remoteObjects;
+		RemoteObjects remoteObjectURIs;
+		URIAliases    uriAliases;
+	};
+
+	struct ReaderSlot
+		/// Counts the readers of a subset of threads that are
+		/// currently using a Snapshot, separately for both 
+		/// reader epochs (see publishSnapshot()).
+	{
+		Poco::AtomicCounter readers[2];
+		char padding[64]; // keep slots in separate cache lines
+	};
+
+	class ScopedSnapshot
+		/// Gives access to the current Snapshot for the
+		/// lifetime of the ScopedSnapshot object.
+	{
+	public:
+		ScopedSnapshot(const ORB& orb);
+		~ScopedSnapshot();
+		
+		const Snapshot* operator -> () const;
+		const Snapshot& operator * () const;
+		
+	private:
+		ScopedSnapshot(const ScopedSnapshot&);
+		ScopedSnapshot& operator = (const ScopedSnapshot&);
+		
+		Poco::AtomicCounter* _pReaders;
+		const Snapshot* _pSnapshot;
+	};
+
+	enum
+	{
+		READER_SLOTS = 16
+	};
+
+	RemoteObjectInfo::Ptr findLocalObject(const Snapshot& snapshot, const Identifiable::TypeId& tid, const Identifiable::ObjectId& oid, const std::string& protocol) const;
+	void publishSnapshot();
+		/// Replaces the current Snapshot with a copy of the
+		/// ORB's tables. Must be called with _mutex held.
+		///
+		/// The previous Snapshot is deleted after waiting
+		/// for all readers that may still use it. To prevent
+		/// new readers from delaying this indefinitely, readers 
+		/// are counted separately for two epochs. The epoch is 
+		/// switched, and the counters of the previous epoch are 
+		/// waited for, twice, so that readers that have obtained 
+		/// the epoch before the first switch are covered as well.
+	void waitForReaders(int epoch) const;
 
 	bool                _enabled;
 	ListenerMap         _listeners;         /// Maps endpoints to Listener objects
@@ -267,11 +349,29 @@ private:
 	URIAliases          _uriAliases;
 	Poco::Logger&       _logger;
 	mutable Poco::FastMutex _mutex;
+	Snapshot* volatile  _pSnapshot;
+	Poco::AtomicCounter _epoch;
+	mutable ReaderSlot  _readerSlots[READER_SLOTS];
 	
 	friend class Poco::SingletonHolder<ORB>;
 };
 
 
+//
+// inlines
+//
+inline const ORB::Snapshot* ORB::ScopedSnapshot::operator -> () const
+{
+	return _pSnapshot;
+}
+
+
+inline const ORB::Snapshot& ORB::ScopedSnapshot::operator * () const
+{
+	return *_pSnapshot;
+}
+
+
 } } // namespace Poco::RemotingNG
 
 
@@ -0,0 +1,77 @@
+//
+// ReplyHandler.h
+//
+// $Id$
+//
+// Library: RemotingNG
+// Package: Transport
+// Module:  ReplyHandler
+//
+// Definition of the ReplyHandler class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#ifndef RemotingNG_ReplyHandler_INCLUDED
+#define RemotingNG_ReplyHandler_INCLUDED
+
+
+#include "Poco/RemotingNG/RemotingNG.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+namespace RemotingNG {
+
+
+class Deserializer;
+
+
+class RemotingNG_API ReplyHandler: public Poco::RefCountedObject
+	/// A ReplyHandler receives the reply message for a request
+	/// sent with Transport::sendRequestAsync().
+	///
+	/// Depending on the Transport, the ReplyHandler may be
+	/// invoked by a thread owned by the Transport (e.g., the
+	/// thread reading from a network connection). Implementations
+	/// must therefore not block or invoke other remote methods.
+	///
+	/// See AsyncReply for the implementation used by
+	/// generated Proxy classes.
+{
+public:
+	typedef Poco::AutoPtr<ReplyHandler> Ptr;
+
+	ReplyHandler();
+		/// Creates the ReplyHandler.
+
+	virtual void handleReply(Deserializer& deserializer) = 0;
+		/// Reads the reply message using the given Deserializer.
+		///
+		/// The Deserializer is only valid during the call.
+
+	virtual void handleError(const Poco::Exception& exc) = 0;
+		/// Called by the Transport if no reply can be received
+		/// for the request, e.g. because the connection has
+		/// been closed or the reply has timed out.
+
+protected:
+	virtual ~ReplyHandler();
+		/// Destroys the ReplyHandler.
+
+private:
+	ReplyHandler(const ReplyHandler&);
+	ReplyHandler& operator = (const ReplyHandler&);
+};
+
+
+} } // namespace Poco::RemotingNG
+
+
+#endif // RemotingNG_ReplyHandler_INCLUDED
@@ -54,6 +54,15 @@ public:
 	virtual void serializeMessageBegin(const std::string& name, SerializerBase::MessageType type) = 0;
 		/// Begin serialization of a message.
 
+	virtual void serializeMessageBegin(const std::string& name, Poco::UInt32 id, SerializerBase::MessageType type);
+		/// Begin serialization of a message, also passing the
+		/// numeric message ID generated by RemoteGen from the
+		/// method name.
+		///
+		/// Serializers for compact binary protocols can write the
+		/// ID instead of the name. The default implementation
+		/// ignores the ID and calls serializeMessageBegin(name, type).
+
 	virtual void serializeMessageEnd(const std::string& name, SerializerBase::MessageType type) = 0;
 		/// End serialization of a message.
 
@@ -24,6 +24,7 @@
 #include "Poco/RemotingNG/AttributedObject.h"
 #include "Poco/RemotingNG/MethodHandler.h"
 #include "Poco/AutoPtr.h"
+#include <vector>
 #include <map>
 
 
@@ -54,7 +55,7 @@ public:
 		///
 		/// First, obtains a Deserializer from the given ServerTransport
 		/// by calling beginRequest().
-		/// Then, determines the method name from the request (by calling
+		/// Then, determines the method name or ID from the request (by calling
 		/// Deserializer::findMessage()), obtains the MethodHandler for the 
 		/// method and invokes the method using the MethodHandler.
 		///
@@ -65,20 +66,76 @@ public:
 		/// After processing the request, endRequest() is called on the ServerTransport.
 		///
 		/// Returns true if the method was found, false otherwise.
+
+	static Poco::UInt32 methodId(const std::string& name);
+		/// Returns the numeric ID RemoteGen generates for the
+		/// method with the given (remote) name.
+		///
+		/// The ID is the 32-bit FNV-1a hash of the name, with
+		/// 0 (which denotes "no ID") being mapped to 1. It is
+		/// therefore stable across builds and independent of
+		/// the declaration order of methods in the interface.
 		
 protected:
 	void addMethodHandler(const std::string& name, MethodHandler::Ptr pMethodHandler);
 		/// Adds a MethodHandler for the service object's method with the given name to the Skeleton. 
 		/// Takes ownership of the MethodHandler.
 
+	void addMethodHandler(const std::string& name, Poco::UInt32 id, MethodHandler::Ptr pMethodHandler);
+		/// Adds a MethodHandler for the service object's method with the given 
+		/// name and numeric ID (see methodId()) to the Skeleton. 
+		/// Takes ownership of the MethodHandler.
+		///
+		/// Requests identified by the ID are dispatched with a
+		/// lookup in an open-addressed table, instead of a
+		/// comparison of method names.
+
+	MethodHandler::Ptr findMethodHandler(Poco::UInt32 id) const;
+		/// Returns the MethodHandler for the given method ID, 
+		/// or null if no such MethodHandler exists.
+
 private:
 	Skeleton(const Skeleton&);
 	Skeleton& operator = (const Skeleton&);
 
+	struct IdEntry
+	{
+		IdEntry(): id(0)
+		{
+		}
+
+		Poco::UInt32 id;
+		MethodHandler::Ptr pHandler;
+	};
+	typedef std::vector<IdEntry> IdTable;
+
+	void insertId(IdTable& table, Poco::UInt32 id, MethodHandler::Ptr pMethodHandler);
+
 	MethodHandlers _handlers;
+	IdTable _handlersById;
+	std::size_t _idCount;
 };
 
 
+//
+// inlines
+//
+inline MethodHandler::Ptr Skeleton::findMethodHandler(Poco::UInt32 id) const
+{
+	if (!_handlersById.empty())
+	{
+		std::size_t mask = _handlersById.size() - 1;
+		std::size_t i = id & mask;
+		while (_handlersById[i].id != 0)
+		{
+			if (_handlersById[i].id == id) return _handlersById[i].pHandler;
+			i = (i + 1) & mask;
+		}
+	}
+	return MethodHandler::Ptr();
+}
+
+
 } } // namespace Poco::RemotingNG
 
 
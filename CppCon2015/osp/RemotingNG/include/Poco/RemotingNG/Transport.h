@@ -24,6 +24,7 @@
 #include "Poco/RemotingNG/AttributedObject.h"
 #include "Poco/RemotingNG/Identifiable.h"
 #include "Poco/RemotingNG/SerializerBase.h"
+#include "Poco/RemotingNG/ReplyHandler.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Mutex.h"
 #include <map>
@@ -79,6 +80,12 @@ class RemotingNG_API Transport: public AttributedObject
 	///      by sendRequest().
 	///   5. A call to endRequest() ends the message exchange.
 	///
+	/// Alternatively, a request can be delivered with sendRequestAsync(),
+	/// instead of steps 3 to 5. In this case, the reply is passed to a
+	/// ReplyHandler as soon as it arrives, and the Transport is ready for
+	/// the next message exchange immediately. Transports supporting this
+	/// can have any number of outstanding requests over a single connection.
+	///
 	/// Transport objects must be able to deal with incomplete message
 	/// exchange sequences. For example, if an exception occurs between
 	/// a call to beginRequest() and the corresponding call to sendRequest(),
@@ -147,6 +154,19 @@ public:
 	
 	virtual void endRequest() = 0;
 		/// Ends a request - reply message exchange.
+
+	virtual void sendRequestAsync(const Identifiable::ObjectId& oid, const Identifiable::TypeId& tid, const std::string& messageName, SerializerBase::MessageType messageType, ReplyHandler::Ptr pReplyHandler);
+		/// Deliver the request message to the server and complete the request - reply
+		/// message exchange without waiting for the reply. The reply message will
+		/// be passed to the given ReplyHandler as soon as it has been received.
+		///
+		/// All parameters must have the same value as the parameters passed to beginRequest().
+		/// If not, the behavior is undefined.
+		///
+		/// The default implementation calls sendRequest(), passes the Deserializer to
+		/// the ReplyHandler and calls endRequest(). The reply is thus received
+		/// synchronously, before sendRequestAsync() returns. Transports that can
+		/// receive replies in the background should override this method.
 	
 	void lock();
 		/// Locks the Transport's mutex.
@@ -23,6 +23,9 @@ namespace RemotingNG {
 
 
 BinaryDeserializer::BinaryDeserializer():
+	_messageId(0),
+	_messageFound(false),
+	_messageType(SerializerBase::MESSAGE_REQUEST),
 	_curLevel(0)
 {
 }
@@ -39,9 +42,25 @@ void BinaryDeserializer::deserializeEndPoint(std::string& oid, std::string& tid)
 }
 
 
+bool BinaryDeserializer::deserializeEndPoint(Poco::UInt32& handle, std::string& oid, std::string& tid)
+{
+	Poco::UInt32 value(0);
+	_pReader->read7BitEncoded(value);
+	checkStream();
+	handle = value >> 1;
+	if (value & 1)
+	{
+		*_pReader >> tid >> oid;
+		checkStream();
+		return true;
+	}
+	return false;
+}
+
+
 SerializerBase::MessageType BinaryDeserializer::findMessage(std::string& name)
 {
-	if (_messageName.empty())
+	if (!_messageFound)
 	{
 		findMessageImpl();
 	}
@@ -50,13 +69,25 @@ SerializerBase::MessageType BinaryDeserializer::findMessage(std::string& name)
 }
 
 
+SerializerBase::MessageType BinaryDeserializer::findMessage(std::string& name, Poco::UInt32& id)
+{
+	if (!_messageFound)
+	{
+		findMessageImpl();
+	}
+	name = _messageName;
+	id = _messageId;
+	return _messageType;
+}
+
+
 void BinaryDeserializer::deserializeMessageBegin(const std::string& name, SerializerBase::MessageType type)
 {
-	if (_messageName.empty())
+	if (!_messageFound)
 	{
 		findMessageImpl();
 	}
-	poco_assert (name == _messageName && type == _messageType);
+	poco_assert ((_messageId != 0 || name == _messageName) && type == _messageType);
 	_curLevel++;
 }
 
@@ -290,6 +321,8 @@ bool BinaryDeserializer::deserialize(const std::string& /*name*/, bool /*isManda
 void BinaryDeserializer::resetImpl()
 {
 	_messageName.clear();
+	_messageId = 0;
+	_messageFound = false;
 	_curLevel = 0;
 	while (!_sequenceLengths.empty())
 		_sequenceLengths.pop();
@@ -325,6 +358,8 @@ void BinaryDeserializer::findMessageImpl()
 		throw DeserializerException("no valid message start tag found");
 	Poco::UInt8 code(0);
 	*_pReader >> code;
+	bool hasId = (code & BinarySerializer::MESSAGE_CODE_ID_FLAG) != 0;
+	code = static_cast<Poco::UInt8>(code & ~BinarySerializer::MESSAGE_CODE_ID_FLAG);
 	switch (code)
 	{
 	case BinarySerializer::MESSAGE_CODE_REQUEST:
@@ -345,7 +380,21 @@ void BinaryDeserializer::findMessageImpl()
 	default:
 		throw DeserializerException("invalid message type code");
 	}
-	*_pReader >> _messageName;
+	if (hasId)
+	{
+		_messageName.clear();
+		_messageId = 0;
+		_pReader->read7BitEncoded(_messageId);
+		if (_messageId == 0)
+			throw DeserializerException("invalid message ID");
+	}
+	else
+	{
+		*_pReader >> _messageName;
+		_messageId = 0;
+	}
+	checkStream();
+	_messageFound = true;
 	if (_messageType == SerializerBase::MESSAGE_FAULT)
 	{
 		_curLevel++; // simulate deserializeMessageBegin()
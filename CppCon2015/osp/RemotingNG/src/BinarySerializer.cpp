@@ -26,7 +26,8 @@ const std::string BinarySerializer::MESSAGE_START_TAG("!msg");
 const std::string BinarySerializer::MESSAGE_END_TAG("!eom");
 
 
-BinarySerializer::BinarySerializer()
+BinarySerializer::BinarySerializer():
+	_messageIds(false)
 {
 }
 
@@ -42,33 +43,50 @@ void BinarySerializer::serializeEndPoint(const std::string& oid, const std::stri
 }
 
 
+void BinarySerializer::serializeEndPoint(Poco::UInt32 handle)
+{
+	poco_assert (handle != 0);
+
+	_pWriter->write7BitEncoded(handle << 1);
+}
+
+
+void BinarySerializer::serializeEndPoint(Poco::UInt32 handle, const std::string& oid, const std::string& tid)
+{
+	_pWriter->write7BitEncoded((handle << 1) | 1);
+	*_pWriter << tid << oid;
+}
+
+
+void BinarySerializer::enableMessageIds(bool enable)
+{
+	_messageIds = enable;
+}
+
+
 void BinarySerializer::serializeMessageBegin(const std::string& name, SerializerBase::MessageType type)
 {
 	poco_check_ptr (_pWriter.get());
 
 	_pWriter->writeRaw(MESSAGE_START_TAG);
-	Poco::UInt8 code(0);
-	switch (type)
+	*_pWriter << messageCode(type) << name;
+}
+
+
+void BinarySerializer::serializeMessageBegin(const std::string& name, Poco::UInt32 id, SerializerBase::MessageType type)
+{
+	if (_messageIds && id != 0)
 	{
-	case SerializerBase::MESSAGE_REQUEST:
-		code = MESSAGE_CODE_REQUEST;
-		break;
-	case SerializerBase::MESSAGE_REPLY:
-		code = MESSAGE_CODE_REPLY;
-		break;
-	case SerializerBase::MESSAGE_EVENT:
-		code = MESSAGE_CODE_EVENT;
-		break;
-	case SerializerBase::MESSAGE_EVENT_REPLY:
-		code = MESSAGE_CODE_EVENT_REPLY;
-		break;
-	case SerializerBase::MESSAGE_FAULT:
-		code = MESSAGE_CODE_FAULT;
-		break;
-	default:
-		poco_bugcheck();
+		poco_check_ptr (_pWriter.get());
+
+		_pWriter->writeRaw(MESSAGE_START_TAG);
+		*_pWriter << static_cast<Poco::UInt8>(messageCode(type) | MESSAGE_CODE_ID_FLAG);
+		_pWriter->write7BitEncoded(id);
+	}
+	else
+	{
+		serializeMessageBegin(name, type);
 	}
-	*_pWriter << code << name;
 }
 
 
@@ -221,6 +239,27 @@ void BinarySerializer::serialize(const std::string& /*name*/, const std::vector<
 }
 
 
+Poco::UInt8 BinarySerializer::messageCode(SerializerBase::MessageType type)
+{
+	switch (type)
+	{
+	case SerializerBase::MESSAGE_REQUEST:
+		return MESSAGE_CODE_REQUEST;
+	case SerializerBase::MESSAGE_REPLY:
+		return MESSAGE_CODE_REPLY;
+	case SerializerBase::MESSAGE_EVENT:
+		return MESSAGE_CODE_EVENT;
+	case SerializerBase::MESSAGE_EVENT_REPLY:
+		return MESSAGE_CODE_EVENT_REPLY;
+	case SerializerBase::MESSAGE_FAULT:
+		return MESSAGE_CODE_FAULT;
+	default:
+		poco_bugcheck();
+		return 0;
+	}
+}
+
+
 void BinarySerializer::resetImpl()
 {
 }
@@ -31,6 +31,13 @@ Deserializer::~Deserializer()
 }
 
 
+SerializerBase::MessageType Deserializer::findMessage(std::string& name, Poco::UInt32& id)
+{
+	id = 0;
+	return findMessage(name);
+}
+
+
 bool Deserializer::deserializeOptionalBegin(const std::string& name, bool isMandatory, bool& isSpecified)
 {
 	bool isNull;
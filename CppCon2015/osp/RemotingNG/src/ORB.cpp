@@ -23,6 +23,7 @@
 #include "Poco/NumberParser.h"
 #include "Poco/URI.h"
 #include "Poco/StringTokenizer.h"
+#include "Poco/Thread.h"
 #if defined(POCO_REQUIRE_LICENSE)
 #include "Poco/Licensing/License.h"
 #endif
@@ -34,13 +35,15 @@ namespace RemotingNG {
 
 ORB::ORB(): 
 	_enabled(true),
-	_logger(Poco::Logger::get("RemotingNG.ORB"))
+	_logger(Poco::Logger::get("RemotingNG.ORB")),
+	_pSnapshot(new Snapshot)
 {
 }
 
 
 ORB::~ORB()
 {
+	delete _pSnapshot;
 }
 
 
@@ -57,24 +60,45 @@ ORB& ORB::instance()
 void ORB::shutdown()
 {
 	_logger.information("Shutting down");
-	_enabled = false;
-	
-	ListenerMap::iterator it = _listeners.begin();
-	ListenerMap::iterator itEnd = _listeners.end();
-	for (; it != itEnd; ++it)
+
+	std::vector<Listener::Ptr> listeners;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_enabled = false;
+		listeners.reserve(_listeners.size());
+		for (ListenerMap::const_iterator it = _listeners.begin(); it != _listeners.end(); ++it)
+		{
+			listeners.push_back(it->second);
+		}
+	}
+
+	// Listeners are stopped without holding _mutex, as stopping
+	// a listener may wait for requests that still use the ORB.
+	for (std::vector<Listener::Ptr>::iterator it = listeners.begin(); it != listeners.end(); ++it)
 	{
-		it->second->stop();
+		(*it)->stop();
 	}
 	
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
 	_listeners.clear();
 	_remoteObjects.clear();
 	_remoteObjectURIs.clear();
 	_skeletons.clear();
 	_uriAliases.clear();
+	publishSnapshot();
 }
 
 
 bool ORB::invoke(const Listener& listener, const std::string& uri, ServerTransport& transport) const
+{
+	std::string objectPath;
+	return invoke(listener, uri, transport, objectPath);
+}
+
+
+bool ORB::invoke(const Listener& listener, const std::string& uri, ServerTransport& transport, std::string& objectPath) const
 {
 	poco_assert (!uri.empty());
 
@@ -91,12 +115,12 @@ bool ORB::invoke(const Listener& listener, const std::string& uri, ServerTranspo
 	
 	Skeleton::Ptr pSkeleton;
 	RemoteObject::Ptr pRemoteObject;
-	std::string objectPath;
+	objectPath.clear();
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		ScopedSnapshot pSnapshot(*this);
 	
-		URIAliases::const_iterator ita = _uriAliases.find(uriPath);
-		if (ita == _uriAliases.end())
+		URIAliases::const_iterator ita = pSnapshot->uriAliases.find(uriPath);
+		if (ita == pSnapshot->uriAliases.end())
 		{
 			Poco::StringTokenizer tok(uriPath, "/", Poco::StringTokenizer::TOK_IGNORE_EMPTY);
 			if (tok.count() == 3)
@@ -116,8 +140,8 @@ bool ORB::invoke(const Listener& listener, const std::string& uri, ServerTranspo
 		{
 			objectPath = ita->second;
 		}
-		RemoteObjects::const_iterator it = _remoteObjects.find(objectPath);
-		if (it == _remoteObjects.end()) return false;
+		RemoteObjects::const_iterator it = pSnapshot->remoteObjects.find(objectPath);
+		if (it == pSnapshot->remoteObjects.end()) return false;
 		pRemoteObject = it->second->pRemoteObject;
 		pSkeleton = it->second->pSkeleton;
 	}
@@ -139,10 +163,10 @@ bool ORB::invoke(const std::string& objectPath, ServerTransport& transport) cons
 	Skeleton::Ptr pSkeleton;
 	RemoteObject::Ptr pRemoteObject;
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
+		ScopedSnapshot pSnapshot(*this);
 	
-		RemoteObjects::const_iterator it = _remoteObjects.find(objectPath);
-		if (it == _remoteObjects.end()) return false;
+		RemoteObjects::const_iterator it = pSnapshot->remoteObjects.find(objectPath);
+		if (it == pSnapshot->remoteObjects.end()) return false;
 		pRemoteObject = it->second->pRemoteObject;
 		pSkeleton = it->second->pSkeleton;
 	}
@@ -161,22 +185,22 @@ Identifiable::Ptr ORB::findObject(const std::string& uri) const
 {
 	if (!_enabled) throw ORBDisabledException();
 
+	Identifiable::TypeId tid;
+	Identifiable::ObjectId oid;
+	std::string protocol;
+	RemoteObjectInfo::Ptr pRemoteObjectInfo;
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
-
-		RemoteObjects::const_iterator itRO = _remoteObjectURIs.find(uri);
-		if (itRO != _remoteObjectURIs.end())
+		ScopedSnapshot pSnapshot(*this);
+		RemoteObjects::const_iterator itRO = pSnapshot->remoteObjectURIs.find(uri);
+		if (itRO != pSnapshot->remoteObjectURIs.end())
 		{
 			return itRO->second->pRemoteObject;
 		}
+
+		URIUtility::parseURIPath(uri, oid, tid, protocol);
+		pRemoteObjectInfo = findLocalObject(*pSnapshot, tid, oid, protocol);
 	}
 
-	Identifiable::TypeId tid;
-	Identifiable::ObjectId oid;
-	std::string protocol;
-	URIUtility::parseURIPath(uri, oid, tid, protocol);
-	
-	RemoteObjectInfo::Ptr pRemoteObjectInfo = findLocalObject(tid, oid, protocol);
 	if (pRemoteObjectInfo && pRemoteObjectInfo->pListener->handlesURI(uri))
 		return pRemoteObjectInfo->pRemoteObject;
 	else
@@ -189,10 +213,9 @@ Identifiable::Ptr ORB::findObject(const std::string& uri, const Identifiable::Ty
 	if (!_enabled) throw ORBDisabledException();
 
 	{
-		Poco::FastMutex::ScopedLock lock(_mutex);
-
-		RemoteObjects::const_iterator itRO = _remoteObjectURIs.find(uri);
-		if (itRO != _remoteObjectURIs.end())
+		ScopedSnapshot pSnapshot(*this);
+		RemoteObjects::const_iterator itRO = pSnapshot->remoteObjectURIs.find(uri);
+		if (itRO != pSnapshot->remoteObjectURIs.end())
 		{
 			return itRO->second->pRemoteObject;
 		}
@@ -203,18 +226,16 @@ Identifiable::Ptr ORB::findObject(const std::string& uri, const Identifiable::Ty
 }
 
 
-ORB::RemoteObjectInfo::Ptr ORB::findLocalObject(const Identifiable::TypeId& tid, const Identifiable::ObjectId& oid, const std::string& protocol) const
+ORB::RemoteObjectInfo::Ptr ORB::findLocalObject(const Snapshot& snapshot, const Identifiable::TypeId& tid, const Identifiable::ObjectId& oid, const std::string& protocol) const
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
-
-	for (ListenerMap::const_iterator it = _listeners.begin(); it != _listeners.end(); ++it)
+	for (ListenerMap::const_iterator it = snapshot.listeners.begin(); it != snapshot.listeners.end(); ++it)
 	{
 		if (it->second->protocol() == protocol)
 		{
 			Listener::Ptr pListener = it->second;
 			std::string uri = pListener->createURI(tid, oid);
-			RemoteObjects::const_iterator itRO = _remoteObjectURIs.find(uri);
-			if (itRO != _remoteObjectURIs.end())
+			RemoteObjects::const_iterator itRO = snapshot.remoteObjectURIs.find(uri);
+			if (itRO != snapshot.remoteObjectURIs.end())
 			{
 				return itRO->second;
 			}	
@@ -224,10 +245,67 @@ ORB::RemoteObjectInfo::Ptr ORB::findLocalObject(const Identifiable::TypeId& tid,
 }
 
 
+void ORB::publishSnapshot()
+{
+	Snapshot* pSnapshot = new Snapshot;
+	pSnapshot->listeners        = _listeners;
+	pSnapshot->remoteObjects    = _remoteObjects;
+	pSnapshot->remoteObjectURIs = _remoteObjectURIs;
+	pSnapshot->uriAliases       = _uriAliases;
+
+	Snapshot* pOldSnapshot = _pSnapshot;
+	_pSnapshot = pSnapshot;
+
+	for (int i = 0; i < 2; i++)
+	{
+		int epoch = _epoch.value();
+		++_epoch;
+		waitForReaders(epoch & 1);
+	}
+	delete pOldSnapshot;
+}
+
+
+void ORB::waitForReaders(int epoch) const
+{
+	for (int i = 0; i < READER_SLOTS; i++)
+	{
+		while (_readerSlots[i].readers[epoch].value() != 0)
+		{
+			Poco::Thread::yield();
+		}
+	}
+}
+
+
+ORB::ScopedSnapshot::ScopedSnapshot(const ORB& orb):
+	_pReaders(0),
+	_pSnapshot(0)
+{
+	Poco::Thread* pThread = Poco::Thread::current();
+	ReaderSlot& slot = orb._readerSlots[pThread ? pThread->id() % READER_SLOTS : 0];
+	_pReaders = &slot.readers[orb._epoch.value() & 1];
+
+	// The increment is a full memory barrier, so the writer
+	// either sees this reader, or this reader sees the
+	// Snapshot published by the writer.
+	++(*_pReaders);
+	_pSnapshot = orb._pSnapshot;
+}
+
+
+ORB::ScopedSnapshot::~ScopedSnapshot()
+{
+	--(*_pReaders);
+}
+
+
 std::string ORB::registerListener(Listener::Ptr pListener)
 {
 	poco_check_ptr (pListener);
 	
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
 	if (_enabled)
 	{
 		std::string listenerId = pListener->protocol() + ":" + pListener->endPoint();
@@ -236,6 +314,7 @@ std::string ORB::registerListener(Listener::Ptr pListener)
 			pListener->start();
 		else 
 			throw Poco::IllegalStateException("Listener already registered for that endpoint");
+		publishSnapshot();
 
 		_logger.information("Listener registered for protocol: " + pListener->protocol() + " and endpoint: " + pListener->endPoint());
 		
@@ -268,12 +347,17 @@ void ORB::unregisterListener(const std::string& listenerId, bool autoRemoveObjec
 				_remoteObjects.erase(delIt);
 				continue;
 			}
-			else throw RemotingException("Listener has registered objects and cannot be unregistered");
+			else 
+			{
+				publishSnapshot();
+				throw RemotingException("Listener has registered objects and cannot be unregistered");
+			}
 		}
 		++itRO;
 	}
 	pListener->stop();
 	_listeners.erase(itListener);
+	publishSnapshot();
 }
 
 
@@ -366,10 +450,15 @@ void ORB::unregisterSkeleton(const Identifiable::TypeId& tid, bool autoRemoveObj
 				_remoteObjects.erase(delIt);
 				continue;
 			}
-			else throw RemotingException("Skeleton is still in use and cannot be unregistered");
+			else 
+			{
+				publishSnapshot();
+				throw RemotingException("Skeleton is still in use and cannot be unregistered");
+			}
 		}
 		++itRO;
 	}
+	publishSnapshot();
 }
 
 
@@ -429,12 +518,12 @@ void ORB::unregisterClass(const Identifiable::TypeId& tid, bool autoRemoveObject
 
 std::string ORB::registerObject(RemoteObject::Ptr pRemoteObject, const std::string& listenerId)
 {
-	if (!_enabled) throw ORBDisabledException();
-
 	poco_check_ptr (pRemoteObject);
 
 	Poco::FastMutex::ScopedLock lock(_mutex);
 
+	if (!_enabled) throw ORBDisabledException();
+
 	ListenerMap::iterator itListener = _listeners.find(listenerId);
 	if (itListener == _listeners.end())
 	{
@@ -487,6 +576,7 @@ std::string ORB::registerObject(RemoteObject::Ptr pRemoteObject, const std::stri
 	{
 		_uriAliases.insert(std::make_pair(pRemoteObject->remoting__getURI().getPath(), objectPath));
 	}
+	publishSnapshot();
 
 	if (_logger.information())
 	{
@@ -512,6 +602,7 @@ void ORB::unregisterObject(const std::string& uri)
 			_uriAliases.erase(itAl);
 		}
 		_remoteObjectURIs.erase(itRO);
+		publishSnapshot();
 	}
 }
 
@@ -0,0 +1,34 @@
+//
+// ReplyHandler.cpp
+//
+// $Id$
+//
+// Library: RemotingNG
+// Package: Transport
+// Module:  ReplyHandler
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// All rights reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "Poco/RemotingNG/ReplyHandler.h"
+
+
+namespace Poco {
+namespace RemotingNG {
+
+
+ReplyHandler::ReplyHandler()
+{
+}
+
+
+ReplyHandler::~ReplyHandler()
+{
+}
+
+
+} } // namespace Poco::RemotingNG
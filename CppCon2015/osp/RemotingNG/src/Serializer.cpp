@@ -31,6 +31,12 @@ Serializer::~Serializer()
 }
 
 
+void Serializer::serializeMessageBegin(const std::string& name, Poco::UInt32 /*id*/, SerializerBase::MessageType type)
+{
+	serializeMessageBegin(name, type);
+}
+
+
 void Serializer::serializeOptionalBegin(const std::string& name, bool isSpecified)
 {
 	serializeNullableBegin(name, !isSpecified);
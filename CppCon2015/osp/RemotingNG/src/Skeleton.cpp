@@ -20,13 +20,15 @@
 #include "Poco/RemotingNG/MethodHandler.h"
 #include "Poco/RemotingNG/ServerTransport.h"
 #include "Poco/RemotingNG/RemotingException.h"
+#include "Poco/NumberFormatter.h"
 
 
 namespace Poco {
 namespace RemotingNG {
 
 
-Skeleton::Skeleton()
+Skeleton::Skeleton():
+	_idCount(0)
 {
 }
 
@@ -41,17 +43,28 @@ bool Skeleton::invoke(ServerTransport& transport, RemoteObject::Ptr pRemoteObjec
 	bool result = true;
 	Deserializer& deser = transport.beginRequest();
 	std::string messageName;
-	SerializerBase::MessageType messageType = deser.findMessage(messageName);
+	Poco::UInt32 messageId(0);
+	SerializerBase::MessageType messageType = deser.findMessage(messageName, messageId);
 	if (messageType != SerializerBase::MESSAGE_REQUEST && messageType != SerializerBase::MESSAGE_EVENT)
 		throw UnexpectedMessageException("request or event message expected");
-	Skeleton::MethodHandlers::iterator it = _handlers.find(messageName);
-	if (it != _handlers.end())
+	MethodHandler::Ptr pHandler;
+	if (messageId != 0)
 	{
-		it->second->invoke(transport, deser, pRemoteObject);
+		pHandler = findMethodHandler(messageId);
+	}
+	else
+	{
+		Skeleton::MethodHandlers::iterator it = _handlers.find(messageName);
+		if (it != _handlers.end()) pHandler = it->second;
+	}
+	if (pHandler)
+	{
+		pHandler->invoke(transport, deser, pRemoteObject);
 	}
 	else
 	{
 		result = false;
+		if (messageId != 0) messageName = "#" + Poco::NumberFormatter::formatHex(messageId);
 		RemotingNG::Serializer& ser = transport.sendReply(SerializerBase::MESSAGE_FAULT);
 		MethodNotFoundException exc(messageName);
 		ser.serializeFaultMessage(messageName, exc);
@@ -61,10 +74,57 @@ bool Skeleton::invoke(ServerTransport& transport, RemoteObject::Ptr pRemoteObjec
 }
 
 
+Poco::UInt32 Skeleton::methodId(const std::string& name)
+{
+	Poco::UInt32 id = 2166136261U;
+	for (std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+	{
+		id ^= static_cast<unsigned char>(*it);
+		id *= 16777619U;
+	}
+	return id ? id : 1;
+}
+
+
 void Skeleton::addMethodHandler(const std::string& name, MethodHandler::Ptr pMethodHandler)
 {
 	_handlers[name] = pMethodHandler;
 }
 
 
+void Skeleton::addMethodHandler(const std::string& name, Poco::UInt32 id, MethodHandler::Ptr pMethodHandler)
+{
+	poco_assert (id != 0);
+
+	addMethodHandler(name, pMethodHandler);
+
+	// Keep the load factor of the table at or below 50 %.
+	if (2*(_idCount + 1) > _handlersById.size())
+	{
+		IdTable table(_handlersById.empty() ? 16 : 2*_handlersById.size());
+		for (IdTable::const_iterator it = _handlersById.begin(); it != _handlersById.end(); ++it)
+		{
+			if (it->id != 0) insertId(table, it->id, it->pHandler);
+		}
+		_handlersById.swap(table);
+	}
+	insertId(_handlersById, id, pMethodHandler);
+	_idCount++;
+}
+
+
+void Skeleton::insertId(IdTable& table, Poco::UInt32 id, MethodHandler::Ptr pMethodHandler)
+{
+	std::size_t mask = table.size() - 1;
+	std::size_t i = id & mask;
+	while (table[i].id != 0)
+	{
+		poco_assert_msg (table[i].id != id, "duplicate method ID");
+		i = (i + 1) & mask;
+	}
+	table[i].id = id;
+	table[i].pHandler = pMethodHandler;
+}
+
+
 } } // namespace Poco::RemotingNG
@@ -15,6 +15,7 @@
 
 
 #include "Poco/RemotingNG/Transport.h"
+#include "Poco/RemotingNG/Deserializer.h"
 
 
 namespace Poco {
@@ -31,4 +32,12 @@ Transport::~Transport()
 }
 
 
+void Transport::sendRequestAsync(const Identifiable::ObjectId& oid, const Identifiable::TypeId& tid, const std::string& messageName, SerializerBase::MessageType messageType, ReplyHandler::Ptr pReplyHandler)
+{
+	Deserializer& deserializer = sendRequest(oid, tid, messageName, messageType);
+	pReplyHandler->handleReply(deserializer);
+	endRequest();
+}
+
+
 } } // namespace Poco::RemotingNG
@@ -28,6 +28,9 @@
 #include "Poco/NumberFormatter.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/Delegate.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include "Poco/AtomicCounter.h"
 #include "Tester.h"
 #include "TesterServerHelper.h"
 #include "TesterClientHelper.h"
@@ -306,6 +309,46 @@ namespace
 	private:
 		MockListener::Ptr _pListener;
 	};
+	
+	
+	class ConcurrentClient: public Poco::Runnable
+	{
+	public:
+		ConcurrentClient(const std::string& objectURI, Poco::AtomicCounter& errors):
+			_objectURI(objectURI),
+			_errors(errors),
+			_stop(false)
+		{
+		}
+		
+		void run()
+		{
+			while (!_stop)
+			{
+				try
+				{
+					ITester::Ptr pTester = TesterClientHelper::find(_objectURI);
+					if (pTester.cast<TesterRemoteObject>().isNull()) ++_errors;
+					pTester = TesterClientHelper::find("MOCK://localhost/MOCK/Tester/TheTester");
+					if (pTester->testInt1(42) != 42) ++_errors;
+				}
+				catch (...)
+				{
+					++_errors;
+				}
+			}
+		}
+		
+		void stop()
+		{
+			_stop = true;
+		}
+		
+	private:
+		std::string _objectURI;
+		Poco::AtomicCounter& _errors;
+		volatile bool _stop;
+	};
 }
 
 
@@ -586,6 +629,34 @@ void RemotingTest::testOneWayEvent()
 }
 
 
+void RemotingTest::testConcurrentRegistration()
+{
+	const int CLIENTS = 4;
+	Poco::AtomicCounter errors;
+	std::vector<Poco::SharedPtr<ConcurrentClient> > clients;
+	std::vector<Poco::SharedPtr<Poco::Thread> > threads;
+	for (int i = 0; i < CLIENTS; i++)
+	{
+		clients.push_back(new ConcurrentClient(_objectURI, errors));
+		threads.push_back(new Poco::Thread);
+		threads.back()->start(*clients.back());
+	}
+	
+	for (int i = 0; i < 200; i++)
+	{
+		std::string uri = TesterServerHelper::registerObject(new Tester, "Other" + Poco::NumberFormatter::format(i), _listener);
+		TesterServerHelper::unregisterObject(uri);
+	}
+	
+	for (int i = 0; i < CLIENTS; i++)
+	{
+		clients[i]->stop();
+		threads[i]->join();
+	}
+	assert (errors.value() == 0);
+}
+
+
 void RemotingTest::testInt(ITester::Ptr pTester)
 {
 	int i = pTester->testInt1(42);
@@ -908,6 +979,7 @@ CppUnit::Test* RemotingTest::suite()
 	CppUnit_addTest(pSuite, RemotingTest, testOneWay);
 	CppUnit_addTest(pSuite, RemotingTest, testEvent);
 	CppUnit_addTest(pSuite, RemotingTest, testOneWayEvent);
+	CppUnit_addTest(pSuite, RemotingTest, testConcurrentRegistration);
 
 	return pSuite;
 }
@@ -46,6 +46,7 @@ public:
 	void testOneWay();
 	void testEvent();
 	void testOneWayEvent();
+	void testConcurrentRegistration();
 
 	void setUp();
 	void tearDown();
@@ -22,6 +22,7 @@
 
 #include "Poco/WebTunnel/WebTunnel.h"
 #include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/PollSet.h"
 #include "Poco/NotificationQueue.h"
 #include "Poco/Thread.h"
 #include "Poco/RunnableAdapter.h"
@@ -42,11 +43,12 @@ class WebTunnel_API SocketDispatcher
 	/// Reactor pattern, optimized for forwarding data from one
 	/// socket to another.
 	///
-	/// The SocketDispatcher runs a select() loop in a separate thread.
-	/// As soon as a socket becomes readable, it will be put into a work
-	/// queue. A number of worker threads dequeue work queue items and
+	/// The SocketDispatcher runs a poll loop, using a Poco::Net::PollSet,
+	/// in a separate thread. As soon as a socket becomes readable, it will
+	/// be removed from the PollSet and put into a work queue. A number of worker threads dequeue work queue items and
 	/// process the data received over the socket, using registered
-	/// SocketHandler instances.
+	/// SocketHandler instances. When a worker is done with a socket,
+	/// the socket is added to the PollSet again.
 {
 public:
 	class SocketHandler: public Poco::RefCountedObject
@@ -71,6 +73,11 @@ public:
 
 	void addSocket(const Poco::Net::StreamSocket& socket, SocketHandler::Ptr pHandler, Poco::Timespan timeout = 0);
 		/// Adds a socket and its handler to the SocketDispatcher.
+		///
+		/// If a non-zero timeout is given, the handler's timeout() method
+		/// will be called if the socket has not become readable within 
+		/// the timeout. Timeouts are checked with a granularity of 
+		/// 100 milliseconds.
 		
 	void removeSocket(const Poco::Net::StreamSocket& socket);
 		/// Removes a socket and its associated handler from the SocketDispatcher.
@@ -114,15 +121,26 @@ protected:
 	void readableImpl(Poco::Net::StreamSocket& socket, SocketInfo::Ptr pInfo);
 	void exceptionImpl(Poco::Net::StreamSocket& socket, SocketInfo::Ptr pInfo);
 	void timeoutImpl(Poco::Net::StreamSocket& socket, SocketInfo::Ptr pInfo);
+	void checkTimeouts();
+	void watchSocket(const Poco::Net::StreamSocket& socket);
+	void watchSocketImpl(const Poco::Net::StreamSocket& socket);
+	void unwatchSocketImpl(const Poco::Net::StreamSocket& socket, SocketInfo::Ptr pInfo);
 	void addSocketImpl(const Poco::Net::StreamSocket& socket, SocketHandler::Ptr pHandler, Poco::Timespan timeout);
 	void removeSocketImpl(const Poco::Net::StreamSocket& socket);
 	void closeSocketImpl(Poco::Net::StreamSocket& socket);
 	void resetImpl();
 
 private:	
+	enum
+	{
+		TIMEOUT_CHECK_INTERVAL = 100000
+	};
+
 	Poco::Timespan _timeout;
 	int _maxReadsPerWorker;
 	SocketMap _socketMap;
+	Poco::Net::PollSet _pollSet;
+	Poco::Clock _lastTimeoutCheck;
 	Poco::Thread _mainThread;
 	ThreadVec _workerThreads;
 	Poco::RunnableAdapter<SocketDispatcher> _mainRunnable;
@@ -135,6 +153,7 @@ private:
 	friend class ReadableNotification;
 	friend class ExceptionNotification;
 	friend class TimeoutNotification;
+	friend class WatchSocketNotification;
 	friend class AddSocketNotification;
 	friend class RemoveSocketNotification;
 	friend class CloseSocketNotification;
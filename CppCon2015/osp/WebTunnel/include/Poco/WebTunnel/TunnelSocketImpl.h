@@ -49,6 +49,7 @@ public:
 	
 	// StreamSocketImpl
 	virtual int sendBytes(const void* buffer, int length, int flags);		
+	virtual int sendBytes(const Poco::Net::SocketBufVec& buffers, int flags);
 	virtual int receiveBytes(void* buffer, int length, int flags);
 	virtual Poco::Net::SocketImpl* acceptConnection(Poco::Net::SocketAddress& clientAddr);
 	virtual void connect(const Poco::Net::SocketAddress& address);
@@ -106,6 +106,25 @@ private:
 };
 
 
+class WatchSocketNotification: public TaskNotification
+{
+public:
+	WatchSocketNotification(SocketDispatcher& dispatcher, const Poco::Net::StreamSocket& socket):
+		TaskNotification(dispatcher),
+		_socket(socket)
+	{
+	}
+	
+	void execute()
+	{
+		_dispatcher.watchSocketImpl(_socket);
+	}
+	
+private:
+	Poco::Net::StreamSocket _socket;
+};
+
+
 class AddSocketNotification: public TaskNotification
 {
 public:
@@ -226,6 +245,7 @@ void SocketDispatcher::stop()
 			(*it)->join();
 		}
 		_socketMap.clear();
+		_pollSet.clear();
 	}
 }
 
@@ -256,59 +276,36 @@ void SocketDispatcher::closeSocket(const Poco::Net::StreamSocket& socket)
 
 void SocketDispatcher::runMain()
 {
-	Poco::Net::Socket::SocketList readList;
-	Poco::Net::Socket::SocketList writeList;
-	Poco::Net::Socket::SocketList exceptList;
-
 	while (!_stopped)
 	{
 		try
 		{
-			readList.clear();
-			exceptList.clear();
-			for (SocketMap::iterator it = _socketMap.begin(); it != _socketMap.end(); ++it)
+			if (_lastTimeoutCheck.isElapsed(TIMEOUT_CHECK_INTERVAL))
 			{
-				if (it->second->wantRead && it->second->timeout != 0 && it->second->timeout < it->second->activity.elapsed())
-				{
-					it->second->wantRead = false;
-					it->second->activity.update();
-					timeout(it->first, it->second);
-				}
-				if (it->second->wantRead)
-				{
-					readList.push_back(it->first);
-					exceptList.push_back(it->first);	
-				}
-				else
-				{
-					// reset timeout clock
-					it->second->activity.update();
-				}
+				checkTimeouts();
+				_lastTimeoutCheck.update();
 			}
-			
-			int n = Poco::Net::Socket::select(readList, writeList, exceptList, _timeout);
-			if (n > 0)
+
+			Poco::Net::PollSet::SocketModeMap ready = _pollSet.poll(_timeout);
+			for (Poco::Net::PollSet::SocketModeMap::iterator it = ready.begin(); it != ready.end(); ++it)
 			{
-				for (Poco::Net::Socket::SocketList::iterator it = readList.begin(); it != readList.end(); ++it)
+				SocketMap::iterator its = _socketMap.find(it->first);
+				if (its != _socketMap.end())
 				{
-					SocketMap::iterator its = _socketMap.find(*it);
-					if (its != _socketMap.end())
+					unwatchSocketImpl(its->first, its->second);
+					if (it->second & Poco::Net::PollSet::POLL_READ)
 					{
-						its->second->wantRead = false;
-						its->second->activity.update();
 						readable(its->first, its->second);
 					}
-				}
-				for (Poco::Net::Socket::SocketList::iterator it = exceptList.begin(); it != exceptList.end(); ++it)
-				{
-					SocketMap::iterator its = _socketMap.find(*it);
-					if (its != _socketMap.end())
+					if (it->second & Poco::Net::PollSet::POLL_ERROR)
 					{
-						its->second->wantRead = false;
-						its->second->activity.update();
 						exception(its->first, its->second);
 					}
 				}
+				else
+				{
+					_pollSet.remove(it->first);
+				}
 			}
 		
 			Poco::Notification::Ptr pNf = _socketMap.empty() ? _mainQueue.waitDequeueNotification() : _mainQueue.dequeueNotification();
@@ -365,6 +362,25 @@ void SocketDispatcher::runWorker()
 }
 
 
+void SocketDispatcher::checkTimeouts()
+{
+	for (SocketMap::iterator it = _socketMap.begin(); it != _socketMap.end(); ++it)
+	{
+		if (it->second->wantRead && it->second->timeout != 0 && it->second->timeout < it->second->activity.elapsed())
+		{
+			unwatchSocketImpl(it->first, it->second);
+			timeout(it->first, it->second);
+		}
+	}
+}
+
+
+void SocketDispatcher::watchSocket(const Poco::Net::StreamSocket& socket)
+{
+	_mainQueue.enqueueNotification(new WatchSocketNotification(*this, socket));
+}
+
+
 void SocketDispatcher::readable(const Poco::Net::StreamSocket& socket, const SocketDispatcher::SocketInfo::Ptr& pInfo)
 {
 	_workerQueue.enqueueNotification(new ReadableNotification(*this, socket, pInfo));
@@ -399,7 +415,7 @@ void SocketDispatcher::readableImpl(Poco::Net::StreamSocket& socket, SocketDispa
 	{
 		_logger.log(exc);
 	}
-	pInfo->wantRead = socket.impl()->initialized();
+	if (socket.impl()->initialized()) watchSocket(socket);
 }
 
 
@@ -426,25 +442,28 @@ void SocketDispatcher::timeoutImpl(Poco::Net::StreamSocket& socket, SocketDispat
 	{
 		_logger.log(exc);
 	}
-	pInfo->wantRead = socket.impl()->initialized();
+	if (socket.impl()->initialized()) watchSocket(socket);
 }
 
 
 void SocketDispatcher::addSocketImpl(const Poco::Net::StreamSocket& socket, SocketHandler::Ptr pHandler, Poco::Timespan timeout)
 {
 	_socketMap[socket] = new SocketInfo(pHandler, timeout);
+	_pollSet.add(socket, Poco::Net::PollSet::POLL_READ | Poco::Net::PollSet::POLL_ERROR);
 }
 
 
 void SocketDispatcher::removeSocketImpl(const Poco::Net::StreamSocket& socket)
 {
 	_socketMap.erase(socket);
+	_pollSet.remove(socket);
 }
 
 
 void SocketDispatcher::closeSocketImpl(Poco::Net::StreamSocket& socket)
 {
 	_socketMap.erase(socket);
+	_pollSet.remove(socket);
 	socket.shutdown();
 }
 
@@ -452,6 +471,27 @@ void SocketDispatcher::closeSocketImpl(Poco::Net::StreamSocket& socket)
 void SocketDispatcher::resetImpl()
 {
 	_socketMap.clear();
+	_pollSet.clear();
+}
+
+
+void SocketDispatcher::watchSocketImpl(const Poco::Net::StreamSocket& socket)
+{
+	SocketMap::iterator it = _socketMap.find(socket);
+	if (it != _socketMap.end() && !it->second->wantRead)
+	{
+		it->second->wantRead = true;
+		it->second->activity.update();
+		_pollSet.add(socket, Poco::Net::PollSet::POLL_READ | Poco::Net::PollSet::POLL_ERROR);
+	}
+}
+
+
+void SocketDispatcher::unwatchSocketImpl(const Poco::Net::StreamSocket& socket, SocketInfo::Ptr pInfo)
+{
+	pInfo->wantRead = false;
+	pInfo->activity.update();
+	_pollSet.remove(socket);
 }
 
 
@@ -105,6 +105,16 @@ int TunnelSocketImpl::sendBytes(const void* buffer, int length, int flags)
 }
 
 	
+int TunnelSocketImpl::sendBytes(const Poco::Net::SocketBufVec& buffers, int flags)
+{
+	// Each write produces a separate tunnel protocol frame, so the 
+	// buffers are combined and sent with a single write.
+	Poco::Buffer<char> buffer(0);
+	gatherBuffers(buffers, buffer);
+	return sendBytes(buffer.begin(), static_cast<int>(buffer.size()), flags);
+}
+
+
 int TunnelSocketImpl::receiveBytes(void* buffer, int length, int)
 {
 	int n = _readBuffer.read(reinterpret_cast<char*>(buffer), length, static_cast<long>(_receiveTimeout.totalMilliseconds()));